@@ -235,7 +235,9 @@ public:
 
     // perform setup of turbulent channel related things
     statistics_turb_ch.reset(
-      new StatisticsManager<dim, Number>(pde_operator.get_dof_handler_vector(),
+      new StatisticsManager<dim, Number>(pde_operator.get_matrix_free(),
+                                         pde_operator.get_dof_index_vector(),
+                                         pde_operator.get_quad_index_standard(),
                                          pde_operator.get_mapping()));
 
     statistics_turb_ch->setup(&grid_transform_y, turb_ch_data);
@@ -262,6 +264,19 @@ public:
   {
   }
 
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+      prm.add_parameter("NStepSizeClasses", n_step_size_classes, "Number of step size classes of multirate time stepping (1: single-rate time stepping).", dealii::Patterns::Integer(1,32));
+      prm.add_parameter("IMEX",             imex,                "Treat viscous term implicitly by an IMEX Runge-Kutta scheme.");
+    prm.leave_subsection();
+    // clang-format on
+  }
+
 private:
   void
   set_parameters() final
@@ -292,6 +307,28 @@ private:
     this->param.exponent_fe_degree_cfl        = 1.5;
     this->param.exponent_fe_degree_viscous    = 3.0;
 
+    // multirate time stepping: the cells in the bulk of the channel are advanced with larger
+    // time step sizes than the cells refined towards the walls
+    if(n_step_size_classes > 1)
+    {
+      this->param.temporal_discretization = TemporalDiscretization::ExplRK2Multirate;
+      this->param.order_time_integrator   = 2;
+      this->param.n_step_size_classes     = n_step_size_classes;
+      // the explicit midpoint rule has a smaller stability region than ExplRK3Stage7Reg2
+      this->param.cfl_number = 0.2;
+    }
+
+    // IMEX time stepping: the viscous term is treated implicitly so that the time step size is
+    // no longer restricted by the small cells at the walls via the diffusion number
+    if(imex)
+    {
+      this->param.temporal_discretization       = TemporalDiscretization::IMEXRK3Stage4;
+      this->param.order_time_integrator         = 3;
+      this->param.calculation_of_time_step_size = TimeStepCalculation::CFL;
+      // the explicit part of ARK3(2)4L[2]SA has a smaller stability region than ExplRK3Stage7Reg2
+      this->param.cfl_number = 0.6;
+    }
+
     // output of solver information
     this->param.solver_info_data.interval_time = CHARACTERISTIC_TIME;
 
@@ -304,8 +341,14 @@ private:
     // viscous term
     this->param.IP_factor = 1.0;
 
+    // SOLVER
+    this->param.newton_solver_data_viscous  = Newton::SolverData(100, 1.e-12, 1.e-6);
+    this->param.solver_data_viscous         = SolverData(1000, 1.e-12, 1.e-2, 30);
+    this->param.preconditioner_viscous      = PreconditionerViscous::Multigrid;
+    this->param.multigrid_data_viscous.type = MultigridType::hMG;
+
     // NUMERICAL PARAMETERS
-    this->param.use_combined_operator = true;
+    this->param.use_combined_operator = not(imex);
   }
 
   void
@@ -428,6 +471,10 @@ private:
 
     return pp;
   }
+
+  unsigned int n_step_size_classes = 1;
+
+  bool imex = false;
 };
 
 } // namespace CompNS
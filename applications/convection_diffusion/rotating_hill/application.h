@@ -51,11 +51,11 @@ public:
 };
 
 template<int dim>
-class VelocityField : public dealii::Function<dim>
+class VelocityField : public FunctionVectorized<dim>
 {
 public:
   VelocityField(unsigned int const n_components = dim, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : FunctionVectorized<dim>(n_components, time)
   {
   }
 
@@ -71,6 +71,20 @@ public:
 
     return value;
   }
+
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & point,
+                   unsigned int const component = 0) const final
+  {
+    dealii::VectorizedArray<double> value = 0.0;
+
+    if(component == 0)
+      value = -point[1] * 2.0 * dealii::numbers::PI;
+    else if(component == 1)
+      value = point[0] * 2.0 * dealii::numbers::PI;
+
+    return value;
+  }
 };
 
 template<int dim, typename Number>
@@ -29,11 +29,11 @@ namespace ExaDG
 namespace ConvDiff
 {
 template<int dim>
-class Velocity : public dealii::Function<dim>
+class Velocity : public FunctionVectorized<dim>
 {
 public:
   Velocity(unsigned int const n_components = 1, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : FunctionVectorized<dim>(n_components, time)
   {
   }
 
@@ -42,6 +42,13 @@ public:
   {
     return p[component];
   }
+
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & p,
+                   unsigned int const component = 0) const final
+  {
+    return p[component];
+  }
 };
 
 enum class MeshType
@@ -70,8 +70,11 @@ public:
     // turbulent channel statistics for precursor simulation
     if(pp_data_bfs.turb_ch_data.calculate)
     {
-      statistics_turb_ch.reset(new StatisticsManager<dim, Number>(pde_operator.get_dof_handler_u(),
-                                                                  *pde_operator.get_mapping()));
+      statistics_turb_ch.reset(
+        new StatisticsManager<dim, Number>(pde_operator.get_matrix_free(),
+                                           pde_operator.get_dof_index_velocity(),
+                                           pde_operator.get_quad_index_velocity_linear(),
+                                           *pde_operator.get_mapping()));
 
       statistics_turb_ch->setup(&Geometry::grid_transform_turb_channel, pp_data_bfs.turb_ch_data);
     }
@@ -70,6 +70,18 @@ Driver<dim, Number>::setup()
   matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
   matrix_free_data->append(pde_operator);
 
+  // multirate time stepping requires cell batches with cells of the same step size class
+  Parameters const & param = application->get_parameters();
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK2Multirate)
+  {
+    Categorization::do_step_size_classes(
+      *application->get_grid()->triangulation,
+      matrix_free_data->data,
+      calculate_step_size_classes(*application->get_grid()->triangulation,
+                                  param.n_step_size_classes,
+                                  mpi_comm));
+  }
+
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
   matrix_free->reinit(*application->get_grid()->mapping,
                       matrix_free_data->get_dof_handler_vector(),
@@ -113,6 +125,17 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
 
   this->pcout << "Performance results for compressible Navier-Stokes solver:" << std::endl;
 
+  // Averaged number of iterations are only relevant for IMEX schemes
+  if(application->get_parameters().viscous_term_is_implicit())
+  {
+    this->pcout << std::endl << "Average number of iterations:" << std::endl;
+
+    time_integrator->print_iterations();
+  }
+
+  // accepted and rejected time steps in case of embedded error control
+  time_integrator->print_error_control_statistics();
+
   // Wall times
   timer_tree.insert({"Compressible flow"}, total_time);
 
@@ -155,7 +178,7 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   string_to_enum(operator_type, operator_type_string);
 
   // Vectors
-  VectorType dst, src;
+  VectorType dst, src, solution;
 
   // initialize vectors
   pde_operator->initialize_dof_vector(src);
@@ -163,6 +186,40 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   src = 1.0;
   dst = 1.0;
 
+  // a stage of a low-storage Runge-Kutta method additionally updates the solution vector
+  if(operator_type == OperatorType::LowStorageRKStage)
+  {
+    pde_operator->initialize_dof_vector(solution);
+    solution = 1.0;
+  }
+
+  /*
+   * The single-rate and the multirate time step advance the solution over the same time interval,
+   * i.e. one time step of the coarsest step size class, so that the ratio of the throughput
+   * values of both operator types is the speedup of the multirate scheme.
+   */
+  typedef Interface::Operator<Number> OperatorBase;
+
+  unsigned int const n_classes = application->get_parameters().n_step_size_classes;
+  double const       dt_finest = 1.0e-6;
+
+  std::shared_ptr<ExplicitTimeIntegrator<OperatorBase, VectorType>> rk_time_integrator;
+  if(operator_type == OperatorType::SingleRateTimeStep)
+  {
+    rk_time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorBase, VectorType>>(2,
+                                                                                    pde_operator);
+  }
+  else if(operator_type == OperatorType::MultirateTimeStep)
+  {
+    AssertThrow(application->get_parameters().temporal_discretization ==
+                  TemporalDiscretization::ExplRK2Multirate,
+                dealii::ExcMessage("MultirateTimeStep requires ExplRK2Multirate."));
+
+    rk_time_integrator =
+      std::make_shared<MultirateRK2<OperatorBase, VectorType>>(pde_operator, n_classes);
+  }
+
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::ConvectiveTerm)
       pde_operator->evaluate_convective(dst, src, 0.0);
@@ -178,6 +235,16 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
       dst.sadd(2.0, 1.0, src);
     else if(operator_type == OperatorType::EvaluateOperatorExplicit)
       pde_operator->evaluate(dst, src, 0.0);
+    else if(operator_type == OperatorType::LowStorageRKStage)
+      pde_operator->evaluate_low_storage_rk_stage(
+        src, solution, dst, src, 1.0e-6, 1.0e-6, true, 0.0);
+    else if(operator_type == OperatorType::SingleRateTimeStep)
+    {
+      for(unsigned int i = 0; i < (1u << (n_classes - 1)); ++i)
+        rk_time_integrator->solve_timestep(dst, src, 0.0, dt_finest);
+    }
+    else if(operator_type == OperatorType::MultirateTimeStep)
+      rk_time_integrator->solve_timestep(dst, src, 0.0, dt_finest * (1u << (n_classes - 1)));
     else
       AssertThrow(false, dealii::ExcMessage("Specified operator type not implemented"));
   };
@@ -31,6 +31,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 #include <exadg/grid/mapping_dof_vector.h>
+#include <exadg/matrix_free/categorization.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/utilities/print_general_infos.h>
 
@@ -47,7 +48,10 @@ enum class OperatorType
   InverseMassOperator,
   InverseMassOperatorDstDst,
   VectorUpdate,
-  EvaluateOperatorExplicit
+  EvaluateOperatorExplicit,
+  LowStorageRKStage,
+  SingleRateTimeStep, // 2^{L-1} steps of the explicit midpoint rule, L = n_step_size_classes
+  MultirateTimeStep   // one step of ExplRK2Multirate covering the same time interval
 };
 
 inline std::string
@@ -65,6 +69,9 @@ enum_to_string(OperatorType const enum_type)
     case OperatorType::InverseMassOperatorDstDst: string_type = "InverseMassOperatorDstDst";break;
     case OperatorType::VectorUpdate:              string_type = "VectorUpdate";             break;
     case OperatorType::EvaluateOperatorExplicit:  string_type = "EvaluateOperatorExplicit"; break;
+    case OperatorType::LowStorageRKStage:         string_type = "LowStorageRKStage";        break;
+    case OperatorType::SingleRateTimeStep:        string_type = "SingleRateTimeStep";       break;
+    case OperatorType::MultirateTimeStep:         string_type = "MultirateTimeStep";        break;
 
     default:AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
       // clang-format on
@@ -84,6 +91,9 @@ string_to_enum(OperatorType & enum_type, std::string const string_type)
   else if(string_type == "InverseMassOperatorDstDst") enum_type = OperatorType::InverseMassOperatorDstDst;
   else if(string_type == "VectorUpdate")              enum_type = OperatorType::VectorUpdate;
   else if(string_type == "EvaluateOperatorExplicit")  enum_type = OperatorType::EvaluateOperatorExplicit;
+  else if(string_type == "LowStorageRKStage")         enum_type = OperatorType::LowStorageRKStage;
+  else if(string_type == "SingleRateTimeStep")        enum_type = OperatorType::SingleRateTimeStep;
+  else if(string_type == "MultirateTimeStep")         enum_type = OperatorType::MultirateTimeStep;
   else AssertThrow(false, dealii::ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
 }
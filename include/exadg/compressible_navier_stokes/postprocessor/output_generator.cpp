@@ -39,15 +39,18 @@ write_output(OutputData const &                              output_data,
              VectorType const &                              solution_conserved,
              std::vector<SolutionField<dim, Number>> const & additional_fields,
              unsigned int const                              output_counter,
-             MPI_Comm const &                                mpi_comm)
+             double const                                    time,
+             MPI_Comm const &                                mpi_comm,
+             OutputPipeline *                                pipeline,
+             HDF5Output<dim> *                               hdf5_output)
 {
-  std::string folder = output_data.directory, file = output_data.filename;
-
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
 
-  dealii::DataOut<dim> data_out;
-  data_out.set_flags(flags);
+  auto data_out = std::make_shared<dealii::DataOut<dim>>();
+  data_out->set_flags(flags);
+
+  auto vectors = std::make_shared<OutputVectors<VectorType>>(pipeline != nullptr);
 
   // conserved variables
   std::vector<std::string> solution_names_conserved(dim + 2, "rho_u");
@@ -62,10 +65,10 @@ write_output(OutputData const &                              output_data,
   solution_component_interpretation[1 + dim] =
     dealii::DataComponentInterpretation::component_is_scalar;
 
-  data_out.add_data_vector(dof_handler,
-                           solution_conserved,
-                           solution_names_conserved,
-                           solution_component_interpretation);
+  data_out->add_data_vector(dof_handler,
+                            vectors->get(solution_conserved),
+                            solution_names_conserved,
+                            solution_component_interpretation);
 
   // additional solution fields
   for(typename std::vector<SolutionField<dim, Number>>::const_iterator it =
@@ -75,7 +78,7 @@ write_output(OutputData const &                              output_data,
   {
     if(it->type == SolutionFieldType::scalar)
     {
-      data_out.add_data_vector(*it->dof_handler, *it->vector, it->name);
+      data_out->add_data_vector(*it->dof_handler, vectors->get(*it->vector), it->name);
     }
     else if(it->type == SolutionFieldType::vector)
     {
@@ -84,7 +87,10 @@ write_output(OutputData const &                              output_data,
         component_interpretation(dim,
                                  dealii::DataComponentInterpretation::component_is_part_of_vector);
 
-      data_out.add_data_vector(*it->dof_handler, *it->vector, names, component_interpretation);
+      data_out->add_data_vector(*it->dof_handler,
+                                vectors->get(*it->vector),
+                                names,
+                                component_interpretation);
     }
     else
     {
@@ -92,9 +98,15 @@ write_output(OutputData const &                              output_data,
     }
   }
 
-  data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
-
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  build_patches_and_write(data_out,
+                          {vectors},
+                          mapping,
+                          output_data,
+                          output_counter,
+                          time,
+                          mpi_comm,
+                          pipeline,
+                          hdf5_output);
 }
 
 template<int dim, typename Number>
@@ -113,6 +125,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   mapping     = &mapping_in;
   output_data = output_data_in;
 
+  output_data.check();
+
   // reset output counter
   output_counter = output_data.start_counter;
 
@@ -120,6 +134,12 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   {
     create_directories(output_data.directory, mpi_comm);
 
+    if(output_data.asynchronous)
+      pipeline = std::make_shared<OutputPipeline>(output_data.max_pending_outputs);
+
+    if(output_data.write_hdf5)
+      hdf5_output = std::make_shared<HDF5Output<dim>>(mpi_comm);
+
     // Visualize boundary IDs:
     // since boundary IDs typically do not change during the simulation, we only do this
     // once at the beginning of the simulation (i.e., in the setup function).
@@ -200,7 +220,10 @@ OutputGenerator<dim, Number>::evaluate(
                                               solution_conserved,
                                               additional_fields,
                                               output_counter,
-                                              mpi_comm);
+                                              time,
+                                              mpi_comm,
+                                              pipeline.get(),
+                                              hdf5_output.get());
 
         ++output_counter;
       }
@@ -217,7 +240,10 @@ OutputGenerator<dim, Number>::evaluate(
                                             solution_conserved,
                                             additional_fields,
                                             output_counter,
-                                            mpi_comm);
+                                            time,
+                                            mpi_comm,
+                                            pipeline.get(),
+                                            hdf5_output.get());
 
       ++output_counter;
     }
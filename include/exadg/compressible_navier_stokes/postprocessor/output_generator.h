@@ -26,7 +26,9 @@
 #include <fstream>
 
 // ExaDG
+#include <exadg/postprocessor/hdf5_output.h>
 #include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/output_pipeline.h>
 #include <exadg/postprocessor/solution_field.h>
 
 namespace ExaDG
@@ -106,6 +108,9 @@ private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
   OutputData                                          output_data;
+
+  std::shared_ptr<OutputPipeline>  pipeline;
+  std::shared_ptr<HDF5Output<dim>> hdf5_output;
 };
 
 } // namespace CompNS
@@ -0,0 +1,302 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_PRECONDITIONERS_VISCOUS_PRECONDITIONER_H_
+#define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_PRECONDITIONERS_VISCOUS_PRECONDITIONER_H_
+
+// deal.II
+#include <deal.II/base/function.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/user_interface/boundary_descriptor.h>
+#include <exadg/convection_diffusion/preconditioners/multigrid_preconditioner.h>
+#include <exadg/grid/grid.h>
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/inverse_mass_operator.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+
+namespace ExaDG
+{
+namespace CompNS
+{
+/*
+ *  Preconditioner for the linearized implicit stage equation of IMEX Runge-Kutta methods
+ *
+ *    (M + scaling_factor * V') * delta_u = r ,
+ *
+ *  where V' denotes the Jacobian of the viscous operator. The coupling between the components
+ *  is neglected and the diagonal blocks are approximated by scalar Helmholtz-type operators
+ *
+ *    density:  M ,
+ *    momentum: M + scaling_factor * mu / rho_ref * L ,
+ *    energy:   M + scaling_factor * lambda / (c_v * rho_ref) * L ,
+ *
+ *  with the SIPG discretization L of the negative Laplace operator. The momentum and energy
+ *  blocks are inverted approximately by one V-cycle of the hybrid multigrid preconditioner of the
+ *  scalar convection-diffusion solver each, where Dirichlet boundary conditions are imposed on
+ *  those boundaries on which the velocity (momentum) or the energy (energy) is prescribed.
+ *
+ *  The multigrid operators are set up in the form (1/scaling_factor) * M + kappa * L so that
+ *  only the scaling factor of the mass operator has to be updated when the time step size
+ *  changes, see set_scaling_factor() and update().
+ */
+template<int dim, typename Number>
+class ViscousPreconditioner : public PreconditionerBase<Number>
+{
+private:
+  typedef typename PreconditionerBase<Number>::VectorType VectorType;
+
+  typedef ConvDiff::MultigridPreconditioner<dim, Number> Multigrid;
+
+  typedef CellIntegrator<dim, dim + 2, Number> CellIntegratorAll;
+  typedef CellIntegrator<dim, 1, Number>       CellIntegratorScalar;
+
+public:
+  ViscousPreconditioner(MPI_Comm const & mpi_comm_in)
+    : matrix_free(nullptr),
+      dof_index_all(0),
+      dof_index_scalar(0),
+      quad_index(0),
+      scaling_factor(1.0),
+      mpi_comm(mpi_comm_in)
+  {
+  }
+
+  void
+  initialize(MultigridData const &                     mg_data,
+             dealii::MatrixFree<dim, Number> const &   matrix_free_in,
+             dealii::AffineConstraints<Number> const & constraint,
+             unsigned int const                        dof_index_all_in,
+             unsigned int const                        dof_index_scalar_in,
+             unsigned int const                        quad_index_in,
+             Grid<dim> const &                         grid,
+             BoundaryDescriptor<dim> const &           boundary_descriptor,
+             double const                              IP_factor,
+             double const                              diffusivity_momentum,
+             double const                              diffusivity_energy)
+  {
+    matrix_free      = &matrix_free_in;
+    dof_index_all    = dof_index_all_in;
+    dof_index_scalar = dof_index_scalar_in;
+    quad_index       = quad_index_in;
+
+    inverse_mass_scalar.initialize(*matrix_free, dof_index_scalar, quad_index);
+
+    // boundary conditions of the scalar problems (only homogeneous data is needed)
+    zero_function = std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+
+    auto const set_boundary_conditions =
+      [&](std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> & bc,
+          BoundaryDescriptorStd<dim> const &                   bc_compressible) {
+        bc = std::make_shared<ConvDiff::BoundaryDescriptor<dim>>();
+        for(auto const & boundary_id : grid.triangulation->get_boundary_ids())
+        {
+          if(bc_compressible.dirichlet_bc.find(boundary_id) != bc_compressible.dirichlet_bc.end())
+            bc->dirichlet_bc.insert({boundary_id, zero_function});
+          else if(bc_compressible.neumann_bc.find(boundary_id) != bc_compressible.neumann_bc.end())
+            bc->neumann_bc.insert({boundary_id, zero_function});
+        }
+      };
+
+    set_boundary_conditions(bc_momentum, boundary_descriptor.velocity);
+    set_boundary_conditions(bc_energy, boundary_descriptor.energy);
+
+    initialize_multigrid(multigrid_momentum,
+                         operator_momentum,
+                         bc_momentum,
+                         diffusivity_momentum,
+                         IP_factor,
+                         mg_data,
+                         constraint,
+                         grid);
+
+    initialize_multigrid(multigrid_energy,
+                         operator_energy,
+                         bc_energy,
+                         diffusivity_energy,
+                         IP_factor,
+                         mg_data,
+                         constraint,
+                         grid);
+
+    src_components.resize(dim + 2);
+    dst_components.resize(dim + 2);
+    for(unsigned int c = 0; c < dim + 2; ++c)
+    {
+      matrix_free->initialize_dof_vector(src_components[c], dof_index_scalar);
+      matrix_free->initialize_dof_vector(dst_components[c], dof_index_scalar);
+    }
+  }
+
+  /*
+   * Sets the factor in front of the viscous operator. The multigrid preconditioners are only
+   * updated when calling update().
+   */
+  void
+  set_scaling_factor(double const scaling_factor_in)
+  {
+    scaling_factor = scaling_factor_in;
+
+    operator_momentum.set_scaling_factor_mass_operator(1.0 / scaling_factor);
+    operator_energy.set_scaling_factor_mass_operator(1.0 / scaling_factor);
+  }
+
+  void
+  update() override
+  {
+    multigrid_momentum->update();
+    multigrid_energy->update();
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const override
+  {
+    extract_components(src_components, src);
+
+    // density: mass matrix
+    inverse_mass_scalar.apply(dst_components[0], src_components[0]);
+
+    // momentum and energy: scalar Helmholtz problems
+    for(unsigned int c = 1; c < dim + 2; ++c)
+    {
+      if(c < dim + 1)
+        multigrid_momentum->vmult(dst_components[c], src_components[c]);
+      else
+        multigrid_energy->vmult(dst_components[c], src_components[c]);
+
+      dst_components[c] *= 1.0 / scaling_factor;
+    }
+
+    insert_components(dst, dst_components);
+  }
+
+private:
+  void
+  initialize_multigrid(std::shared_ptr<Multigrid> &                               multigrid,
+                       ConvDiff::CombinedOperator<dim, Number> &                  pde_operator,
+                       std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> const & bc,
+                       double const                                               diffusivity,
+                       double const                                               IP_factor,
+                       MultigridData const &                                      mg_data,
+                       dealii::AffineConstraints<Number> const &                  constraint,
+                       Grid<dim> const &                                          grid)
+  {
+    ConvDiff::CombinedOperatorData<dim> data;
+    data.unsteady_problem                  = true;
+    data.convective_problem                = false;
+    data.diffusive_problem                 = true;
+    data.diffusive_kernel_data.IP_factor   = IP_factor;
+    data.diffusive_kernel_data.diffusivity = diffusivity;
+    data.bc                                = bc;
+    data.dof_index                         = dof_index_scalar;
+    data.quad_index                        = quad_index;
+
+    pde_operator.initialize(*matrix_free, constraint, data);
+    pde_operator.set_scaling_factor_mass_operator(1.0 / scaling_factor);
+
+    multigrid = std::make_shared<Multigrid>(mpi_comm);
+    multigrid->initialize(mg_data,
+                          grid.triangulation.get(),
+                          matrix_free->get_dof_handler(dof_index_scalar).get_fe(),
+                          grid.mapping,
+                          pde_operator,
+                          ConvDiff::MultigridOperatorType::ReactionDiffusion,
+                          false /* mesh_is_moving */,
+                          bc->dirichlet_bc,
+                          grid.periodic_faces);
+  }
+
+  // copy the components of a vector with dim + 2 components to dim + 2 scalar vectors
+  void
+  extract_components(std::vector<VectorType> & dst, VectorType const & src) const
+  {
+    CellIntegratorAll    integrator(*matrix_free, dof_index_all, quad_index);
+    CellIntegratorScalar integrator_scalar(*matrix_free, dof_index_scalar, quad_index);
+
+    unsigned int const dofs_per_component = integrator_scalar.dofs_per_cell;
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src);
+
+      integrator_scalar.reinit(cell);
+      for(unsigned int c = 0; c < dim + 2; ++c)
+      {
+        for(unsigned int i = 0; i < dofs_per_component; ++i)
+          integrator_scalar.begin_dof_values()[i] =
+            integrator.begin_dof_values()[c * dofs_per_component + i];
+
+        integrator_scalar.set_dof_values(dst[c]);
+      }
+    }
+  }
+
+  // inverse operation of extract_components()
+  void
+  insert_components(VectorType & dst, std::vector<VectorType> const & src) const
+  {
+    CellIntegratorAll    integrator(*matrix_free, dof_index_all, quad_index);
+    CellIntegratorScalar integrator_scalar(*matrix_free, dof_index_scalar, quad_index);
+
+    unsigned int const dofs_per_component = integrator_scalar.dofs_per_cell;
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      integrator_scalar.reinit(cell);
+      integrator.reinit(cell);
+      for(unsigned int c = 0; c < dim + 2; ++c)
+      {
+        integrator_scalar.read_dof_values(src[c]);
+
+        for(unsigned int i = 0; i < dofs_per_component; ++i)
+          integrator.begin_dof_values()[c * dofs_per_component + i] =
+            integrator_scalar.begin_dof_values()[i];
+      }
+
+      integrator.set_dof_values(dst);
+    }
+  }
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int dof_index_all, dof_index_scalar, quad_index;
+
+  double scaling_factor;
+
+  InverseMassOperator<dim, 1, Number> inverse_mass_scalar;
+
+  std::shared_ptr<dealii::Function<dim>>             zero_function;
+  std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> bc_momentum, bc_energy;
+
+  ConvDiff::CombinedOperator<dim, Number> operator_momentum, operator_energy;
+
+  std::shared_ptr<Multigrid> multigrid_momentum, multigrid_energy;
+
+  mutable std::vector<VectorType> src_components, dst_components;
+
+  MPI_Comm const mpi_comm;
+};
+
+} // namespace CompNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_PRECONDITIONERS_VISCOUS_PRECONDITIONER_H_ */
@@ -126,6 +126,9 @@ main(int argc, char ** argv)
   ExaDG::SpatialResolutionParameters  spatial(input_file);
   ExaDG::TemporalResolutionParameters temporal(input_file);
 
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
+
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
   {
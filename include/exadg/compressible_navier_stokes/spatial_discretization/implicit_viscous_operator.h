@@ -0,0 +1,192 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_IMPLICIT_VISCOUS_OPERATOR_H_
+#define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_IMPLICIT_VISCOUS_OPERATOR_H_
+
+// C/C++
+#include <limits>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+
+namespace ExaDG
+{
+namespace CompNS
+{
+/*
+ *  Implicit stage equation of IMEX Runge-Kutta methods with implicit treatment of the viscous
+ *  term, written in weak form: find u such that
+ *
+ *    R(u) = M u + scaling_factor * V(u, t) - rhs = 0 ,
+ *
+ *  where V denotes the viscous operator (with the viscous term on the left-hand side) and
+ *  rhs = M r the mass-weighted explicitly known part of the stage solution.
+ */
+template<int dim, typename Number>
+class NonlinearViscousOperator
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  NonlinearViscousOperator()
+    : mass_operator(nullptr),
+      viscous_operator(nullptr),
+      rhs_vector(nullptr),
+      time(0.0),
+      scaling_factor(1.0)
+  {
+  }
+
+  void
+  initialize(MassOperator<dim, Number> const &    mass_operator_in,
+             ViscousOperator<dim, Number> const & viscous_operator_in)
+  {
+    mass_operator    = &mass_operator_in;
+    viscous_operator = &viscous_operator_in;
+  }
+
+  void
+  update(VectorType const & rhs_vector_in, double const time_in, double const scaling_factor_in)
+  {
+    rhs_vector     = &rhs_vector_in;
+    time           = time_in;
+    scaling_factor = scaling_factor_in;
+  }
+
+  // Newton solver: evaluate residual
+  void
+  evaluate_residual(VectorType & dst, VectorType const & src) const
+  {
+    viscous_operator->evaluate(dst, src, time);
+    dst *= scaling_factor;
+    mass_operator->apply_add(dst, src);
+    dst.add(-1.0, *rhs_vector);
+  }
+
+private:
+  MassOperator<dim, Number> const *    mass_operator;
+  ViscousOperator<dim, Number> const * viscous_operator;
+
+  VectorType const * rhs_vector;
+
+  double time;
+  double scaling_factor;
+};
+
+/*
+ *  Linearization of NonlinearViscousOperator, J = M + scaling_factor * V'(u_lin), in a
+ *  Jacobian-free manner: the directional derivative of the viscous operator is approximated by a
+ *  finite difference
+ *
+ *    V'(u_lin) * v ~ (V(u_lin + epsilon * v) - V(u_lin)) / epsilon ,
+ *
+ *  where V(u_lin) is computed once per linearization point and epsilon is chosen relative to the
+ *  norms of u_lin and v. Inhomogeneous boundary data cancels in the difference.
+ */
+template<int dim, typename Number>
+class LinearizedViscousOperator
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  LinearizedViscousOperator()
+    : mass_operator(nullptr),
+      viscous_operator(nullptr),
+      time(0.0),
+      scaling_factor(1.0),
+      norm_linearization(0.0)
+  {
+  }
+
+  void
+  initialize(MassOperator<dim, Number> const &    mass_operator_in,
+             ViscousOperator<dim, Number> const & viscous_operator_in)
+  {
+    mass_operator    = &mass_operator_in;
+    viscous_operator = &viscous_operator_in;
+  }
+
+  void
+  update(double const time_in, double const scaling_factor_in)
+  {
+    time           = time_in;
+    scaling_factor = scaling_factor_in;
+  }
+
+  // Newton solver: set linearization point
+  void
+  set_solution_linearization(VectorType const & solution)
+  {
+    solution_linearization = solution;
+    norm_linearization     = solution_linearization.l2_norm();
+
+    viscous_linearization.reinit(solution_linearization, true);
+    viscous_operator->evaluate(viscous_linearization, solution_linearization, time);
+
+    solution_perturbed.reinit(solution_linearization, true);
+  }
+
+  // linear solver: apply linearized operator
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    double const norm_src = src.l2_norm();
+
+    if(norm_src == 0.0)
+    {
+      dst = 0.0;
+      return;
+    }
+
+    double const epsilon =
+      std::sqrt(std::numeric_limits<Number>::epsilon()) * (1.0 + norm_linearization) / norm_src;
+
+    solution_perturbed = solution_linearization;
+    solution_perturbed.add(epsilon, src);
+
+    viscous_operator->evaluate(dst, solution_perturbed, time);
+    dst.add(-1.0, viscous_linearization);
+    dst *= scaling_factor / epsilon;
+
+    mass_operator->apply_add(dst, src);
+  }
+
+private:
+  MassOperator<dim, Number> const *    mass_operator;
+  ViscousOperator<dim, Number> const * viscous_operator;
+
+  double time;
+  double scaling_factor;
+
+  VectorType solution_linearization, viscous_linearization;
+  double     norm_linearization;
+
+  mutable VectorType solution_perturbed;
+};
+
+} // namespace CompNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_IMPLICIT_VISCOUS_OPERATOR_H_ \
+        */
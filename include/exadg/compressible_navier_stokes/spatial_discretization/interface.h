@@ -22,8 +22,12 @@
 #ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/time_integration/restart.h>
+
 namespace ExaDG
 {
 namespace CompNS
@@ -64,9 +68,56 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // explicit time integration: evaluate operator, followed by a fused inverse mass + register
+  // update of a stage of a low-storage Runge-Kutta method with two registers
+  virtual void
+  evaluate_low_storage_rk_stage(VectorType &       next_ri,
+                                VectorType &       solution,
+                                VectorType &       vec_ki,
+                                VectorType const & current_ri,
+                                Number const       factor_solution,
+                                Number const       factor_ai,
+                                bool const         update_next_ri,
+                                Number const       evaluation_time) const = 0;
+
+  // multirate time integration: evaluate operator for the step size classes first, ..., last
+  virtual void
+  evaluate_step_size_classes(VectorType &       dst,
+                             VectorType const & src,
+                             Number const       evaluation_time,
+                             unsigned int const first_class,
+                             unsigned int const last_class) const = 0;
+
+  // IMEX time integration: evaluate explicitly treated part of operator (convective term and body
+  // force)
+  virtual void
+  evaluate_explicit_part(VectorType &       dst,
+                         VectorType const & src,
+                         Number const       evaluation_time) const = 0;
+
+  // IMEX time integration: evaluate implicitly treated part of operator (viscous term)
+  virtual void
+  evaluate_implicit_part(VectorType &       dst,
+                         VectorType const & src,
+                         Number const       evaluation_time) const = 0;
+
+  // IMEX time integration: solve dst - scaling_factor * (implicit part)(dst) = rhs
+  virtual std::tuple<unsigned int, unsigned int>
+  solve_implicit_part(VectorType &       dst,
+                      VectorType const & rhs,
+                      Number const       evaluation_time,
+                      Number const       scaling_factor) = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
+
+  // restart: write/read dof vector to/from a restart file shared by all processes
+  virtual void
+  write_restart_vector(CollectiveRestartFile & file, VectorType const & vector) const = 0;
+
+  virtual void
+  read_restart_vector(CollectiveRestartFile & file, VectorType & vector) const = 0;
 };
 
 } // namespace Interface
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_KERNELS_AND_OPERATORS_H_
 
 // C/C++
+#include <functional>
 #include <iostream>
 
 // deal.II
@@ -33,6 +34,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/step_size_classes.h>
 #include <exadg/operators/interior_penalty_parameter.h>
 
 namespace ExaDG
@@ -312,7 +314,7 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  BodyForceOperator() : matrix_free(nullptr), eval_time(0.0)
+  BodyForceOperator() : matrix_free(nullptr), step_size_classes(nullptr), eval_time(0.0)
   {
   }
 
@@ -339,6 +341,13 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  // restricts the loops to the step size classes selected in step_size_classes
+  void
+  set_step_size_classes(StepSizeClasses<dim, Number> const & step_size_classes_in)
+  {
+    step_size_classes = &step_size_classes_in;
+  }
+
   inline DEAL_II_ALWAYS_INLINE //
     std::tuple<scalar, vector, scalar>
     get_volume_flux(CellIntegratorScalar & density,
@@ -370,6 +379,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(step_size_classes != nullptr && !step_size_classes->cell_batch_is_selected(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, false);
 
@@ -395,6 +407,8 @@ private:
 
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
+  StepSizeClasses<dim, Number> const * step_size_classes;
+
   BodyForceOperatorData<dim> data;
 
   double mutable eval_time;
@@ -521,7 +535,7 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  ConvectiveOperator() : matrix_free(nullptr)
+  ConvectiveOperator() : matrix_free(nullptr), step_size_classes(nullptr)
   {
   }
 
@@ -553,6 +567,13 @@ public:
       &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
   }
 
+  // restricts the loops to the step size classes selected in step_size_classes
+  void
+  set_step_size_classes(StepSizeClasses<dim, Number> const & step_size_classes_in)
+  {
+    step_size_classes = &step_size_classes_in;
+  }
+
   void
   set_evaluation_time(double const & evaluation_time) const
   {
@@ -751,6 +772,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(step_size_classes != nullptr && !step_size_classes->cell_batch_is_selected(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, false);
 
@@ -792,6 +816,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(step_size_classes != nullptr && !step_size_classes->face_batch_is_selected(face))
+        continue;
+
       // density
       density_m.reinit(face);
       density_m.gather_evaluate(src, true, false);
@@ -831,6 +858,17 @@ private:
         energy_p.submit_value(-std::get<2>(flux), q);
       }
 
+      // mask the faces of the face batch that do not belong to the selected classes
+      if(step_size_classes != nullptr)
+      {
+        step_size_classes->mask_face_batch(face, density_m, true, false);
+        step_size_classes->mask_face_batch(face, density_p, true, false);
+        step_size_classes->mask_face_batch(face, momentum_m, true, false);
+        step_size_classes->mask_face_batch(face, momentum_p, true, false);
+        step_size_classes->mask_face_batch(face, energy_m, true, false);
+        step_size_classes->mask_face_batch(face, energy_p, true, false);
+      }
+
       density_m.integrate_scatter(true, false, dst);
       density_p.integrate_scatter(true, false, dst);
 
@@ -854,6 +892,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(step_size_classes != nullptr && !step_size_classes->face_batch_is_selected(face))
+        continue;
+
       density.reinit(face);
       density.gather_evaluate(src, true, false);
 
@@ -890,6 +931,14 @@ private:
         energy.submit_value(std::get<2>(flux), q);
       }
 
+      // mask the faces of the face batch that do not belong to the selected classes
+      if(step_size_classes != nullptr)
+      {
+        step_size_classes->mask_face_batch(face, density, true, false);
+        step_size_classes->mask_face_batch(face, momentum, true, false);
+        step_size_classes->mask_face_batch(face, energy, true, false);
+      }
+
       density.integrate_scatter(true, false, dst);
       momentum.integrate_scatter(true, false, dst);
       energy.integrate_scatter(true, false, dst);
@@ -898,6 +947,8 @@ private:
 
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
+  StepSizeClasses<dim, Number> const * step_size_classes;
+
   ConvectiveOperatorData<dim> data;
 
   // heat capacity ratio
@@ -960,7 +1011,7 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  ViscousOperator() : matrix_free(nullptr), degree(1)
+  ViscousOperator() : matrix_free(nullptr), step_size_classes(nullptr), degree(1)
   {
   }
 
@@ -1002,6 +1053,13 @@ public:
       &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
   }
 
+  // restricts the loops to the step size classes selected in step_size_classes
+  void
+  set_step_size_classes(StepSizeClasses<dim, Number> const & step_size_classes_in)
+  {
+    step_size_classes = &step_size_classes_in;
+  }
+
   void
   set_evaluation_time(double const & evaluation_time) const
   {
@@ -1425,6 +1483,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(step_size_classes != nullptr && !step_size_classes->cell_batch_is_selected(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, true);
 
@@ -1464,6 +1525,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(step_size_classes != nullptr && !step_size_classes->face_batch_is_selected(face))
+        continue;
+
       // density
       density_m.reinit(face);
       density_m.gather_evaluate(src, true, true);
@@ -1516,6 +1580,17 @@ private:
         energy_p.submit_value(std::get<2>(gradient_flux), q);
       }
 
+      // mask the faces of the face batch that do not belong to the selected classes
+      if(step_size_classes != nullptr)
+      {
+        step_size_classes->mask_face_batch(face, density_m, true, false);
+        step_size_classes->mask_face_batch(face, density_p, true, false);
+        step_size_classes->mask_face_batch(face, momentum_m, true, true);
+        step_size_classes->mask_face_batch(face, momentum_p, true, true);
+        step_size_classes->mask_face_batch(face, energy_m, true, true);
+        step_size_classes->mask_face_batch(face, energy_p, true, true);
+      }
+
       density_m.integrate_scatter(true, false, dst);
       density_p.integrate_scatter(true, false, dst);
 
@@ -1539,6 +1614,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(step_size_classes != nullptr && !step_size_classes->face_batch_is_selected(face))
+        continue;
+
       density.reinit(face);
       density.gather_evaluate(src, true, true);
 
@@ -1592,6 +1670,14 @@ private:
         energy.submit_value(-std::get<2>(gradient_flux), q);
       }
 
+      // mask the faces of the face batch that do not belong to the selected classes
+      if(step_size_classes != nullptr)
+      {
+        step_size_classes->mask_face_batch(face, density, true, false);
+        step_size_classes->mask_face_batch(face, momentum, true, true);
+        step_size_classes->mask_face_batch(face, energy, true, true);
+      }
+
       density.integrate_scatter(true, false, dst);
       momentum.integrate_scatter(true, true, dst);
       energy.integrate_scatter(true, true, dst);
@@ -1600,6 +1686,8 @@ private:
 
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
+  StepSizeClasses<dim, Number> const * step_size_classes;
+
   ViscousOperatorData<dim> data;
 
   unsigned int degree;
@@ -1660,7 +1748,11 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  CombinedOperator() : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr)
+  CombinedOperator()
+    : matrix_free(nullptr),
+      step_size_classes(nullptr),
+      convective_operator(nullptr),
+      viscous_operator(nullptr)
   {
   }
 
@@ -1697,6 +1789,45 @@ public:
     //    matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Same as evaluate(), but operation_after_loop is executed on subranges [begin, end) of the
+   * locally owned degrees of freedom once the loop has finished with them, see MatrixFree::loop().
+   */
+  void
+  evaluate(VectorType &                                                        dst,
+           VectorType const &                                                  src,
+           Number const                                                        evaluation_time,
+           std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const
+  {
+    convective_operator->set_evaluation_time(evaluation_time);
+    viscous_operator->set_evaluation_time(evaluation_time);
+
+    // dst is set to zero range by range before the loop accesses it
+    auto const operation_before_loop = [&](unsigned int const begin, unsigned int const end) {
+      Number * const dst_ptr = dst.begin();
+      for(unsigned int i = begin; i < end; ++i)
+        dst_ptr[i] = Number(0.0);
+    };
+
+    matrix_free->loop(&This::cell_loop,
+                      &This::face_loop,
+                      &This::boundary_face_loop,
+                      this,
+                      dst,
+                      src,
+                      operation_before_loop,
+                      operation_after_loop,
+                      data.dof_index);
+  }
+
+  // restricts the loops to the step size classes selected in step_size_classes
+  void
+  set_step_size_classes(StepSizeClasses<dim, Number> const & step_size_classes_in)
+  {
+    step_size_classes = &step_size_classes_in;
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
@@ -1710,6 +1841,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(step_size_classes != nullptr && !step_size_classes->cell_batch_is_selected(cell))
+        continue;
+
       density.reinit(cell);
       density.gather_evaluate(src, true, true);
 
@@ -1753,6 +1887,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(step_size_classes != nullptr && !step_size_classes->face_batch_is_selected(face))
+        continue;
+
       // density
       density_m.reinit(face);
       density_m.gather_evaluate(src, true, true);
@@ -1809,6 +1946,17 @@ private:
         energy_p.submit_gradient(std::get<5>(visc_value_flux), q);
       }
 
+      // mask the faces of the face batch that do not belong to the selected classes
+      if(step_size_classes != nullptr)
+      {
+        step_size_classes->mask_face_batch(face, density_m, true, false);
+        step_size_classes->mask_face_batch(face, density_p, true, false);
+        step_size_classes->mask_face_batch(face, momentum_m, true, true);
+        step_size_classes->mask_face_batch(face, momentum_p, true, true);
+        step_size_classes->mask_face_batch(face, energy_m, true, true);
+        step_size_classes->mask_face_batch(face, energy_p, true, true);
+      }
+
       density_m.integrate_scatter(true, false, dst);
       density_p.integrate_scatter(true, false, dst);
 
@@ -1832,6 +1980,9 @@ private:
 
     for(unsigned int face = face_range.first; face < face_range.second; face++)
     {
+      if(step_size_classes != nullptr && !step_size_classes->face_batch_is_selected(face))
+        continue;
+
       density.reinit(face);
       density.gather_evaluate(src, true, true);
 
@@ -1898,6 +2049,14 @@ private:
         energy.submit_gradient(std::get<2>(visc_value_flux), q);
       }
 
+      // mask the faces of the face batch that do not belong to the selected classes
+      if(step_size_classes != nullptr)
+      {
+        step_size_classes->mask_face_batch(face, density, true, false);
+        step_size_classes->mask_face_batch(face, momentum, true, true);
+        step_size_classes->mask_face_batch(face, energy, true, true);
+      }
+
       density.integrate_scatter(true, false, dst);
       momentum.integrate_scatter(true, true, dst);
       energy.integrate_scatter(true, true, dst);
@@ -1906,6 +2065,8 @@ private:
 
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
+  StepSizeClasses<dim, Number> const * step_size_classes;
+
   CombinedOperatorData<dim> data;
 
   ConvectiveOperator<dim, Number> const * convective_operator;
@@ -25,6 +25,7 @@
 
 // ExaDG
 #include <exadg/compressible_navier_stokes/spatial_discretization/operator.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
@@ -54,6 +55,7 @@ Operator<dim, Number>::Operator(
     dof_handler_vector(*grid_in->triangulation),
     dof_handler_scalar(*grid_in->triangulation),
     mpi_comm(mpi_comm_in),
+    scaling_factor_preconditioner(0.0),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
     wall_time_operator_evaluation(0.0)
 {
@@ -131,6 +133,14 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
   // perform setup of data structures that depend on matrix-free object
   setup_operators();
 
+  // setup solver for the implicit stages of IMEX schemes
+  if(param.viscous_term_is_implicit())
+  {
+    initialize_preconditioner_viscous();
+
+    initialize_solver_viscous();
+  }
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -206,6 +216,181 @@ Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number
   wall_time_operator_evaluation += timer.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_low_storage_rk_stage(VectorType &       next_ri,
+                                                     VectorType &       solution,
+                                                     VectorType &       vec_ki,
+                                                     VectorType const & current_ri,
+                                                     Number const       factor_solution,
+                                                     Number const       factor_ai,
+                                                     bool const         update_next_ri,
+                                                     Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  if(param.use_combined_operator == true && param.right_hand_side == false &&
+     inverse_mass_all.low_storage_rk_stage_can_be_fused())
+  {
+    // The inverse mass operator and the vector updates are performed on each cell batch as soon as
+    // the combined operator has finished with it, i.e., within the same loop. The viscous and
+    // convective terms are shifted to the right-hand side by the scaling factor -1.
+    combined_operator.evaluate(vec_ki,
+                               current_ri,
+                               time,
+                               inverse_mass_all.get_low_storage_rk_stage_update_after_loop(
+                                 next_ri,
+                                 solution,
+                                 vec_ki,
+                                 -1.0,
+                                 factor_solution,
+                                 factor_ai,
+                                 update_next_ri));
+  }
+  else
+  {
+    evaluate_convective_and_viscous(vec_ki, current_ri, time);
+
+    // The viscous and convective terms are shifted to the right-hand side of the equation. Without
+    // body force, this is done by the scaling factor of the inverse mass operator.
+    Number scaling = -1.0;
+
+    // body force term
+    if(param.right_hand_side == true)
+    {
+      vec_ki *= -1.0;
+      body_force_operator.evaluate_add(vec_ki, current_ri, time);
+      scaling = 1.0;
+    }
+
+    // apply inverse mass operator and perform vector updates
+    inverse_mass_all.apply_and_update_low_storage_rk_stage(
+      next_ri, solution, vec_ki, scaling, factor_solution, factor_ai, update_next_ri);
+  }
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_step_size_classes(VectorType &       dst,
+                                                  VectorType const & src,
+                                                  Number const       time,
+                                                  unsigned int const first_class,
+                                                  unsigned int const last_class) const
+{
+  AssertThrow(param.temporal_discretization == TemporalDiscretization::ExplRK2Multirate,
+              dealii::ExcMessage("Step size classes are only set up for multirate time stepping."));
+
+  dealii::Timer timer;
+  timer.restart();
+
+  step_size_classes.select_classes(first_class, last_class);
+
+  evaluate_convective_and_viscous(dst, src, time);
+
+  // shift viscous and convective terms to the right-hand side of the equation
+  dst *= -1.0;
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add(dst, src, time);
+  }
+
+  // apply inverse mass operator on those cells where dst is non-zero
+  inverse_mass_all.apply_selected(dst, dst, [&](unsigned int const cell) {
+    return step_size_classes.cell_batch_is_touched(cell);
+  });
+
+  step_size_classes.select_all_classes();
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_explicit_part(VectorType &       dst,
+                                              VectorType const & src,
+                                              Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  convective_operator.evaluate(dst, src, time);
+
+  // shift convective term to the right-hand side of the equation
+  dst *= -1.0;
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add(dst, src, time);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_implicit_part(VectorType &       dst,
+                                              VectorType const & src,
+                                              Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  viscous_operator.evaluate(dst, src, time);
+
+  // shift viscous term to the right-hand side of the equation
+  dst *= -1.0;
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+std::tuple<unsigned int, unsigned int>
+Operator<dim, Number>::solve_implicit_part(VectorType &       dst,
+                                           VectorType const & rhs,
+                                           Number const       time,
+                                           Number const       scaling_factor)
+{
+  AssertThrow(param.viscous_term_is_implicit(),
+              dealii::ExcMessage("The implicit solver is only set up for IMEX schemes."));
+
+  // the equation is solved in weak form, i.e., multiplied by the mass matrix
+  mass_operator.apply(rhs_implicit, rhs);
+
+  nonlinear_viscous_operator.update(rhs_implicit, time, scaling_factor);
+  linearized_viscous_operator.update(time, scaling_factor);
+
+  // The preconditioner only depends on the scaling factor, i.e., on the time step size, and is
+  // updated in the first Newton iteration after the time step size has changed.
+  Newton::UpdateData update;
+  update.do_update             = (scaling_factor != scaling_factor_preconditioner);
+  update.threshold_newton_iter = std::numeric_limits<unsigned int>::max();
+
+  if(update.do_update)
+  {
+    if(param.preconditioner_viscous == PreconditionerViscous::Multigrid)
+    {
+      std::dynamic_pointer_cast<ViscousPreconditioner<dim, Number>>(preconditioner_viscous)
+        ->set_scaling_factor(scaling_factor);
+    }
+
+    scaling_factor_preconditioner = scaling_factor;
+  }
+
+  return newton_solver_viscous->solve(dst, update);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_convective(VectorType &       dst,
@@ -408,6 +593,21 @@ Operator<dim, Number>::get_wall_time_operator_evaluation() const
   return wall_time_operator_evaluation;
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::write_restart_vector(CollectiveRestartFile & file,
+                                            VectorType const &      vector) const
+{
+  file.write_vector(vector, dof_handler);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::read_restart_vector(CollectiveRestartFile & file, VectorType & vector) const
+{
+  file.read_vector(vector, dof_handler);
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::calculate_minimum_element_length() const
@@ -479,6 +679,7 @@ Operator<dim, Number>::setup_operators()
 
   // inverse mass operator
   inverse_mass_all.initialize(*matrix_free, get_dof_index_all(), get_quad_index_standard());
+  inverse_mass_all.initialize_low_storage_rk_stage_after_loop();
   inverse_mass_vector.initialize(*matrix_free, get_dof_index_vector(), get_quad_index_standard());
   inverse_mass_scalar.initialize(*matrix_free, get_dof_index_scalar(), get_quad_index_standard());
 
@@ -530,6 +731,26 @@ Operator<dim, Number>::setup_operators()
                                  viscous_operator);
   }
 
+  // step size classes of multirate time integration
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK2Multirate)
+  {
+    std::vector<unsigned int> const cell_classes =
+      calculate_step_size_classes(*grid->triangulation, param.n_step_size_classes, mpi_comm);
+
+    step_size_classes.initialize(*matrix_free,
+                                 get_dof_index_all(),
+                                 param.n_step_size_classes,
+                                 cell_classes);
+
+    step_size_classes.print_statistics(pcout, cell_classes, *grid->triangulation, mpi_comm);
+
+    body_force_operator.set_step_size_classes(step_size_classes);
+    convective_operator.set_step_size_classes(step_size_classes);
+    viscous_operator.set_step_size_classes(step_size_classes);
+    if(param.use_combined_operator == true)
+      combined_operator.set_step_size_classes(step_size_classes);
+  }
+
   // calculators
   p_u_T_calculator.initialize(*matrix_free,
                               get_dof_index_all(),
@@ -547,6 +768,86 @@ Operator<dim, Number>::setup_operators()
                                    get_quad_index_standard());
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_preconditioner_viscous()
+{
+  if(param.preconditioner_viscous == PreconditionerViscous::InverseMassMatrix)
+  {
+    preconditioner_viscous =
+      std::make_shared<InverseMassPreconditioner<dim, dim + 2, Number>>(*matrix_free,
+                                                                        get_dof_index_all(),
+                                                                        get_quad_index_standard());
+  }
+  else if(param.preconditioner_viscous == PreconditionerViscous::Multigrid)
+  {
+    std::shared_ptr<ViscousPreconditioner<dim, Number>> preconditioner =
+      std::make_shared<ViscousPreconditioner<dim, Number>>(mpi_comm);
+
+    // diffusivities of the scalar approximations of the momentum and energy equations
+    double const specific_heat_constant_volume =
+      param.specific_gas_constant / (param.heat_capacity_ratio - 1.0);
+    double const diffusivity_momentum = param.dynamic_viscosity / param.reference_density;
+    double const diffusivity_energy =
+      param.thermal_conductivity / (specific_heat_constant_volume * param.reference_density);
+
+    preconditioner->initialize(param.multigrid_data_viscous,
+                               *matrix_free,
+                               constraint,
+                               get_dof_index_all(),
+                               get_dof_index_scalar(),
+                               get_quad_index_standard(),
+                               *grid,
+                               *boundary_descriptor,
+                               param.IP_factor,
+                               diffusivity_momentum,
+                               diffusivity_energy);
+
+    preconditioner_viscous = preconditioner;
+  }
+  else
+  {
+    AssertThrow(param.preconditioner_viscous == PreconditionerViscous::None,
+                dealii::ExcMessage("Specified preconditioner is not implemented!"));
+  }
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_solver_viscous()
+{
+  initialize_dof_vector(rhs_implicit);
+
+  nonlinear_viscous_operator.initialize(mass_operator, viscous_operator);
+  linearized_viscous_operator.initialize(mass_operator, viscous_operator);
+
+  typedef NonlinearViscousOperator<dim, Number>  NonlinearOperator;
+  typedef LinearizedViscousOperator<dim, Number> LinearOperator;
+  typedef Krylov::SolverBase<VectorType>         LinearSolver;
+
+  // linear solver
+  Krylov::SolverDataGMRES solver_data;
+  solver_data.solver_tolerance_abs = param.solver_data_viscous.abs_tol;
+  solver_data.solver_tolerance_rel = param.solver_data_viscous.rel_tol;
+  solver_data.max_iter             = param.solver_data_viscous.max_iter;
+  solver_data.max_n_tmp_vectors    = param.solver_data_viscous.max_krylov_size;
+
+  if(param.preconditioner_viscous != PreconditionerViscous::None)
+    solver_data.use_preconditioner = true;
+
+  linear_solver_viscous =
+    std::make_shared<Krylov::SolverGMRES<LinearOperator, PreconditionerBase<Number>, VectorType>>(
+      linearized_viscous_operator, *preconditioner_viscous, solver_data, mpi_comm);
+
+  // Newton solver
+  newton_solver_viscous =
+    std::make_shared<Newton::Solver<VectorType, NonlinearOperator, LinearOperator, LinearSolver>>(
+      param.newton_solver_data_viscous,
+      nonlinear_viscous_operator,
+      linearized_viscous_operator,
+      *linear_solver_viscous);
+}
+
 template class Operator<2, float>;
 template class Operator<2, double>;
 
@@ -28,7 +28,9 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/compressible_navier_stokes/preconditioners/viscous_preconditioner.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/calculators.h>
+#include <exadg/compressible_navier_stokes/spatial_discretization/implicit_viscous_operator.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/interface.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
 #include <exadg/compressible_navier_stokes/user_interface/boundary_descriptor.h>
@@ -36,7 +38,10 @@
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/grid/grid.h>
 #include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/matrix_free/step_size_classes.h>
 #include <exadg/operators/inverse_mass_operator.h>
+#include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
 
 namespace ExaDG
 {
@@ -90,6 +95,72 @@ public:
   void
   evaluate(VectorType & dst, VectorType const & src, Number const time) const;
 
+  /*
+   *  Stage of a low-storage Runge-Kutta method with two registers with fused inverse mass +
+   *  register update: the right-hand side is evaluated for current_ri (with vec_ki used as
+   *  temporary vector), and the inverse mass operator is applied together with the vector updates
+   *
+   *    next_ri  = solution + factor_ai * k_i ,
+   *    solution = solution + factor_solution * k_i ,
+   *
+   *  where k_i denotes the result of evaluate(). For the combined operator without body force,
+   *  this is done on each cell batch within the loop of the combined operator once the loop has
+   *  finished with the cell batch. Otherwise, it is done in a separate loop over all cells. This
+   *  avoids separate sweeps through the vectors for the scaling by -1, the inverse mass operator,
+   *  and the vector updates. The vectors next_ri and current_ri may be the same vector.
+   */
+  void
+  evaluate_low_storage_rk_stage(VectorType &       next_ri,
+                                VectorType &       solution,
+                                VectorType &       vec_ki,
+                                VectorType const & current_ri,
+                                Number const       factor_solution,
+                                Number const       factor_ai,
+                                bool const         update_next_ri,
+                                Number const       time) const;
+
+  /*
+   *  This function is used in case of multirate time integration: Same as evaluate(), but only
+   *  the contributions of the step size classes first_class, ..., last_class are evaluated, see
+   *  StepSizeClasses. The result is zero on all cells not touched by these classes.
+   */
+  void
+  evaluate_step_size_classes(VectorType &       dst,
+                             VectorType const & src,
+                             Number const       time,
+                             unsigned int const first_class,
+                             unsigned int const last_class) const;
+
+  /*
+   *  This function is used in case of IMEX time integration: The convective term and the body
+   *  force term are treated explicitly, i.e., this function is the same as evaluate() but
+   *  without the viscous term.
+   */
+  void
+  evaluate_explicit_part(VectorType & dst, VectorType const & src, Number const time) const;
+
+  /*
+   *  This function is used in case of IMEX time integration: The viscous term is treated
+   *  implicitly, i.e., this function evaluates the viscous term (multiplied by -1.0) and applies
+   *  the inverse mass operator.
+   */
+  void
+  evaluate_implicit_part(VectorType & dst, VectorType const & src, Number const time) const;
+
+  /*
+   *  This function is used in case of IMEX time integration: Solves the implicit stage equation
+   *
+   *    dst + scaling_factor * M^{-1} V(dst) = rhs
+   *
+   *  with the viscous operator V by a Jacobian-free Newton-Krylov method, where dst contains the
+   *  initial guess. Returns the number of Newton iterations and accumulated linear iterations.
+   */
+  std::tuple<unsigned int, unsigned int>
+  solve_implicit_part(VectorType &       dst,
+                      VectorType const & rhs,
+                      Number const       time,
+                      Number const       scaling_factor);
+
   void
   evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const;
 
@@ -155,6 +226,13 @@ public:
   double
   get_wall_time_operator_evaluation() const;
 
+  // restart: write/read dof vector to/from a restart file shared by all processes
+  void
+  write_restart_vector(CollectiveRestartFile & file, VectorType const & vector) const;
+
+  void
+  read_restart_vector(CollectiveRestartFile & file, VectorType & vector) const;
+
   // global CFL criterion: calculates the time step size for a given global maximum velocity
   double
   calculate_time_step_cfl_global() const;
@@ -173,6 +251,12 @@ private:
   void
   setup_operators();
 
+  void
+  initialize_preconditioner_viscous();
+
+  void
+  initialize_solver_viscous();
+
   unsigned int
   get_dof_index_all() const;
 
@@ -260,6 +344,33 @@ private:
   InverseMassOperator<dim, dim, Number>     inverse_mass_vector;
   InverseMassOperator<dim, 1, Number>       inverse_mass_scalar;
 
+  /*
+   * Step size classes of multirate time integration.
+   */
+  StepSizeClasses<dim, Number> step_size_classes;
+
+  /*
+   * Solution of the implicit stages of IMEX time integration.
+   */
+  NonlinearViscousOperator<dim, Number>  nonlinear_viscous_operator;
+  LinearizedViscousOperator<dim, Number> linearized_viscous_operator;
+
+  std::shared_ptr<PreconditionerBase<Number>> preconditioner_viscous;
+
+  std::shared_ptr<Krylov::SolverBase<VectorType>> linear_solver_viscous;
+
+  std::shared_ptr<Newton::Solver<VectorType,
+                                 NonlinearViscousOperator<dim, Number>,
+                                 LinearizedViscousOperator<dim, Number>,
+                                 Krylov::SolverBase<VectorType>>>
+    newton_solver_viscous;
+
+  // mass-weighted right-hand side of the implicit stage equation
+  VectorType rhs_implicit;
+
+  // scaling factor of the viscous term for which the preconditioner has been updated
+  Number scaling_factor_preconditioner;
+
   // L2 projections to calculate derived quantities
   p_u_T_Calculator<dim, Number>     p_u_T_calculator;
   VorticityCalculator<dim, Number>  vorticity_calculator;
@@ -142,6 +142,9 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
   ExaDG::ThroughputParameters          throughput(input_file);
 
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
+
   // fill resolution vector depending on the operator_type
   resolution.fill_resolution_vector(&ExaDG::CompNS::get_dofs_per_element, input_file);
 
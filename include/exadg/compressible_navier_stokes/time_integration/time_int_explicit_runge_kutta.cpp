@@ -41,13 +41,15 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.end_time,
                               param_in.max_number_of_time_steps,
                               param_in.restart_data,
-                              false, // currently no adaptive time stepping implemented
+                              false, // currently no CFL-based adaptive time stepping implemented
                               mpi_comm_in,
                               is_test_in),
     pde_operator(operator_in),
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
     postprocessor(postprocessor_in),
+    iterations_newton({0, 0}),
+    iterations_linear({0, 0}),
     l2_norm(0.0),
     cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
     diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time))
@@ -59,20 +61,53 @@ void
 TimeIntExplRK<Number>::initialize_time_integrator()
 {
   // initialize Runge-Kutta time integrator
-  if(this->param.temporal_discretization == TemporalDiscretization::ExplRK)
+  if(this->param.embedded_error_control.active)
+  {
+    // embedded error control requires the low-storage schemes with embedded weights
+    if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Embedded<Operator, VectorType>>(pde_operator, 3, 4);
+    }
+    else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Embedded<Operator, VectorType>>(pde_operator, 4, 5);
+    }
+    else if(this->param.temporal_discretization == TemporalDiscretization::IMEXRK3Stage4)
+    {
+      rk_time_integrator = std::make_shared<IMEXRungeKutta<Operator, VectorType>>(pde_operator, 3);
+    }
+    else if(this->param.temporal_discretization == TemporalDiscretization::IMEXRK4Stage6)
+    {
+      rk_time_integrator = std::make_shared<IMEXRungeKutta<Operator, VectorType>>(pde_operator, 4);
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage("Embedded error control is not available for the specified "
+                                     "time integration scheme."));
+    }
+
+    this->error_controller =
+      std::make_shared<PIController>(param.embedded_error_control,
+                                     rk_time_integrator->get_order_embedded_scheme());
+  }
+  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK)
   {
     rk_time_integrator = std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
       param.order_time_integrator, pde_operator);
   }
+  // The low-storage schemes with two registers use the fused stage evaluation of the operator.
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
   {
     rk_time_integrator =
-      std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(pde_operator);
+      std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(pde_operator, 3, 4);
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
   {
     rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(pde_operator);
+      std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(pde_operator, 4, 5);
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
   {
@@ -82,7 +117,7 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
   {
     rk_time_integrator =
-      std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(pde_operator);
+      std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(pde_operator, 5, 9);
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
   {
@@ -98,6 +133,19 @@ TimeIntExplRK<Number>::initialize_time_integrator()
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK2Multirate)
+  {
+    rk_time_integrator =
+      std::make_shared<MultirateRK2<Operator, VectorType>>(pde_operator, param.n_step_size_classes);
+  }
+  else if(this->param.temporal_discretization == TemporalDiscretization::IMEXRK3Stage4)
+  {
+    rk_time_integrator = std::make_shared<IMEXRungeKutta<Operator, VectorType>>(pde_operator, 3);
+  }
+  else if(this->param.temporal_discretization == TemporalDiscretization::IMEXRK4Stage6)
+  {
+    rk_time_integrator = std::make_shared<IMEXRungeKutta<Operator, VectorType>>(pde_operator, 4);
+  }
 }
 
 /*
@@ -191,6 +239,18 @@ TimeIntExplRK<Number>::calculate_time_step_size()
     AssertThrow(false,
                 dealii::ExcMessage("Specified type of time step calculation is not implemented."));
   }
+
+  // The time step size calculated above refers to the finest step size class, while the multirate
+  // scheme advances the coarsest class with the full (macro) time step size.
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK2Multirate)
+  {
+    this->time_step *= std::pow(2.0, param.n_step_size_classes - 1);
+
+    this->time_step =
+      adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+
+    print_parameter(this->pcout, "Time step size (multirate)", this->time_step);
+  }
 }
 
 template<typename Number>
@@ -241,18 +301,84 @@ TimeIntExplRK<Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(this->error_controller)
+  {
+    this->time_step_proposed = this->time_step;
+
+    // the time step size is set to the size of the accepted time step
+    this->time_step = do_timestep_with_error_control(
+      this->solution_np,
+      this->solution_n,
+      this->error_estimate,
+      this->time,
+      this->time_step_proposed,
+      *this->error_controller,
+      [&](VectorType & dst, VectorType & src, VectorType & error, double const t, double const dt) {
+        rk_time_integrator->solve_timestep_with_error_estimate(dst, src, error, t, dt);
+      });
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
-  if(print_solver_info() and not(this->is_test))
+  if(param.viscous_term_is_implicit())
   {
-    this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
-    print_wall_time(this->pcout, timer.wall_time());
+    std::shared_ptr<IMEXRungeKutta<Operator, VectorType>> imex_time_integrator =
+      std::dynamic_pointer_cast<IMEXRungeKutta<Operator, VectorType>>(rk_time_integrator);
+
+    auto const iter = imex_time_integrator->get_iterations();
+
+    iterations_newton.first += 1;
+    iterations_newton.second += std::get<0>(iter);
+    iterations_linear.first += 1;
+    iterations_linear.second += std::get<1>(iter);
+
+    if(print_solver_info() and not(this->is_test))
+    {
+      this->pcout << std::endl
+                  << "Solve compressible Navier-Stokes equations (viscous term implicitly):";
+      print_solver_info_nonlinear(this->pcout,
+                                  std::get<0>(iter),
+                                  std::get<1>(iter),
+                                  timer.wall_time());
+
+      if(this->error_controller)
+        print_parameter(this->pcout, "Time step size", this->time_step);
+    }
+
+    this->timer_tree->insert({"Timeloop", "Solve-IMEX"}, timer.wall_time());
   }
+  else
+  {
+    if(print_solver_info() and not(this->is_test))
+    {
+      this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
+      print_wall_time(this->pcout, timer.wall_time());
+
+      if(this->error_controller)
+        print_parameter(this->pcout, "Time step size", this->time_step);
+    }
+
+    this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
+  }
+}
 
-  this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
+template<typename Number>
+void
+TimeIntExplRK<Number>::write_restart_vectors(CollectiveRestartFile & file) const
+{
+  pde_operator->write_restart_vector(file, this->solution_n);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::read_restart_vectors(CollectiveRestartFile & file)
+{
+  pde_operator->read_restart_vector(file, this->solution_n);
 }
 
 template<typename Number>
@@ -264,6 +390,22 @@ TimeIntExplRK<Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<typename Number>
+void
+TimeIntExplRK<Number>::print_iterations() const
+{
+  std::vector<std::string> names = {"Viscous (nonlinear)", "Viscous (linear accumulated)"};
+
+  std::vector<double> iterations_avg;
+  iterations_avg.resize(2);
+  iterations_avg[0] =
+    (double)iterations_newton.second / std::max(1., (double)iterations_newton.first);
+  iterations_avg[1] =
+    (double)iterations_linear.second / std::max(1., (double)iterations_linear.first);
+
+  print_list_of_iterations(this->pcout, names, iterations_avg);
+}
+
 // instantiations
 template class TimeIntExplRK<float>;
 template class TimeIntExplRK<double>;
@@ -28,6 +28,8 @@
 
 // ExaDG
 #include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/imex_runge_kutta.h>
+#include <exadg/time_integration/multirate_runge_kutta.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -64,6 +66,10 @@ public:
   void
   get_wall_times(std::vector<std::string> & name, std::vector<double> & wall_time) const;
 
+  // IMEX schemes: print average number of iterations of the implicit solver per time step
+  void
+  print_iterations() const;
+
 private:
   void
   initialize_time_integrator();
@@ -86,6 +92,12 @@ private:
   bool
   print_solver_info() const;
 
+  void
+  write_restart_vectors(CollectiveRestartFile & file) const final;
+
+  void
+  read_restart_vectors(CollectiveRestartFile & file) final;
+
   void
   calculate_time_step_size();
 
@@ -117,6 +129,10 @@ private:
 
   std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
 
+  // IMEX schemes: number of Newton iterations and accumulated linear iterations
+  std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations_newton;
+  std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations_linear;
+
   // monitor the L2-norm of the solution vector in order to detect instabilities
   mutable double l2_norm;
 
@@ -87,6 +87,15 @@ enum_to_string(TemporalDiscretization const enum_type)
     case TemporalDiscretization::SSPRK:
       string_type = "SSPRK";
       break;
+    case TemporalDiscretization::ExplRK2Multirate:
+      string_type = "ExplRK2Multirate";
+      break;
+    case TemporalDiscretization::IMEXRK3Stage4:
+      string_type = "IMEXRK3Stage4";
+      break;
+    case TemporalDiscretization::IMEXRK4Stage6:
+      string_type = "IMEXRK4Stage6";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -151,5 +160,30 @@ enum_to_string(QuadratureRule const enum_type)
   return string_type;
 }
 
+
+std::string
+enum_to_string(PreconditionerViscous const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case PreconditionerViscous::None:
+      string_type = "None";
+      break;
+    case PreconditionerViscous::InverseMassMatrix:
+      string_type = "InverseMassMatrix";
+      break;
+    case PreconditionerViscous::Multigrid:
+      string_type = "Multigrid";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
 } // namespace CompNS
 } // namespace ExaDG
@@ -78,6 +78,8 @@ enum class EnergyBoundaryVariable
  *  Temporal discretization method:
  *
  *    Explicit Runge-Kutta methods
+ *
+ *    IMEX Runge-Kutta methods with implicit treatment of the viscous term
  */
 enum class TemporalDiscretization
 {
@@ -89,7 +91,10 @@ enum class TemporalDiscretization
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
   ExplRK5Stage9Reg2S,
-  SSPRK // specify order and stages of time integration scheme
+  SSPRK,            // specify order and stages of time integration scheme
+  ExplRK2Multirate, // multirate scheme of order 2, specify number of step size classes
+  IMEXRK3Stage4,    // additive Runge-Kutta scheme ARK3(2)4L[2]SA
+  IMEXRK4Stage6     // additive Runge-Kutta scheme ARK4(3)6L[2]SA
 };
 
 std::string
@@ -136,6 +141,18 @@ enum_to_string(QuadratureRule const enum_type);
 /*                                                                                    */
 /**************************************************************************************/
 
+/*
+ *  Preconditioner for the linearized implicit stages of IMEX Runge-Kutta methods
+ */
+enum class PreconditionerViscous
+{
+  None,
+  InverseMassMatrix,
+  Multigrid
+};
+
+std::string
+enum_to_string(PreconditionerViscous const enum_type);
 
 
 /**************************************************************************************/
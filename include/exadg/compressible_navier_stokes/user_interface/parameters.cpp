@@ -49,6 +49,7 @@ Parameters::Parameters()
     temporal_discretization(TemporalDiscretization::Undefined),
     order_time_integrator(1),
     stages(1),
+    n_step_size_classes(1),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     time_step_size(-1.),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
@@ -58,6 +59,7 @@ Parameters::Parameters()
     diffusion_number(-1.),
     exponent_fe_degree_cfl(2.0),
     exponent_fe_degree_viscous(4.0),
+    embedded_error_control(EmbeddedErrorControlData()),
     // restart
     restarted_simulation(false),
     restart_data(RestartData()),
@@ -74,6 +76,12 @@ Parameters::Parameters()
     // viscous term
     IP_factor(1.0),
 
+    // SOLVER
+    newton_solver_data_viscous(Newton::SolverData(1e2, 1.e-12, 1.e-6)),
+    solver_data_viscous(SolverData(1e3, 1.e-12, 1.e-6, 30)),
+    preconditioner_viscous(PreconditionerViscous::Multigrid),
+    multigrid_data_viscous(MultigridData()),
+
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
     use_combined_operator(false)
@@ -113,6 +121,12 @@ Parameters::check() const
     AssertThrow(stages >= 1, dealii::ExcMessage("Specify number of RK stages!"));
   }
 
+  if(temporal_discretization == TemporalDiscretization::ExplRK2Multirate)
+  {
+    AssertThrow(n_step_size_classes >= 1 && n_step_size_classes <= 32,
+                dealii::ExcMessage("Number of step size classes has to be in [1,32]."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, dealii::ExcMessage("Invalid parameter max_velocity."));
@@ -120,6 +134,29 @@ Parameters::check() const
     AssertThrow(diffusion_number > 0.0, dealii::ExcMessage("parameter must be defined"));
   }
 
+  if(embedded_error_control.active)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C ||
+                  viscous_term_is_implicit(),
+                dealii::ExcMessage(
+                  "Embedded error control is only implemented for ExplRK3Stage4Reg2C, "
+                  "ExplRK4Stage5Reg2C, and the IMEX schemes."));
+  }
+
+  if(viscous_term_is_implicit())
+  {
+    AssertThrow(equation_type == EquationType::NavierStokes,
+                dealii::ExcMessage("IMEX schemes require a viscous term."));
+
+    // the time step size of IMEX schemes is not restricted by the viscous term
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::UserSpecified ||
+                  calculation_of_time_step_size == TimeStepCalculation::CFL,
+                dealii::ExcMessage(
+                  "Use TimeStepCalculation::UserSpecified or TimeStepCalculation::CFL for IMEX "
+                  "schemes."));
+  }
+
 
   // SPATIAL DISCRETIZATION
   grid.check();
@@ -137,6 +174,13 @@ Parameters::check() const
   // NUMERICAL PARAMETERS
 }
 
+bool
+Parameters::viscous_term_is_implicit() const
+{
+  return (temporal_discretization == TemporalDiscretization::IMEXRK3Stage4 ||
+          temporal_discretization == TemporalDiscretization::IMEXRK4Stage6);
+}
+
 
 void
 Parameters::print(dealii::ConditionalOStream const & pcout, std::string const & name) const
@@ -156,8 +200,9 @@ Parameters::print(dealii::ConditionalOStream const & pcout, std::string const &
   print_parameters_spatial_discretization(pcout);
 
   // SOLVER
-  // If a system of equations has to be solved (currently not used)
-  print_parameters_solver(pcout);
+  // If a system of equations has to be solved
+  if(viscous_term_is_implicit())
+    print_parameters_solver(pcout);
 
   // NUMERICAL PARAMETERS
   print_parameters_numerical_parameters(pcout);
@@ -205,6 +250,11 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Number of stages", stages);
   }
 
+  if(temporal_discretization == TemporalDiscretization::ExplRK2Multirate)
+  {
+    print_parameter(pcout, "Number of step size classes", n_step_size_classes);
+  }
+
   print_parameter(pcout,
                   "Calculation of time step size",
                   enum_to_string(calculation_of_time_step_size));
@@ -214,6 +264,7 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   print_parameter(pcout, "Temporal refinements", n_refine_time);
 
+  embedded_error_control.print(pcout);
 
   // here we do not print quantities such as cfl_number, diffusion_number, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -242,12 +293,27 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 }
 
 void
-Parameters::print_parameters_solver(dealii::ConditionalOStream const & /*pcout*/) const
+Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) const
 {
-  /*
-  pcout << std::endl
-        << "Solver:" << std::endl;
-  */
+  pcout << std::endl << "Solver:" << std::endl;
+
+  // implicit viscous term
+  pcout << std::endl << "  Viscous term:" << std::endl;
+
+  pcout << "  Newton solver:" << std::endl;
+
+  newton_solver_data_viscous.print(pcout);
+
+  pcout << std::endl << "  Linear solver:" << std::endl;
+
+  print_parameter(pcout, "Solver", "GMRES");
+
+  solver_data_viscous.print(pcout);
+
+  print_parameter(pcout, "Preconditioner", enum_to_string(preconditioner_viscous));
+
+  if(preconditioner_viscous == PreconditionerViscous::Multigrid)
+    multigrid_data_viscous.print(pcout);
 }
 
 void
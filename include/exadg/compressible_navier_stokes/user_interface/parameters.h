@@ -24,6 +24,10 @@
 #include <exadg/compressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/grid/enum_types.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
+#include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
+#include <exadg/time_integration/embedded_error_control.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 #include <exadg/utilities/print_functions.h>
@@ -44,6 +48,10 @@ public:
   void
   print(dealii::ConditionalOStream const & pcout, std::string const & name) const;
 
+  // returns true for IMEX schemes, which treat the viscous term implicitly
+  bool
+  viscous_term_is_implicit() const;
+
 private:
   void
   print_parameters_mathematical_model(dealii::ConditionalOStream const & pcout) const;
@@ -122,6 +130,12 @@ public:
   // number of Runge-Kutta stages
   unsigned int stages;
 
+  // number of step size classes of the multirate scheme ExplRK2Multirate: the cells are grouped
+  // into classes according to their size, and class c is advanced with 2^c times the time step
+  // size of the finest cells. The time step size calculated according to
+  // calculation_of_time_step_size refers to the finest class.
+  unsigned int n_step_size_classes;
+
   // calculation of time step size
   TimeStepCalculation calculation_of_time_step_size;
 
@@ -152,6 +166,12 @@ public:
   // exponent of fe_degree used in the calculation of the diffusion time step size
   double exponent_fe_degree_viscous;
 
+  // adaptive time stepping based on the error estimate of an embedded Runge-Kutta scheme, where
+  // the time step size calculated according to calculation_of_time_step_size is only used for the
+  // first time step (only available for ExplRK3Stage4Reg2C, ExplRK4Stage5Reg2C, and the IMEX
+  // schemes)
+  EmbeddedErrorControlData embedded_error_control;
+
   // set this variable to true to start the simulation from restart files
   bool restarted_simulation;
 
@@ -179,6 +199,27 @@ public:
   // interior penalty parameter scaling factor: default value is 1.0
   double IP_factor;
 
+  /**************************************************************************************/
+  /*                                                                                    */
+  /*                                       SOLVER                                       */
+  /*                                                                                    */
+  /**************************************************************************************/
+
+  // The following parameters are only relevant for IMEX schemes, which solve a nonlinear system
+  // of equations M u + dt * gamma * V(u) = M r for the viscous operator V in each stage.
+
+  // Newton solver data (the linearized problem is solved with GMRES in a Jacobian-free manner)
+  Newton::SolverData newton_solver_data_viscous;
+
+  // solver data of the linearized problem
+  SolverData solver_data_viscous;
+
+  // description: see enum declaration
+  PreconditionerViscous preconditioner_viscous;
+
+  // description: see declaration of MultigridData
+  MultigridData multigrid_data_viscous;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                NUMERICAL PARAMETERS                                */
@@ -244,6 +244,18 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_bdf =
       std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
     time_integrator_bdf->print_iterations();
+
+    // accepted and rejected sub-steps in case of OIF sub-stepping with embedded error control
+    time_integrator_bdf->print_error_control_statistics_oif();
+  }
+
+  // accepted and rejected time steps in case of embedded error control
+  if(application->get_parameters().problem_type == ProblemType::Unsteady &&
+     application->get_parameters().temporal_discretization == TemporalDiscretization::ExplRK)
+  {
+    std::shared_ptr<TimeIntExplRK<Number>> time_integrator_rk =
+      std::dynamic_pointer_cast<TimeIntExplRK<Number>>(time_integrator);
+    time_integrator_rk->print_error_control_statistics();
   }
 
   // wall times
@@ -0,0 +1,314 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/convection_diffusion/driver_parareal.h>
+#include <exadg/matrix_free/categorization.h>
+#include <exadg/time_integration/time_step_calculation.h>
+#include <exadg/utilities/print_functions.h>
+#include <exadg/utilities/print_general_infos.h>
+#include <exadg/utilities/print_solver_results.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+template<int dim, typename Number>
+DriverParareal<dim, Number>::DriverParareal(
+  MPI_Comm const &                              space,
+  MPI_Comm const &                              time,
+  std::shared_ptr<ApplicationBase<dim, Number>> app,
+  PararealParameters const &                    parareal_parameters,
+  bool const                                    is_test)
+  : comm_space(space),
+    comm_time(time),
+    pcout(std::cout,
+          dealii::Utilities::MPI::this_mpi_process(comm_space) == 0 and
+            dealii::Utilities::MPI::this_mpi_process(comm_time) == 0),
+    is_test(is_test),
+    application(app),
+    parareal_parameters(parareal_parameters),
+    start_time(0.0),
+    end_time(0.0),
+    n_time_steps_fine(0),
+    n_time_steps_coarse(0),
+    preconditioner_coarse(false)
+{
+  print_general_info<Number>(pcout, comm_space, is_test);
+}
+
+template<int dim, typename Number>
+void
+DriverParareal<dim, Number>::setup()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  pcout << std::endl << "Setting up scalar convection-diffusion solver (Parareal):" << std::endl;
+
+  application->setup();
+
+  Parameters const & param = application->get_parameters();
+
+  AssertThrow(param.problem_type == ProblemType::Unsteady and
+                param.temporal_discretization == TemporalDiscretization::BDF,
+              dealii::ExcMessage("Parareal is only implemented for BDF time integration."));
+  AssertThrow(param.ale_formulation == false and param.adaptive_time_stepping == false and
+                param.restarted_simulation == false,
+              dealii::ExcMessage("Parareal does not support ALE, adaptive time stepping, and "
+                                 "restarted simulations."));
+  AssertThrow(param.get_type_velocity_field() != TypeVelocityField::DoFVector or
+                param.analytical_velocity_field,
+              dealii::ExcMessage("Parareal requires an analytical velocity field."));
+
+  // time slab of the current process
+  unsigned int const slab    = dealii::Utilities::MPI::this_mpi_process(comm_time);
+  unsigned int const n_slabs = dealii::Utilities::MPI::n_mpi_processes(comm_time);
+
+  double const slab_length = (param.end_time - param.start_time) / n_slabs;
+
+  start_time = param.start_time + slab * slab_length;
+  end_time   = (slab + 1 == n_slabs) ? param.end_time : start_time + slab_length;
+
+  set_parameters_propagator(param_fine, 1.0);
+  set_parameters_propagator(param_coarse, parareal_parameters.coarsening_factor_time);
+
+  pcout << std::endl << "Parareal:" << std::endl << std::endl;
+  print_parameter(pcout, "Number of time slabs", n_slabs);
+  print_parameter(pcout, "Coarsening factor time", parareal_parameters.coarsening_factor_time);
+  print_parameter(pcout, "Maximum number of iterations", parareal_parameters.max_iterations);
+  print_parameter(pcout, "Tolerance", parareal_parameters.tolerance);
+
+  // initialize convection-diffusion operator
+  pde_operator = std::make_shared<Operator<dim, Number>>(application->get_grid(),
+                                                         nullptr /* grid_motion */,
+                                                         application->get_boundary_descriptor(),
+                                                         application->get_field_functions(),
+                                                         param,
+                                                         "scalar",
+                                                         comm_space);
+
+  // initialize matrix_free
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data->append(pde_operator);
+
+  matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
+  if(param.use_cell_based_face_loops)
+    Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
+                                        matrix_free_data->data);
+  matrix_free->reinit(*application->get_grid()->mapping,
+                      matrix_free_data->get_dof_handler_vector(),
+                      matrix_free_data->get_constraint_vector(),
+                      matrix_free_data->get_quadrature_vector(),
+                      matrix_free_data->data);
+
+  // setup convection-diffusion operator
+  pde_operator->setup(matrix_free, matrix_free_data);
+
+  // initialize postprocessors
+  postprocessor = application->create_postprocessor();
+  postprocessor->setup(*pde_operator, *application->get_grid()->mapping);
+
+  postprocessor_parareal = std::make_shared<PostProcessorParareal<Number>>();
+
+  // setup solver with the time step size of the fine propagator
+  time_integrator_fine = std::make_shared<TimeIntBDF<dim, Number>>(
+    pde_operator, param_fine, comm_space, is_test, postprocessor_parareal);
+  time_integrator_fine->setup(false);
+
+  VectorType const * velocity_ptr = nullptr;
+  VectorType         velocity;
+
+  if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    pde_operator->initialize_dof_vector_velocity(velocity);
+    pde_operator->interpolate_velocity(velocity, start_time);
+    velocity_ptr = &velocity;
+  }
+
+  pde_operator->setup_solver(time_integrator_fine->get_scaling_factor_time_derivative_term(),
+                             velocity_ptr);
+
+  parareal = std::make_shared<Parareal<Number>>(parareal_parameters, comm_space, comm_time);
+
+  timer_tree.insert({"Convection-diffusion", "Setup"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+DriverParareal<dim, Number>::set_parameters_propagator(Parameters & param,
+                                                       double const factor) const
+{
+  param = application->get_parameters();
+
+  param.start_time = start_time;
+  param.end_time   = end_time;
+
+  // The solution at former instants of time is not available at the start of a time slab, except
+  // for the initial condition on the first time slab.
+  if(start_time > application->get_parameters().start_time)
+    param.start_with_low_order = true;
+
+  param.restart_data.write_restart = false;
+
+  if(param.calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+  {
+    // make sure that the end of the time slab is hit exactly
+    double const time_step_size =
+      calculate_const_time_step(param.time_step_size, param.n_refine_time);
+
+    param.time_step_size =
+      adjust_time_step_to_hit_end_time(start_time, end_time, factor * time_step_size);
+    param.n_refine_time = 0;
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::CFL)
+  {
+    // the time step size is adjusted to the time slab by the time integrator
+    param.cfl *= factor;
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::MaxEfficiency)
+  {
+    param.c_eff *= factor;
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+void
+DriverParareal<dim, Number>::propagate(VectorType &                                    dst,
+                                       VectorType const &                              src,
+                                       bool const                                      coarse,
+                                       std::shared_ptr<PostProcessorInterface<Number>> pp)
+{
+  Parameters & param = coarse ? param_coarse : param_fine;
+
+  // reset the state of the solver info data of the previous propagation
+  param.solver_info_data = application->get_parameters().solver_info_data;
+
+  std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator =
+    std::make_shared<TimeIntBDF<dim, Number>>(pde_operator, param, comm_space, is_test, pp);
+
+  time_integrator->set_initial_solution(src);
+  time_integrator->setup(false);
+
+  // the preconditioner has been set up for the time step size of the other propagator
+  if(coarse != preconditioner_coarse)
+  {
+    time_integrator->force_preconditioner_update();
+    preconditioner_coarse = coarse;
+  }
+
+  time_integrator->timeloop();
+
+  dst = time_integrator->get_solution();
+
+  if(coarse)
+  {
+    n_time_steps_coarse += time_integrator->get_number_of_time_steps();
+  }
+  else
+  {
+    n_time_steps_fine += time_integrator->get_number_of_time_steps();
+    time_integrator_fine = time_integrator;
+  }
+}
+
+template<int dim, typename Number>
+void
+DriverParareal<dim, Number>::solve()
+{
+  VectorType solution_start, solution_end;
+  pde_operator->initialize_dof_vector(solution_start);
+  pde_operator->initialize_dof_vector(solution_end);
+
+  // the initial condition is only needed on the first time slab
+  pde_operator->prescribe_initial_conditions(solution_start, start_time);
+
+  parareal->solve(
+    solution_start,
+    solution_end,
+    [&](VectorType & dst, VectorType const & src) {
+      propagate(dst, src, true /* coarse */, postprocessor_parareal);
+    },
+    [&](VectorType & dst, VectorType const & src) {
+      propagate(dst, src, false /* coarse */, postprocessor_parareal);
+    },
+    [&](VectorType & dst, VectorType const & src) {
+      propagate(dst, src, false /* coarse */, postprocessor);
+    });
+}
+
+template<int dim, typename Number>
+void
+DriverParareal<dim, Number>::print_performance_results(double const total_time) const
+{
+  this->pcout << std::endl
+              << "_________________________________________________________________________________"
+              << std::endl
+              << std::endl;
+
+  this->pcout << "Performance results for convection-diffusion solver (Parareal):" << std::endl;
+
+  this->pcout << std::endl;
+  print_parameter(pcout, "Number of Parareal iterations", parareal->get_number_of_iterations());
+  print_parameter(pcout, "Number of time steps fine propagator", n_time_steps_fine);
+  print_parameter(pcout, "Number of time steps coarse propagator", n_time_steps_coarse);
+
+  this->pcout << std::endl << "Average number of iterations (final fine propagator):" << std::endl;
+  time_integrator_fine->print_iterations();
+
+  // wall times
+  timer_tree.insert({"Convection-diffusion"}, total_time);
+
+  timer_tree.insert({"Convection-diffusion"}, parareal->get_timings());
+
+  pcout << std::endl << "Timings for level 1:" << std::endl;
+  timer_tree.print_level(pcout, 1);
+
+  pcout << std::endl << "Timings for level 2:" << std::endl;
+  timer_tree.print_level(pcout, 2);
+
+  // computational costs in CPUh of all time slabs
+  unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(comm_space) *
+                                       dealii::Utilities::MPI::n_mpi_processes(comm_time);
+
+  dealii::Utilities::MPI::MinMaxAvg overall_time_data =
+    dealii::Utilities::MPI::min_max_avg(total_time, comm_space);
+  double const overall_time_avg = overall_time_data.avg;
+
+  print_costs(pcout, overall_time_avg, N_mpi_processes);
+
+  this->pcout << "_________________________________________________________________________________"
+              << std::endl
+              << std::endl;
+}
+
+template class DriverParareal<2, float>;
+template class DriverParareal<3, float>;
+
+template class DriverParareal<2, double>;
+template class DriverParareal<3, double>;
+
+} // namespace ConvDiff
+} // namespace ExaDG
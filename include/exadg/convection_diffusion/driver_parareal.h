@@ -0,0 +1,150 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_CONVECTION_DIFFUSION_DRIVER_PARAREAL_H_
+#define INCLUDE_EXADG_CONVECTION_DIFFUSION_DRIVER_PARAREAL_H_
+
+// ExaDG
+#include <exadg/convection_diffusion/postprocessor/postprocessor_base.h>
+#include <exadg/convection_diffusion/spatial_discretization/operator.h>
+#include <exadg/convection_diffusion/time_integration/time_int_bdf.h>
+#include <exadg/convection_diffusion/user_interface/application_base.h>
+#include <exadg/convection_diffusion/user_interface/parameters.h>
+#include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/time_integration/parareal.h>
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+/*
+ * Postprocessor of the propagators during the Parareal iterations, where the solution within the
+ * time slabs has not converged yet.
+ */
+template<typename Number>
+class PostProcessorParareal : public PostProcessorInterface<Number>
+{
+public:
+  typedef typename PostProcessorInterface<Number>::VectorType VectorType;
+
+  void
+  do_postprocessing(VectorType const &, double const, int const) final
+  {
+  }
+};
+
+/*
+ * Driver for the parallel-in-time solution of unsteady problems with the Parareal algorithm. The
+ * time interval is decomposed into time slabs, each of which is solved by a group of processes
+ * (comm_space). The fine propagator is the BDF time integrator with the time step size specified
+ * by the application and the coarse propagator is the same BDF time integrator with a time step
+ * size larger by the coarsening factor. The postprocessing is done by the fine propagator as soon
+ * as the solution at the start of the time slab is final.
+ */
+template<int dim, typename Number = double>
+class DriverParareal
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  DriverParareal(MPI_Comm const &                              comm_space,
+                 MPI_Comm const &                              comm_time,
+                 std::shared_ptr<ApplicationBase<dim, Number>> application,
+                 PararealParameters const &                    parareal_parameters,
+                 bool const                                    is_test);
+
+  void
+  setup();
+
+  void
+  solve();
+
+  void
+  print_performance_results(double const total_time) const;
+
+private:
+  /*
+   * Sets the parameters of a propagator over the time slab of the current process, where the time
+   * step size is larger by the given factor than the time step size of the application.
+   */
+  void
+  set_parameters_propagator(Parameters & param, double const factor) const;
+
+  /*
+   * Integrates from the start to the end of the time slab with the fine or the coarse propagator.
+   */
+  void
+  propagate(VectorType &                                    dst,
+            VectorType const &                              src,
+            bool const                                      coarse,
+            std::shared_ptr<PostProcessorInterface<Number>> pp);
+
+  // MPI communicators in space (processes of one time slab) and time (connecting time slabs)
+  MPI_Comm const comm_space;
+  MPI_Comm const comm_time;
+
+  // output to std::cout
+  dealii::ConditionalOStream pcout;
+
+  // do not print wall times if is_test
+  bool const is_test;
+
+  // application
+  std::shared_ptr<ApplicationBase<dim, Number>> application;
+
+  PararealParameters const parareal_parameters;
+
+  // start and end time of the time slab of the current process
+  double start_time, end_time;
+
+  // parameters of fine and coarse propagator
+  Parameters param_fine, param_coarse;
+
+  std::shared_ptr<MatrixFreeData<dim, Number>>     matrix_free_data;
+  std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free;
+
+  std::shared_ptr<Operator<dim, Number>> pde_operator;
+
+  std::shared_ptr<PostProcessorBase<dim, Number>> postprocessor;
+
+  std::shared_ptr<PostProcessorParareal<Number>> postprocessor_parareal;
+
+  std::shared_ptr<Parareal<Number>> parareal;
+
+  // last time integrator used as fine propagator
+  std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_fine;
+
+  // number of time steps of fine and coarse propagators
+  unsigned int n_time_steps_fine, n_time_steps_coarse;
+
+  // The preconditioner of the shared operator is set up for the time step size of the propagator
+  // that used it last and has to be updated when switching between coarse and fine propagators.
+  bool preconditioner_coarse;
+
+  // Computation time (wall clock time)
+  mutable TimerTree timer_tree;
+};
+
+} // namespace ConvDiff
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_CONVECTION_DIFFUSION_DRIVER_PARAREAL_H_ */
@@ -30,8 +30,10 @@
 
 // driver
 #include <exadg/convection_diffusion/driver.h>
+#include <exadg/convection_diffusion/driver_parareal.h>
 
 // utilities
+#include <exadg/time_integration/parareal.h>
 #include <exadg/utilities/general_parameters.h>
 #include <exadg/utilities/resolution_parameters.h>
 
@@ -54,6 +56,9 @@ create_input_file(std::string const & input_file)
   TemporalResolutionParameters temporal;
   temporal.add_parameters(prm);
 
+  PararealParameters parareal;
+  parareal.add_parameters(prm);
+
   // we have to assume a default dimension and default Number type
   // for the automatic generation of a default input file
   unsigned int const Dim = 2;
@@ -67,13 +72,61 @@ create_input_file(std::string const & input_file)
 
 template<int dim, typename Number>
 void
-run(std::string const & input_file,
-    unsigned int const  degree,
-    unsigned int const  refine_space,
-    unsigned int const  refine_time,
-    MPI_Comm const &    mpi_comm,
-    bool const          is_test)
+run_parareal(std::string const &        input_file,
+             unsigned int const         degree,
+             unsigned int const         refine_space,
+             unsigned int const         refine_time,
+             PararealParameters const & parareal,
+             MPI_Comm const &           mpi_comm,
+             bool const                 is_test)
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  // split communicator into time slabs
+  MPI_Comm comm_space, comm_time;
+  std::tie(comm_space, comm_time) = split_communicator_time_slabs(mpi_comm, parareal.n_time_slabs);
+
+  {
+    std::shared_ptr<ConvDiff::ApplicationBase<dim, Number>> application =
+      ConvDiff::get_application<dim, Number>(input_file, comm_space);
+
+    application->set_parameters_convergence_study(degree, refine_space, refine_time);
+
+    std::shared_ptr<ConvDiff::DriverParareal<dim, Number>> driver =
+      std::make_shared<ConvDiff::DriverParareal<dim, Number>>(
+        comm_space, comm_time, application, parareal, is_test);
+
+    driver->setup();
+
+    driver->solve();
+
+    if(not(is_test))
+      driver->print_performance_results(timer.wall_time());
+  }
+
+  // free communicators
+  MPI_Comm_free(&comm_space);
+  MPI_Comm_free(&comm_time);
+}
+
+template<int dim, typename Number>
+void
+run(std::string const &        input_file,
+    unsigned int const         degree,
+    unsigned int const         refine_space,
+    unsigned int const         refine_time,
+    PararealParameters const & parareal,
+    MPI_Comm const &           mpi_comm,
+    bool const                 is_test)
 {
+  if(parareal.n_time_slabs > 1)
+  {
+    run_parareal<dim, Number>(
+      input_file, degree, refine_space, refine_time, parareal, mpi_comm, is_test);
+    return;
+  }
+
   dealii::Timer timer;
   timer.restart();
 
@@ -132,6 +185,10 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters            general(input_file);
   ExaDG::SpatialResolutionParameters  spatial(input_file);
   ExaDG::TemporalResolutionParameters temporal(input_file);
+  ExaDG::PararealParameters           parareal(input_file);
+
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
 
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
@@ -149,16 +206,16 @@ main(int argc, char ** argv)
         // run the simulation
         if(general.dim == 2 && general.precision == "float")
           ExaDG::run<2, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         else if(general.dim == 2 && general.precision == "double")
           ExaDG::run<2, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         else if(general.dim == 3 && general.precision == "float")
           ExaDG::run<3, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         else if(general.dim == 3 && general.precision == "double")
           ExaDG::run<3, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, parareal, mpi_comm, general.is_test);
         else
           AssertThrow(false,
                       dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
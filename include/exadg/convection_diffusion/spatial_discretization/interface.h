@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/time_integration/restart.h>
 
 namespace ExaDG
 {
@@ -121,6 +122,13 @@ public:
   // needed for ALE-type problems
   virtual void
   fill_grid_coordinates_vector(VectorType & vector) const = 0;
+
+  // restart: write/read dof vector to/from a restart file shared by all processes
+  virtual void
+  write_restart_vector(CollectiveRestartFile & file, VectorType const & vector) const = 0;
+
+  virtual void
+  read_restart_vector(CollectiveRestartFile & file, VectorType & vector) const = 0;
 };
 } // namespace Interface
 
@@ -162,6 +162,7 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
     convective_kernel_data.dof_index_velocity         = get_dof_index_velocity();
     convective_kernel_data.numerical_flux_formulation = param.numerical_flux_convective_operator;
     convective_kernel_data.velocity                   = field_functions->velocity;
+    convective_kernel_data.use_cache                  = param.cache_analytical_functions;
 
     convective_kernel = std::make_shared<Operators::ConvectiveKernel<dim, Number>>();
     convective_kernel->reinit(*matrix_free,
@@ -212,9 +213,10 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
 
   // rhs operator
   RHSOperatorData<dim> rhs_operator_data;
-  rhs_operator_data.dof_index     = get_dof_index();
-  rhs_operator_data.quad_index    = get_quad_index();
-  rhs_operator_data.kernel_data.f = field_functions->right_hand_side;
+  rhs_operator_data.dof_index             = get_dof_index();
+  rhs_operator_data.quad_index            = get_quad_index();
+  rhs_operator_data.kernel_data.f         = field_functions->right_hand_side;
+  rhs_operator_data.kernel_data.use_cache = param.cache_analytical_functions;
   rhs_operator.initialize(*matrix_free, rhs_operator_data);
 
   // merged operator
@@ -499,6 +501,7 @@ Operator<dim, Number>::initialize_solver()
     Krylov::SolverDataCG solver_data;
     solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.n_projection_vectors = param.solver_data.n_projection_vectors;
     solver_data.max_iter             = param.solver_data.max_iter;
 
     if(param.preconditioner != Preconditioner::None)
@@ -515,6 +518,7 @@ Operator<dim, Number>::initialize_solver()
     Krylov::SolverDataGMRES solver_data;
     solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.n_projection_vectors = param.solver_data.n_projection_vectors;
     solver_data.max_iter             = param.solver_data.max_iter;
     solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
 
@@ -532,6 +536,7 @@ Operator<dim, Number>::initialize_solver()
     Krylov::SolverDataFGMRES solver_data;
     solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.n_projection_vectors = param.solver_data.n_projection_vectors;
     solver_data.max_iter             = param.solver_data.max_iter;
     solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
 
@@ -846,6 +851,21 @@ Operator<dim, Number>::fill_grid_coordinates_vector(VectorType & vector) const
   grid_motion->fill_grid_coordinates_vector(vector, this->get_dof_handler_velocity());
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::write_restart_vector(CollectiveRestartFile & file,
+                                            VectorType const &      vector) const
+{
+  file.write_vector(vector, dof_handler);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::read_restart_vector(CollectiveRestartFile & file, VectorType & vector) const
+{
+  file.read_vector(vector, dof_handler);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::update_after_grid_motion()
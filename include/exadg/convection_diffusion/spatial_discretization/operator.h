@@ -223,6 +223,15 @@ public:
   void
   fill_grid_coordinates_vector(VectorType & vector) const;
 
+  /*
+   * Writes/reads a dof-vector to/from a restart file shared by all processes.
+   */
+  void
+  write_restart_vector(CollectiveRestartFile & file, VectorType const & vector) const;
+
+  void
+  read_restart_vector(CollectiveRestartFile & file, VectorType & vector) const;
+
   /*
    * Updates operators after grid has been moved.
    */
@@ -25,8 +25,10 @@
 #include <exadg/convection_diffusion/user_interface/boundary_descriptor.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/functions_and_boundary_conditions/quadrature_values_cache.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/operator_base.h>
+#include <exadg/operators/thread_local_ptr.h>
 
 namespace ExaDG
 {
@@ -41,6 +43,7 @@ struct ConvectiveKernelData
     : formulation(FormulationConvectiveTerm::DivergenceFormulation),
       velocity_type(TypeVelocityField::Function),
       dof_index_velocity(1),
+      use_cache(false),
       numerical_flux_formulation(NumericalFluxConvectiveOperator::Undefined)
   {
   }
@@ -57,6 +60,9 @@ struct ConvectiveKernelData
   // TypeVelocityField::Function
   std::shared_ptr<dealii::Function<dim>> velocity;
 
+  // TypeVelocityField::Function: store values of velocity field at quadrature points
+  bool use_cache;
+
   // numerical flux (e.g., central flux vs. Lax-Friedrichs flux)
   NumericalFluxConvectiveOperator numerical_flux_formulation;
 };
@@ -77,6 +83,10 @@ private:
   typedef FaceIntegrator<dim, 1, Number> IntegratorFace;
 
 public:
+  ConvectiveKernel()
+  {
+  }
+
   void
   reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
          ConvectiveKernelData<dim> const &       data_in,
@@ -85,20 +95,28 @@ public:
   {
     data = data_in;
 
-    if(data.velocity_type == TypeVelocityField::DoFVector)
+    if(data.velocity_type == TypeVelocityField::Function && data.use_cache)
     {
-      integrator_velocity =
-        std::make_shared<CellIntegratorVelocity>(matrix_free, data.dof_index_velocity, quad_index);
-
-      integrator_velocity_m = std::make_shared<FaceIntegratorVelocity>(matrix_free,
-                                                                       true,
-                                                                       data.dof_index_velocity,
-                                                                       quad_index);
+      velocity_cache.reinit(matrix_free, quad_index);
+    }
 
-      integrator_velocity_p = std::make_shared<FaceIntegratorVelocity>(matrix_free,
-                                                                       false,
-                                                                       data.dof_index_velocity,
-                                                                       quad_index);
+    if(data.velocity_type == TypeVelocityField::DoFVector)
+    {
+      integrator_velocity.reset(
+        std::make_shared<CellIntegratorVelocity>(matrix_free, data.dof_index_velocity, quad_index),
+        matrix_free);
+
+      integrator_velocity_m.reset(std::make_shared<FaceIntegratorVelocity>(matrix_free,
+                                                                           true,
+                                                                           data.dof_index_velocity,
+                                                                           quad_index),
+                                  matrix_free);
+
+      integrator_velocity_p.reset(std::make_shared<FaceIntegratorVelocity>(matrix_free,
+                                                                           false,
+                                                                           data.dof_index_velocity,
+                                                                           quad_index),
+                                  matrix_free);
 
       // use own storage of velocity vector only in case of multigrid
       if(is_mg)
@@ -191,6 +209,8 @@ public:
   void
   reinit_face(unsigned int const face) const
   {
+    current_face = face;
+
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
       integrator_velocity_m->reinit(face);
@@ -204,6 +224,8 @@ public:
   void
   reinit_boundary_face(unsigned int const face) const
   {
+    current_face = face;
+
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
       integrator_velocity_m->reinit(face);
@@ -216,6 +238,9 @@ public:
                          unsigned int const               face,
                          dealii::types::boundary_id const boundary_id) const
   {
+    // the cache is based on face batches of face-based loops
+    current_face = dealii::numbers::invalid_unsigned_int;
+
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
       integrator_velocity_m->reinit(cell, face);
@@ -231,6 +256,37 @@ public:
     }
   }
 
+  /*
+   * Values of the analytical velocity field (TypeVelocityField::Function).
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    get_velocity_function(IntegratorCell &   integrator,
+                          unsigned int const q,
+                          Number const &     time) const
+  {
+    if(data.use_cache)
+      return velocity_cache.get_value_cell(data.velocity, integrator, q, time);
+    else
+      return FunctionEvaluator<1, dim, Number>::value(data.velocity,
+                                                      integrator.quadrature_point(q),
+                                                      time);
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    get_velocity_function(IntegratorFace &   integrator,
+                          unsigned int const q,
+                          Number const &     time) const
+  {
+    if(data.use_cache)
+      return velocity_cache.get_value_face(data.velocity, integrator, current_face, q, time);
+    else
+      return FunctionEvaluator<1, dim, Number>::value(data.velocity,
+                                                      integrator.quadrature_point(q),
+                                                      time);
+  }
+
   /*
    * This function calculates the numerical flux using the central flux.
    */
@@ -309,9 +365,7 @@ public:
 
     if(data.velocity_type == TypeVelocityField::Function)
     {
-      dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
-
-      vector velocity = FunctionEvaluator<1, dim, Number>::value(data.velocity, q_points, time);
+      vector velocity = get_velocity_function(integrator, q, time);
 
       scalar normal_velocity = velocity * normal_m;
 
@@ -386,9 +440,7 @@ public:
 
     if(data.velocity_type == TypeVelocityField::Function)
     {
-      dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
-
-      velocity = FunctionEvaluator<1, dim, Number>::value(data.velocity, q_points, time);
+      velocity = get_velocity_function(integrator, q, time);
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
@@ -478,9 +530,7 @@ public:
 
     if(data.velocity_type == TypeVelocityField::Function)
     {
-      velocity = FunctionEvaluator<1, dim, Number>::value(data.velocity,
-                                                          integrator.quadrature_point(q),
-                                                          time);
+      velocity = get_velocity_function(integrator, q, time);
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
@@ -505,9 +555,7 @@ public:
 
     if(data.velocity_type == TypeVelocityField::Function)
     {
-      velocity = FunctionEvaluator<1, dim, Number>::value(data.velocity,
-                                                          integrator.quadrature_point(q),
-                                                          time);
+      velocity = get_velocity_function(integrator, q, time);
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
@@ -526,9 +574,16 @@ private:
 
   mutable lazy_ptr<VectorType> velocity;
 
-  std::shared_ptr<CellIntegratorVelocity> integrator_velocity;
-  std::shared_ptr<FaceIntegratorVelocity> integrator_velocity_m;
-  std::shared_ptr<FaceIntegratorVelocity> integrator_velocity_p;
+  // integrators evaluating the velocity on the current cell or face, one per thread if the
+  // matrix-free loops are executed task-parallel
+  thread_local_ptr<CellIntegratorVelocity> integrator_velocity;
+  thread_local_ptr<FaceIntegratorVelocity> integrator_velocity_m;
+  thread_local_ptr<FaceIntegratorVelocity> integrator_velocity_p;
+
+  QuadratureValuesCache<1, dim, Number> velocity_cache;
+
+  // index of the current face, set in reinit_face*() and stored per thread
+  static inline thread_local unsigned int current_face = dealii::numbers::invalid_unsigned_int;
 };
 
 } // namespace Operators
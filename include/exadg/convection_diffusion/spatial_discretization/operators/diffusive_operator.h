@@ -57,7 +57,7 @@ private:
   typedef FaceIntegrator<dim, 1, Number> IntegratorFace;
 
 public:
-  DiffusiveKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  DiffusiveKernel() : degree(1)
   {
   }
 
@@ -189,7 +189,9 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, set in reinit_face*(). It is stored per thread so
+  // that the kernel can be used in task-parallel matrix-free loops.
+  static inline thread_local scalar tau;
 };
 
 } // namespace Operators
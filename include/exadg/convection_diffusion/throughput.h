@@ -150,6 +150,9 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
   ExaDG::ThroughputParameters          throughput(input_file);
 
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
+
   // fill resolution vector
   resolution.fill_resolution_vector(&ExaDG::ConvDiff::get_dofs_per_element, input_file);
 
@@ -53,6 +53,8 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     cfl(param.cfl / std::pow(2.0, refine_steps_time)),
     solution(param_in.order_time_integrator),
     vec_convective_term(param_in.order_time_integrator),
+    initial_solution(nullptr),
+    force_update_preconditioner(false),
     iterations({0, 0}),
     cfl_oif(param.cfl_oif / std::pow(2.0, refine_steps_time)),
     postprocessor(postprocessor_in),
@@ -115,7 +117,33 @@ TimeIntBDF<dim, Number>::initialize_oif()
     convective_operator_OIF =
       std::make_shared<OperatorOIF<Number>>(pde_operator, numerical_velocity_field);
 
-    if(param.time_integrator_oif == TimeIntegratorRK::ExplRK1Stage1)
+    if(param.embedded_error_control.active)
+    {
+      // embedded error control requires the low-storage schemes with embedded weights
+      if(param.time_integrator_oif == TimeIntegratorRK::ExplRK3Stage4Reg2C)
+      {
+        time_integrator_OIF =
+          std::make_shared<LowStorageRKReg2Embedded<OperatorOIF<Number>, VectorType>>(
+            convective_operator_OIF, 3, 4);
+      }
+      else if(param.time_integrator_oif == TimeIntegratorRK::ExplRK4Stage5Reg2C)
+      {
+        time_integrator_OIF =
+          std::make_shared<LowStorageRKReg2Embedded<OperatorOIF<Number>, VectorType>>(
+            convective_operator_OIF, 4, 5);
+      }
+      else
+      {
+        AssertThrow(false,
+                    dealii::ExcMessage("Embedded error control is not available for the "
+                                       "specified time integration scheme."));
+      }
+
+      this->oif_error_controller =
+        std::make_shared<PIController>(param.embedded_error_control,
+                                       time_integrator_OIF->get_order_embedded_scheme());
+    }
+    else if(param.time_integrator_oif == TimeIntegratorRK::ExplRK1Stage1)
     {
       time_integrator_OIF =
         std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorOIF<Number>, VectorType>>(
@@ -225,7 +253,10 @@ TimeIntBDF<dim, Number>::initialize_current_solution()
   if(this->param.ale_formulation)
     pde_operator->move_grid(this->get_time());
 
-  pde_operator->prescribe_initial_conditions(solution[0], this->get_time());
+  if(initial_solution != nullptr)
+    solution[0] = *initial_solution;
+  else
+    pde_operator->prescribe_initial_conditions(solution[0], this->get_time());
 }
 
 template<int dim, typename Number>
@@ -457,11 +488,11 @@ TimeIntBDF<dim, Number>::print_solver_info() const
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDF<dim, Number>::read_restart_vectors(CollectiveRestartFile & file)
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
-    ia >> solution[i];
+    file.read_vector(solution[i], pde_operator->get_dof_handler());
   }
 
   if(param.convective_problem() &&
@@ -471,7 +502,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        file.read_vector(vec_convective_term[i], pde_operator->get_dof_handler());
       }
     }
   }
@@ -480,18 +511,18 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      ia >> vec_grid_coordinates[i];
+      file.read_vector(vec_grid_coordinates[i], pde_operator->get_dof_handler_velocity());
     }
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
+TimeIntBDF<dim, Number>::write_restart_vectors(CollectiveRestartFile & file) const
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << solution[i];
+    file.write_vector(solution[i], pde_operator->get_dof_handler());
   }
 
   if(param.convective_problem() &&
@@ -501,7 +532,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        file.write_vector(vec_convective_term[i], pde_operator->get_dof_handler());
       }
     }
   }
@@ -510,7 +541,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      oa << vec_grid_coordinates[i];
+      file.write_vector(vec_grid_coordinates[i], pde_operator->get_dof_handler_velocity());
     }
   }
 }
@@ -609,8 +640,11 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
 
   // solve the linear system of equations
   bool const update_preconditioner =
-    this->param.update_preconditioner &&
-    (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
+    force_update_preconditioner ||
+    (this->param.update_preconditioner &&
+     (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0));
+
+  force_update_preconditioner = false;
 
   unsigned int const N_iter =
     pde_operator->solve(solution_np,
@@ -706,6 +740,20 @@ TimeIntBDF<dim, Number>::do_timestep_oif_substepping(VectorType & solution_tilde
                                       time_step_size);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::do_timestep_oif_substepping_with_error_estimate(
+  VectorType & solution_tilde_mp,
+  VectorType & solution_tilde_m,
+  VectorType & error,
+  double const start_time,
+  double const time_step_size)
+{
+  // solve sub-step and estimate error
+  time_integrator_OIF->solve_timestep_with_error_estimate(
+    solution_tilde_mp, solution_tilde_m, error, start_time, time_step_size);
+}
+
 
 template<int dim, typename Number>
 void
@@ -740,6 +788,27 @@ TimeIntBDF<dim, Number>::print_iterations() const
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::set_initial_solution(VectorType const & initial_solution_in)
+{
+  initial_solution = &initial_solution_in;
+}
+
+template<int dim, typename Number>
+typename TimeIntBDF<dim, Number>::VectorType const &
+TimeIntBDF<dim, Number>::get_solution() const
+{
+  return solution[0];
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::force_preconditioner_update()
+{
+  force_update_preconditioner = true;
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::set_velocities_and_times(
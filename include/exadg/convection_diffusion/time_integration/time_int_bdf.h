@@ -73,6 +73,24 @@ public:
   void
   print_iterations() const;
 
+  /*
+   * Prescribe the solution at start time by the given vector instead of the initial condition of
+   * the application, e.g. for propagators over time slabs of parallel-in-time methods. This
+   * function has to be called before setup() and the vector has to be valid during setup().
+   */
+  void
+  set_initial_solution(VectorType const & initial_solution_in);
+
+  VectorType const &
+  get_solution() const;
+
+  /*
+   * Update the preconditioner in the next time step independently of the parameters, e.g. if the
+   * operator is shared with a time integrator using a different time step size.
+   */
+  void
+  force_preconditioner_update();
+
 private:
   void
   allocate_vectors() final;
@@ -123,14 +141,21 @@ private:
                               double const start_time,
                               double const time_step_size) final;
 
+  void
+  do_timestep_oif_substepping_with_error_estimate(VectorType & solution_tilde_mp,
+                                                  VectorType & solution_tilde_m,
+                                                  VectorType & error,
+                                                  double const start_time,
+                                                  double const time_step_size) final;
+
   bool
   print_solver_info() const final;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) final;
+  read_restart_vectors(CollectiveRestartFile & file) final;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const final;
+  write_restart_vectors(CollectiveRestartFile & file) const final;
 
   void
   postprocessing() const final;
@@ -151,6 +176,12 @@ private:
 
   VectorType rhs_vector;
 
+  // initial solution prescribed by set_initial_solution()
+  VectorType const * initial_solution;
+
+  // set by force_preconditioner_update()
+  bool force_update_preconditioner;
+
   // numerical velocity field
   std::vector<VectorType const *> velocities;
   std::vector<double>             times;
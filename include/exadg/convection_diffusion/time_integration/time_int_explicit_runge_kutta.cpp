@@ -266,7 +266,33 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   expl_rk_operator =
     std::make_shared<OperatorExplRK<Number>>(pde_operator, numerical_velocity_field);
 
-  if(param.time_integrator_rk == TimeIntegratorRK::ExplRK1Stage1)
+  if(param.embedded_error_control.active)
+  {
+    // embedded error control requires the low-storage schemes with embedded weights
+    if(param.time_integrator_rk == TimeIntegratorRK::ExplRK3Stage4Reg2C)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Embedded<OperatorExplRK<Number>, VectorType>>(
+          expl_rk_operator, 3, 4);
+    }
+    else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg2C)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Embedded<OperatorExplRK<Number>, VectorType>>(
+          expl_rk_operator, 4, 5);
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage("Embedded error control is not available for the specified "
+                                     "time integration scheme."));
+    }
+
+    this->error_controller =
+      std::make_shared<PIController>(param.embedded_error_control,
+                                     rk_time_integrator->get_order_embedded_scheme());
+  }
+  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK1Stage1)
   {
     rk_time_integrator =
       std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType>>(
@@ -330,6 +356,20 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   }
 }
 
+template<typename Number>
+void
+TimeIntExplRK<Number>::write_restart_vectors(CollectiveRestartFile & file) const
+{
+  pde_operator->write_restart_vector(file, this->solution_n);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::read_restart_vectors(CollectiveRestartFile & file)
+{
+  pde_operator->read_restart_vector(file, this->solution_n);
+}
+
 template<typename Number>
 bool
 TimeIntExplRK<Number>::print_solver_info() const
@@ -354,15 +394,37 @@ TimeIntExplRK<Number>::do_timestep_solve()
     }
   }
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(this->error_controller)
+  {
+    this->time_step_proposed = this->time_step;
+
+    // the time step size is set to the size of the accepted time step
+    this->time_step = do_timestep_with_error_control(
+      this->solution_np,
+      this->solution_n,
+      this->error_estimate,
+      this->time,
+      this->time_step_proposed,
+      *this->error_controller,
+      [&](VectorType & dst, VectorType & src, VectorType & error, double const t, double const dt) {
+        rk_time_integrator->solve_timestep_with_error_estimate(dst, src, error, t, dt);
+      });
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info() and not(this->is_test))
   {
     this->pcout << std::endl << "Solve scalar convection-diffusion equation explicitly:";
     print_wall_time(this->pcout, timer.wall_time());
+
+    if(this->error_controller)
+      print_parameter(this->pcout, "Time step size", this->time_step);
   }
 
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
@@ -81,6 +81,12 @@ private:
   bool
   print_solver_info() const;
 
+  void
+  write_restart_vectors(CollectiveRestartFile & file) const final;
+
+  void
+  read_restart_vectors(CollectiveRestartFile & file) final;
+
   void
   do_timestep_solve() final;
 
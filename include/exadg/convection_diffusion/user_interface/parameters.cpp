@@ -59,6 +59,7 @@ Parameters::Parameters()
     max_velocity(std::numeric_limits<double>::min()),
     time_integrator_oif(TimeIntegratorRK::Undefined),
     cfl_oif(-1.),
+    embedded_error_control(EmbeddedErrorControlData()),
     diffusion_number(-1.),
     c_eff(-1.),
     exponent_fe_degree_convection(1.5),
@@ -90,6 +91,7 @@ Parameters::Parameters()
     use_cell_based_face_loops(false),
     use_combined_operator(true),
     store_analytical_velocity_in_dof_vector(false),
+    cache_analytical_functions(false),
     use_overintegration(false)
 {
 }
@@ -147,6 +149,10 @@ Parameters::check() const
           "When using the ALE formulation, the velocity has to be stored in a DoF vector."));
     }
 
+    AssertThrow(cache_analytical_functions == false,
+                dealii::ExcMessage(
+                  "Caching of analytical functions is not possible for moving meshes."));
+
     AssertThrow(
       formulation_convective_term == FormulationConvectiveTerm::ConvectiveFormulation,
       dealii::ExcMessage(
@@ -228,6 +234,24 @@ Parameters::check() const
                     "Adaptive time stepping can only be used in combination with CFL condition."));
     }
 
+    if(embedded_error_control.active)
+    {
+      TimeIntegratorRK const time_integrator =
+        (temporal_discretization == TemporalDiscretization::ExplRK) ? time_integrator_rk :
+                                                                      time_integrator_oif;
+
+      AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK ||
+                    treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF,
+                  dealii::ExcMessage("Embedded error control requires explicit Runge-Kutta time "
+                                     "integration or OIF splitting."));
+
+      AssertThrow(time_integrator == TimeIntegratorRK::ExplRK3Stage4Reg2C ||
+                    time_integrator == TimeIntegratorRK::ExplRK4Stage5Reg2C,
+                  dealii::ExcMessage(
+                    "Embedded error control is only implemented for ExplRK3Stage4Reg2C and "
+                    "ExplRK4Stage5Reg2C."));
+    }
+
     if(temporal_discretization == TemporalDiscretization::ExplRK)
     {
       AssertThrow(order_time_integrator >= 1 && order_time_integrator <= 4,
@@ -503,6 +527,11 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
                     enum_to_string(adaptive_time_stepping_cfl_type));
   }
 
+  if(temporal_discretization == TemporalDiscretization::ExplRK ||
+     treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    embedded_error_control.print(pcout);
+  }
 
   // here we do not print quantities such as cfl, diffusion_number, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -601,6 +630,9 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
     }
   }
 
+  if(cache_analytical_functions)
+    print_parameter(pcout, "Cache analytical functions", cache_analytical_functions);
+
   print_parameter(pcout, "Use over-integration", use_overintegration);
 }
 
@@ -33,6 +33,7 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
+#include <exadg/time_integration/embedded_error_control.h>
 #include <exadg/time_integration/enum_types.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
@@ -202,6 +203,14 @@ public:
   // critical time step size arising from the CFL restriction)
   double cfl_oif;
 
+  // adaptive time stepping based on the error estimate of an embedded Runge-Kutta scheme. For
+  // explicit Runge-Kutta time integration, this controls the time step size (where the time step
+  // size according to calculation_of_time_step_size is only used for the first time step). For BDF
+  // time integration with OIF splitting, this controls the size of the sub-steps (starting with the
+  // sub-step size according to cfl_oif). Only available for ExplRK3Stage4Reg2C and
+  // ExplRK4Stage5Reg2C.
+  EmbeddedErrorControlData embedded_error_control;
+
   // diffusion number (relevant number for limitation of time step size
   // when treating the diffusive term explicitly)
   double diffusion_number;
@@ -321,6 +330,13 @@ public:
   // term has to be evaluated more than once at a given time t.
   bool store_analytical_velocity_in_dof_vector;
 
+  // Store the values of analytical functions (velocity field, right-hand side) at the
+  // quadrature points and re-evaluate them only if the time changes. This avoids repeated calls
+  // to dealii::Function<dim>::value() if an operator is evaluated more than once at a given time
+  // t. Functions of type FunctionSeparable are evaluated only once. This option can not be used
+  // in combination with moving meshes.
+  bool cache_analytical_functions;
+
   // use 3/2 overintegration rule for convective term
   bool use_overintegration;
 };
@@ -144,6 +144,9 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
+
   // run the simulation
   if(general.dim == 2 && general.precision == "double")
     ExaDG::run<2, double>(input_file, mpi_comm, general.is_test);
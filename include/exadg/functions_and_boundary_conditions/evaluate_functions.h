@@ -29,10 +29,47 @@
 #include <deal.II/base/vectorization.h>
 
 #include <exadg/functions_and_boundary_conditions/function_cached.h>
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 #include <exadg/functions_and_boundary_conditions/function_with_normal.h>
 
 namespace ExaDG
 {
+namespace internal
+{
+/*
+ * Evaluates one component of a function for a batch of points. Functions derived from
+ * FunctionVectorized evaluate all lanes in a single call and constant functions are evaluated
+ * only once. All other functions are evaluated lane by lane via the scalar interface.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::VectorizedArray<Number>
+  evaluate_function_component(dealii::Function<dim> const &                               function,
+                              dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+                              unsigned int const                                          component)
+{
+  if(auto function_vectorized = dynamic_cast<FunctionVectorized<dim> const *>(&function))
+    return function_vectorized->vectorized_value(q_points, component);
+
+  if(auto function_constant =
+       dynamic_cast<dealii::Functions::ConstantFunction<dim> const *>(&function))
+    return dealii::make_vectorized_array<Number>(
+      function_constant->value(dealii::Point<dim>(), component));
+
+  dealii::VectorizedArray<Number> value;
+  for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+  {
+    dealii::Point<dim> q_point;
+    for(unsigned int d = 0; d < dim; ++d)
+      q_point[d] = q_points[d][v];
+
+    value[v] = function.value(q_point, component);
+  }
+
+  return value;
+}
+} // namespace internal
+
 template<int rank, int dim, typename Number>
 struct FunctionEvaluator
 {
@@ -95,21 +132,9 @@ struct FunctionEvaluator<0, dim, Number>
           dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
           double const &                                              time)
   {
-    dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
-
-    Number array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-    {
-      dealii::Point<dim> q_point;
-      for(unsigned int d = 0; d < dim; ++d)
-        q_point[d] = q_points[d][v];
-
-      function->set_time(time);
-      array[v] = function->value(q_point);
-    }
-    value.load(&array[0]);
+    function->set_time(time);
 
-    return value;
+    return internal::evaluate_function_component(*function, q_points, 0);
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
@@ -141,22 +166,11 @@ struct FunctionEvaluator<1, dim, Number>
           dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
           double const &                                              time)
   {
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    function->set_time(time);
 
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
     for(unsigned int d = 0; d < dim; ++d)
-    {
-      Number array[dealii::VectorizedArray<Number>::size()];
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-      {
-        dealii::Point<dim> q_point;
-        for(unsigned int d = 0; d < dim; ++d)
-          q_point[d] = q_points[d][v];
-
-        function->set_time(time);
-        array[v] = function->value(q_point, d);
-      }
-      value[d].load(&array[0]);
-    }
+      value[d] = internal::evaluate_function_component(*function, q_points, d);
 
     return value;
   }
@@ -197,25 +211,22 @@ struct FunctionEvaluator<1, dim, Number>
   {
     auto function_with_normal = std::dynamic_pointer_cast<FunctionWithNormal<dim>>(function);
 
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    function_with_normal->set_time(time);
 
-    for(unsigned int d = 0; d < dim; ++d)
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
     {
-      Number array[dealii::VectorizedArray<Number>::size()];
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+      dealii::Point<dim>     q_point;
+      dealii::Tensor<1, dim> normal;
+      for(unsigned int d = 0; d < dim; ++d)
       {
-        dealii::Point<dim>     q_point;
-        dealii::Tensor<1, dim> normal;
-        for(unsigned int d = 0; d < dim; ++d)
-        {
-          q_point[d] = q_points[d][v];
-          normal[d]  = normals[d][v];
-        }
-        function_with_normal->set_time(time);
-        function_with_normal->set_normal_vector(normal);
-        array[v] = function_with_normal->value(q_point, d);
+        q_point[d] = q_points[d][v];
+        normal[d]  = normals[d][v];
       }
-      value[d].load(&array[0]);
+      function_with_normal->set_normal_vector(normal);
+
+      for(unsigned int d = 0; d < dim; ++d)
+        value[d][v] = function_with_normal->value(q_point, d);
     }
 
     return value;
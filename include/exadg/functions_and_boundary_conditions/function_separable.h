@@ -0,0 +1,95 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_SEPARABLE_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_SEPARABLE_H_
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Function of the form f(x,t) = g(t) * h(x), i.e., a spatial function h(x) scaled by a scalar
+ * function of time g(t). If no function of time is provided, f(x,t) = h(x) is time-independent.
+ * This information allows to evaluate the spatial part only once at the quadrature points, see
+ * QuadratureValuesCache.
+ */
+template<int dim>
+class FunctionSeparable : public FunctionVectorized<dim>
+{
+public:
+  FunctionSeparable(std::shared_ptr<dealii::Function<dim>> function_space,
+                    std::shared_ptr<dealii::Function<1>>   function_time = nullptr)
+    : FunctionVectorized<dim>(function_space->n_components),
+      function_space(function_space),
+      function_time(function_time)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const
+  {
+    return get_time_factor(this->get_time()) * function_space->value(p, component);
+  }
+
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & points,
+                   unsigned int const                                          component = 0) const
+  {
+    return get_time_factor(this->get_time()) *
+           internal::evaluate_function_component(*function_space, points, component);
+  }
+
+  double
+  get_time_factor(double const time) const
+  {
+    if(function_time)
+      return function_time->value(dealii::Point<1>(time));
+    else
+      return 1.0;
+  }
+
+  bool
+  is_time_independent() const
+  {
+    return function_time == nullptr;
+  }
+
+  std::shared_ptr<dealii::Function<dim>>
+  get_function_space() const
+  {
+    return function_space;
+  }
+
+private:
+  std::shared_ptr<dealii::Function<dim>> function_space;
+  std::shared_ptr<dealii::Function<1>>   function_time;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_SEPARABLE_H_ */
@@ -0,0 +1,100 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_VECTORIZED_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_VECTORIZED_H_
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+/*
+ * Class that extends the Function class of deal.II by the evaluation of a whole batch of points
+ * of type dealii::Point<dim, dealii::VectorizedArray<Number>> in a single call. Derived classes
+ * implement the scalar interface value() as usual and may override vectorized_value() for
+ * performance. By default, vectorized_value() evaluates value() lane by lane.
+ */
+template<int dim>
+class FunctionVectorized : public dealii::Function<dim>
+{
+public:
+  FunctionVectorized(unsigned int const n_components = 1, double const time = 0.0)
+    : dealii::Function<dim>(n_components, time)
+  {
+  }
+
+  virtual ~FunctionVectorized()
+  {
+  }
+
+  virtual dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & points,
+                   unsigned int const                                          component = 0) const
+  {
+    dealii::VectorizedArray<double> result;
+    for(unsigned int v = 0; v < dealii::VectorizedArray<double>::size(); ++v)
+    {
+      dealii::Point<dim> point;
+      for(unsigned int d = 0; d < dim; ++d)
+        point[d] = points[d][v];
+
+      result[v] = this->value(point, component);
+    }
+
+    return result;
+  }
+
+  /*
+   * Single precision points are evaluated in batches of double precision points, so that derived
+   * classes only have to implement the double precision variant.
+   */
+  dealii::VectorizedArray<float>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<float>> const & points,
+                   unsigned int const                                         component = 0) const
+  {
+    unsigned int const n_lanes_float  = dealii::VectorizedArray<float>::size();
+    unsigned int const n_lanes_double = dealii::VectorizedArray<double>::size();
+
+    dealii::VectorizedArray<float> result;
+    for(unsigned int offset = 0; offset < n_lanes_float; offset += n_lanes_double)
+    {
+      dealii::Point<dim, dealii::VectorizedArray<double>> points_double;
+      for(unsigned int d = 0; d < dim; ++d)
+        for(unsigned int v = 0; v < n_lanes_double; ++v)
+          points_double[d][v] = points[d][offset + v < n_lanes_float ? offset + v : 0];
+
+      dealii::VectorizedArray<double> const result_double =
+        vectorized_value(points_double, component);
+
+      for(unsigned int v = 0; v < n_lanes_double and offset + v < n_lanes_float; ++v)
+        result[offset + v] = result_double[v];
+    }
+
+    return result;
+  }
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_VECTORIZED_H_ */
@@ -0,0 +1,208 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_QUADRATURE_VALUES_CACHE_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_QUADRATURE_VALUES_CACHE_H_
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/functions_and_boundary_conditions/function_separable.h>
+
+namespace ExaDG
+{
+/*
+ * Stores the values of an analytical function at the quadrature points of all cell batches and
+ * face batches of a dealii::MatrixFree object. The values of a batch are computed when the batch
+ * is accessed for the first time and are only re-computed if the function or the evaluation time
+ * changes. This avoids repeated calls to dealii::Function<dim>::value() when an operator is
+ * applied several times for the same time t, e.g. within iterative solvers. For functions of type
+ * FunctionSeparable, only the spatial part is stored and scaled by the time factor g(t), so that
+ * these values are computed only once.
+ *
+ * Face batches are identified by the face index of face-based loops. Cell-based face loops do not
+ * use the cache and pass dealii::numbers::invalid_unsigned_int as face index.
+ *
+ * The cache assumes that the quadrature points do not change, i.e., it can not be used for moving
+ * meshes.
+ */
+template<int rank, int dim, typename Number>
+class QuadratureValuesCache
+{
+private:
+  typedef dealii::VectorizedArray<Number>   scalar;
+  typedef dealii::Tensor<rank, dim, scalar> value_type;
+
+  struct Storage
+  {
+    Storage() : n_q_points(0)
+    {
+    }
+
+    void
+    reinit(unsigned int const n_batches, unsigned int const n_q_points_in)
+    {
+      n_q_points = n_q_points_in;
+      values.resize_fast(n_batches * n_q_points);
+      functions.assign(n_batches, nullptr);
+      separable.assign(n_batches, nullptr);
+      times.assign(n_batches, 0.0);
+    }
+
+    unsigned int n_q_points;
+
+    dealii::AlignedVector<value_type> values;
+
+    // function and time for which the values of a batch have been computed
+    std::vector<dealii::Function<dim> const *>  functions;
+    std::vector<FunctionSeparable<dim> const *> separable;
+    std::vector<double>                         times;
+  };
+
+public:
+  QuadratureValuesCache() : time_factor_function(nullptr), time_factor_time(0.0), time_factor(1.0)
+  {
+  }
+
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free, unsigned int const quad_index)
+  {
+    cells.reinit(matrix_free.n_cell_batches(), matrix_free.get_n_q_points(quad_index));
+    faces.reinit(matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches(),
+                 matrix_free.get_n_q_points_face(quad_index));
+
+    time_factor_function = nullptr;
+  }
+
+  template<typename Integrator>
+  inline DEAL_II_ALWAYS_INLINE //
+    value_type
+    get_value_cell(std::shared_ptr<dealii::Function<dim>> const & function,
+                   Integrator const &                             integrator,
+                   unsigned int const                             q,
+                   double const &                                 time) const
+  {
+    return get_value(cells, function, integrator, integrator.get_current_cell_index(), q, time);
+  }
+
+  template<typename Integrator>
+  inline DEAL_II_ALWAYS_INLINE //
+    value_type
+    get_value_face(std::shared_ptr<dealii::Function<dim>> const & function,
+                   Integrator const &                             integrator,
+                   unsigned int const                             face,
+                   unsigned int const                             q,
+                   double const &                                 time) const
+  {
+    return get_value(faces, function, integrator, face, q, time);
+  }
+
+private:
+  template<typename Integrator>
+  inline DEAL_II_ALWAYS_INLINE //
+    value_type
+    get_value(Storage &                                      storage,
+              std::shared_ptr<dealii::Function<dim>> const & function,
+              Integrator const &                             integrator,
+              unsigned int const                             index,
+              unsigned int const                             q,
+              double const &                                 time) const
+  {
+    if(index >= storage.functions.size())
+      return FunctionEvaluator<rank, dim, Number>::value(function,
+                                                         integrator.quadrature_point(q),
+                                                         time);
+
+    if(storage.functions[index] != function.get() ||
+       (storage.separable[index] == nullptr && storage.times[index] != time))
+    {
+      fill(storage, function, integrator, index, time);
+    }
+
+    value_type const & value = storage.values[index * storage.n_q_points + q];
+
+    if(storage.separable[index] != nullptr)
+      return get_time_factor(*storage.separable[index], time) * value;
+    else
+      return value;
+  }
+
+  template<typename Integrator>
+  void
+  fill(Storage &                                      storage,
+       std::shared_ptr<dealii::Function<dim>> const & function,
+       Integrator const &                             integrator,
+       unsigned int const                             index,
+       double const &                                 time) const
+  {
+    FunctionSeparable<dim> const * separable =
+      dynamic_cast<FunctionSeparable<dim> const *>(function.get());
+
+    // only the spatial part is stored for separable functions
+    std::shared_ptr<dealii::Function<dim>> function_stored =
+      separable != nullptr ? separable->get_function_space() : function;
+
+    for(unsigned int q = 0; q < storage.n_q_points; ++q)
+    {
+      storage.values[index * storage.n_q_points + q] =
+        FunctionEvaluator<rank, dim, Number>::value(function_stored,
+                                                    integrator.quadrature_point(q),
+                                                    time);
+    }
+
+    storage.functions[index] = function.get();
+    storage.separable[index] = separable;
+    storage.times[index]     = time;
+  }
+
+  /*
+   * The time factor g(t) is evaluated only once per function and time.
+   */
+  scalar
+  get_time_factor(FunctionSeparable<dim> const & function, double const & time) const
+  {
+    if(time_factor_function != &function || time_factor_time != time)
+    {
+      time_factor_function = &function;
+      time_factor_time     = time;
+      time_factor          = function.get_time_factor(time);
+    }
+
+    return dealii::make_vectorized_array<Number>(time_factor);
+  }
+
+  mutable Storage cells;
+  mutable Storage faces;
+
+  mutable FunctionSeparable<dim> const * time_factor_function;
+  mutable double                         time_factor_time;
+  mutable double                         time_factor;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_QUADRATURE_VALUES_CACHE_H_ */
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_GRID_GRID_MOTION_ANALYTICAL_H_
 #define INCLUDE_GRID_GRID_MOTION_ANALYTICAL_H_
 
+// deal.II
+#include <deal.II/base/thread_local_storage.h>
+
+// ExaDG
 #include <exadg/grid/grid_motion_base.h>
 
 namespace ExaDG
@@ -74,20 +78,28 @@ private:
   initialize(dealii::Triangulation<dim> const &     triangulation,
              std::shared_ptr<dealii::Function<dim>> displacement_function)
   {
-    AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
     // dummy FE for compatibility with interface of dealii::FEValues
     dealii::FE_Nothing<dim> dummy_fe;
-    dealii::FEValues<dim>   fe_values(*this->mapping_undeformed,
-                                    dummy_fe,
-                                    dealii::QGaussLobatto<dim>(this->moving_mapping->get_degree() +
-                                                               1),
-                                    dealii::update_quadrature_points);
+
+    // dealii::MappingQCache calls the function below from several threads, so that each thread
+    // needs its own dealii::FEValues object
+    dealii::Threads::ThreadLocalStorage<std::shared_ptr<dealii::FEValues<dim>>> fe_values_thread;
 
     this->moving_mapping->initialize(
       triangulation,
       [&](typename dealii::Triangulation<dim>::cell_iterator const & cell)
         -> std::vector<dealii::Point<dim>> {
+        std::shared_ptr<dealii::FEValues<dim>> & fe_values_ptr = fe_values_thread.get();
+        if(fe_values_ptr.get() == nullptr)
+        {
+          fe_values_ptr = std::make_shared<dealii::FEValues<dim>>(
+            *this->mapping_undeformed,
+            dummy_fe,
+            dealii::QGaussLobatto<dim>(this->moving_mapping->get_degree() + 1),
+            dealii::update_quadrature_points);
+        }
+        dealii::FEValues<dim> & fe_values = *fe_values_ptr;
+
         fe_values.reinit(cell);
 
         // compute displacement and add to original position
@@ -25,6 +25,7 @@
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/fe/fe_nothing.h>
 #include <deal.II/fe/fe_q.h>
@@ -183,8 +184,6 @@ public:
                              VectorType const &                          displacement_vector,
                              dealii::DoFHandler<dim> const &             dof_handler)
   {
-    AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
     VectorType displacement_vector_ghosted;
     if(dof_handler.n_dofs() > 0 && displacement_vector.size() == dof_handler.n_dofs())
     {
@@ -197,17 +196,11 @@ public:
       displacement_vector_ghosted.update_ghost_values();
     }
 
-    std::shared_ptr<dealii::FEValues<dim>> fe_values;
+    // dealii::MappingQCache calls the function below from several threads, so that each thread
+    // needs its own dealii::FEValues object
+    dealii::Threads::ThreadLocalStorage<std::shared_ptr<dealii::FEValues<dim>>> fe_values_thread;
 
     dealii::FE_Nothing<dim> fe_nothing;
-    if(mapping.get() != 0)
-    {
-      fe_values =
-        std::make_shared<dealii::FEValues<dim>>(*mapping,
-                                                fe_nothing,
-                                                dealii::QGaussLobatto<dim>(this->get_degree() + 1),
-                                                dealii::update_quadrature_points);
-    }
 
     // update mapping according to mesh deformation described by displacement vector
     dealii::MappingQCache<dim>::initialize(
@@ -221,6 +214,16 @@ public:
 
         if(mapping.get() != 0)
         {
+          std::shared_ptr<dealii::FEValues<dim>> & fe_values = fe_values_thread.get();
+          if(fe_values.get() == nullptr)
+          {
+            fe_values = std::make_shared<dealii::FEValues<dim>>(
+              *mapping,
+              fe_nothing,
+              dealii::QGaussLobatto<dim>(this->get_degree() + 1),
+              dealii::update_quadrature_points);
+          }
+
           fe_values->reinit(cell_tria);
           // extract displacement and add to original position
           for(unsigned int i = 0; i < scalar_dofs_per_cell; ++i)
@@ -285,8 +288,6 @@ initialize_multigrid(std::shared_ptr<MappingDoFVector<dim, Number>>      mapping
                      std::shared_ptr<dealii::MappingQCache<dim> const> & mapping_q_cache,
                      dealii::Triangulation<dim> const &                  triangulation)
 {
-  AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
   // we have to project the solution onto all coarse levels of the triangulation
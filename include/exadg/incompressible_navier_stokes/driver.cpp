@@ -310,6 +310,9 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     pcout << std::endl << "Average number of iterations:" << std::endl;
 
     time_integrator->print_iterations();
+
+    // accepted and rejected sub-steps in case of OIF sub-stepping with embedded error control
+    time_integrator->print_error_control_statistics_oif();
   }
 
   // Wall times
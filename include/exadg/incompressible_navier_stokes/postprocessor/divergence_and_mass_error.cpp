@@ -137,6 +137,7 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div(
     }
   }
 
+  std::lock_guard<dealii::Threads::Mutex> lock(mutex);
   dst.at(0) += div * data.reference_length_scale;
   dst.at(1) += ref;
 }
@@ -185,6 +186,7 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_face(
     }
   }
 
+  std::lock_guard<dealii::Threads::Mutex> lock(mutex);
   dst.at(2) += diff_mass_flux;
   dst.at(3) += mean_mass_flux;
 }
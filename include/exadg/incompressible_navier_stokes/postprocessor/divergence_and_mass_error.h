@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_DIVERGENCE_AND_MASS_ERROR_H_
 
 // deal.II
+#include <deal.II/base/thread_management.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -149,6 +150,9 @@ private:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   MassConservationData                    data;
+
+  // protects the accumulation of the results of all cell ranges in task-parallel loops
+  mutable dealii::Threads::Mutex mutex;
 };
 
 
@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/utilities/print_functions.h>
+#include <exadg/vector_tools/point_evaluator.h>
 
 namespace ExaDG
 {
@@ -116,11 +117,7 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>
-    array_dof_indices_and_shape_values;
-
-  std::vector<unsigned int> array_counter;
+  PointEvaluator<dim, Number> point_evaluator;
 };
 
 } // namespace IncNS
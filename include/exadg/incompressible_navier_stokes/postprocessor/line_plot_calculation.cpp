@@ -49,7 +49,30 @@ LinePlotCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handl
   data                 = line_plot_data_in;
 
   if(data.calculate)
+  {
     create_directories(data.line_data.directory, mpi_comm);
+
+    // locate the points of all lines once
+    point_evaluators.resize(data.line_data.lines.size());
+    for(unsigned int l = 0; l < data.line_data.lines.size(); ++l)
+    {
+      Line<dim> const & line = *data.line_data.lines[l];
+
+      // we consider straight lines with an equidistant distribution of points along the line
+      std::vector<dealii::Point<dim>> points(line.n_points);
+      for(unsigned int i = 0; i < line.n_points; ++i)
+        points[i] = line.begin + double(i) / double(line.n_points - 1) * (line.end - line.begin);
+
+      // the values are only needed on rank 0, which writes the files
+      point_evaluators[l].setup(points,
+                                dof_handler_velocity->get_triangulation(),
+                                *mapping,
+                                1.e-10 /* tolerance */,
+                                0 /* consumer rank */);
+
+      AssertThrow(point_evaluators[l].all_points_found(), dealii::ExcMessage("No points found."));
+    }
+  }
 }
 
 template<int dim, typename Number>
@@ -63,19 +86,39 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
     unsigned int const precision = data.line_data.precision;
 
     // loop over all lines
+    unsigned int line_index = 0;
     for(typename std::vector<std::shared_ptr<Line<dim>>>::const_iterator line =
           data.line_data.lines.begin();
         line != data.line_data.lines.end();
-        ++line)
+        ++line, ++line_index)
     {
-      // store all points along current line in a vector
-      unsigned int                    n_points = (*line)->n_points;
-      std::vector<dealii::Point<dim>> points(n_points);
+      PointEvaluator<dim, Number> const & point_evaluator = point_evaluators[line_index];
 
-      // we consider straight lines with an equidistant distribution of points along the line
-      for(unsigned int i = 0; i < n_points; ++i)
-        points[i] =
-          (*line)->begin + double(i) / double(n_points - 1) * ((*line)->end - (*line)->begin);
+      // all points along current line (only available on rank 0)
+      std::vector<dealii::Point<dim>> const & points   = point_evaluator.get_points();
+      unsigned int const                      n_points = points.size();
+
+      // evaluate all quantities of the current line in a single pass
+      std::vector<typename PointEvaluator<dim, Number>::Field> fields;
+      unsigned int index_velocity = dealii::numbers::invalid_unsigned_int;
+      unsigned int index_pressure = dealii::numbers::invalid_unsigned_int;
+      for(auto const & quantity : (*line)->quantities)
+      {
+        if(quantity->type == QuantityType::Velocity and
+           index_velocity == dealii::numbers::invalid_unsigned_int)
+        {
+          index_velocity = fields.size();
+          fields.emplace_back(dof_handler_velocity.get(), &velocity);
+        }
+        else if(quantity->type == QuantityType::Pressure and
+                index_pressure == dealii::numbers::invalid_unsigned_int)
+        {
+          index_pressure = fields.size();
+          fields.emplace_back(dof_handler_pressure.get(), &pressure);
+        }
+      }
+
+      std::vector<std::vector<Number>> const values = point_evaluator.evaluate(fields);
 
       // filename prefix for current line
       std::string filename_prefix = data.line_data.directory + (*line)->name;
@@ -89,15 +132,9 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
         if((*quantity)->type == QuantityType::Velocity)
         {
           std::vector<dealii::Tensor<1, dim, Number>> solution_vector(n_points);
-
-          // calculate velocity for all points along line
           for(unsigned int i = 0; i < n_points; ++i)
-          {
-            dealii::Tensor<1, dim, Number> u;
-            evaluate_vectorial_quantity_in_point(
-              u, *dof_handler_velocity, *mapping, velocity, points[i], mpi_comm);
-            solution_vector[i] = u;
-          }
+            for(unsigned int d = 0; d < dim; ++d)
+              solution_vector[i][d] = values[index_velocity][i * dim + d];
 
           // write output to file
           if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
@@ -140,16 +177,7 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
         }
         else if((*quantity)->type == QuantityType::Pressure)
         {
-          std::vector<Number> solution_vector(n_points);
-
-          // calculate pressure for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            Number p;
-            evaluate_scalar_quantity_in_point(
-              p, *dof_handler_pressure, *mapping, pressure, points[i], mpi_comm);
-            solution_vector[i] = p;
-          }
+          std::vector<Number> const & solution_vector = values[index_pressure];
 
           // write output to file
           if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
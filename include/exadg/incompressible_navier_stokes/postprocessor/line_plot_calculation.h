@@ -23,7 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_LINE_PLOT_CALCULATION_H_
 
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
-#include <exadg/vector_tools/point_value.h>
+#include <exadg/vector_tools/point_evaluator.h>
 
 namespace ExaDG
 {
@@ -65,6 +65,9 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   LinePlotDataInstantaneous<dim> data;
+
+  // one evaluator per line
+  std::vector<PointEvaluator<dim, Number>> point_evaluators;
 };
 
 } // namespace IncNS
@@ -19,13 +19,9 @@
  *  ______________________________________________________________________
  */
 
-// deal.II
-#include <deal.II/grid/grid_tools.h>
-
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation_statistics.h>
 #include <exadg/utilities/create_directories.h>
-#include <exadg/vector_tools/interpolate_solution.h>
 
 namespace ExaDG
 {
@@ -64,8 +60,8 @@ LinePlotCalculatorStatistics<dim, Number>::setup(
     velocity_global.resize(data.line_data.lines.size());
     pressure_global.resize(data.line_data.lines.size());
     global_points.resize(data.line_data.lines.size());
-    cells_global_velocity.resize(data.line_data.lines.size());
-    cells_global_pressure.resize(data.line_data.lines.size());
+    point_evaluators.resize(data.line_data.lines.size());
+    point_indices.resize(data.line_data.lines.size());
 
     unsigned int line_iterator = 0;
     for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line =
@@ -84,9 +80,6 @@ LinePlotCalculatorStatistics<dim, Number>::setup(
                                                       ((*line)->end - (*line)->begin);
         global_points[line_iterator].push_back(point);
       }
-
-      cells_global_velocity[line_iterator].resize((*line)->n_points);
-      cells_global_pressure[line_iterator].resize((*line)->n_points);
     }
 
     create_directories(data.line_data.directory, mpi_comm);
@@ -130,10 +123,10 @@ LinePlotCalculatorStatistics<dim, Number>::evaluate(VectorType const &   velocit
 
 template<int dim, typename Number>
 void
-LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const & velocity,
-                                                                VectorType const & pressure)
+LinePlotCalculatorStatistics<dim, Number>::initialize_point_evaluators()
 {
-  // Save data related to all adjacent cells for a given point along the line.
+  // Locate all evaluation points of a line, including the points for averaging in circumferential
+  // direction, and store the index of the corresponding point along the line.
   unsigned int line_iterator = 0;
   for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line =
         data.line_data.lines.begin();
@@ -148,28 +141,6 @@ LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const
                 dealii::ExcMessage(
                   "Invalid line type, expected LineCircumferentialAveraging<dim>"));
 
-    // find out which quantities have to be evaluated
-    bool velocity_has_to_be_evaluated = false;
-    bool pressure_has_to_be_evaluated = false;
-
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      if((*quantity)->type == QuantityType::Velocity ||
-         (*quantity)->type == QuantityType::SkinFriction ||
-         (*quantity)->type == QuantityType::ReynoldsStresses)
-      {
-        velocity_has_to_be_evaluated = true;
-      }
-
-      if((*quantity)->type == QuantityType::Pressure)
-      {
-        pressure_has_to_be_evaluated = true;
-      }
-    }
-
     // determine two unit vectors defining circumferential plane
     dealii::Tensor<1, dim, double> normal_vector;
     dealii::Tensor<1, dim, double> unit_vector_1, unit_vector_2;
@@ -196,6 +167,8 @@ LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const
       unit_vector_2 /= norm_2;
     }
 
+    std::vector<dealii::Point<dim>> evaluation_points;
+
     // for all points along a line
     for(unsigned int p = 0; p < (*line)->n_points; ++p)
     {
@@ -231,49 +204,19 @@ LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const
         }
       }
 
-      for(typename std::vector<dealii::Point<dim>>::iterator point_it = points.begin();
-          point_it != points.end();
-          ++point_it)
+      for(auto const & point_circ : points)
       {
-        if(velocity_has_to_be_evaluated == true)
-        {
-          // find adjacent cells and store data required later for evaluating the solution.
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            mapping, dof_handler_velocity.get_triangulation(), *point_it, 1.e-10);
-
-          auto dof_indices_and_shape_values = get_dof_indices_and_shape_values(adjacent_cells,
-                                                                               dof_handler_velocity,
-                                                                               mapping,
-                                                                               velocity);
-
-          for(auto iter = dof_indices_and_shape_values.begin();
-              iter != dof_indices_and_shape_values.end();
-              ++iter)
-          {
-            cells_global_velocity[line_iterator][p].push_back(*iter);
-          }
-        }
-
-        if(pressure_has_to_be_evaluated == true)
-        {
-          // find adjacent cells and store data required later for evaluating the solution.
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            mapping, dof_handler_pressure.get_triangulation(), *point_it, 1.e-10);
-
-          auto dof_indices_and_shape_values = get_dof_indices_and_shape_values(adjacent_cells,
-                                                                               dof_handler_pressure,
-                                                                               mapping,
-                                                                               pressure);
-
-          for(auto iter = dof_indices_and_shape_values.begin();
-              iter != dof_indices_and_shape_values.end();
-              ++iter)
-          {
-            cells_global_pressure[line_iterator][p].push_back(*iter);
-          }
-        }
+        evaluation_points.push_back(point_circ);
+        point_indices[line_iterator].push_back(p);
       }
     }
+
+    // the statistics are only accumulated on rank 0, which writes the files
+    point_evaluators[line_iterator].setup(evaluation_points,
+                                          dof_handler_velocity.get_triangulation(),
+                                          mapping,
+                                          1.e-10 /* tolerance */,
+                                          0 /* consumer rank */);
   }
 }
 
@@ -285,10 +228,10 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate(VectorType const & veloci
   // increment number of samples
   number_of_samples++;
 
-  // Make sure that all data has been initialized before evaluating the solution.
+  // Make sure that all points have been located before evaluating the solution.
   if(cell_data_has_been_initialized == false)
   {
-    initialize_cell_data(velocity, pressure);
+    initialize_point_evaluators();
 
     cell_data_has_been_initialized = true;
   }
@@ -301,6 +244,7 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate(VectorType const & veloci
       ++line, ++line_iterator)
   {
     bool evaluate_velocity = false;
+    bool evaluate_pressure = false;
     for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
           (*line)->quantities.begin();
         quantity != (*line)->quantities.end();
@@ -313,82 +257,68 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate(VectorType const & veloci
       {
         evaluate_velocity = true;
       }
-    }
-    if(evaluate_velocity == true)
-    {
-      do_evaluate_velocity(velocity, *(*line), line_iterator);
-    }
 
-    bool evaluate_pressure = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      // evaluate quantities that involve velocity
+      // evaluate quantities that involve pressure
       if((*quantity)->type == QuantityType::Pressure ||
          (*quantity)->type == QuantityType::PressureCoefficient)
       {
         evaluate_pressure = true;
       }
     }
+
+    // evaluate velocity and pressure in all points of the current line in a single pass
+    std::vector<typename PointEvaluator<dim, Number>::Field> fields;
+    if(evaluate_velocity == true)
+      fields.emplace_back(&dof_handler_velocity, &velocity);
     if(evaluate_pressure == true)
+      fields.emplace_back(&dof_handler_pressure, &pressure);
+
+    if(fields.empty())
+      continue;
+
+    std::vector<std::vector<Number>> const values =
+      point_evaluators[line_iterator].evaluate(fields);
+
+    if(evaluate_velocity == true)
     {
-      do_evaluate_pressure(pressure, *(*line), line_iterator);
+      do_evaluate_velocity(values.front(), *(*line), line_iterator);
+    }
+
+    if(evaluate_pressure == true)
+    {
+      do_evaluate_pressure(values.back(), *(*line), line_iterator);
     }
   }
 }
 
 template<int dim, typename Number>
 void
-LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const & velocity,
-                                                                Line<dim> const &  line,
-                                                                unsigned int const line_iterator)
+LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(
+  std::vector<Number> const & velocity_values,
+  Line<dim> const &           line,
+  unsigned int const          line_iterator)
 {
   // Local variables for the current line:
 
   // for all points along the line: velocity vector
-  std::vector<dealii::Tensor<1, dim, Number>> velocity_vector_local(line.n_points);
+  std::vector<dealii::Tensor<1, dim, Number>> velocity_vector(line.n_points);
   // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
+  std::vector<unsigned int> counter_vector(line.n_points);
 
-  for(unsigned int p = 0; p < line.n_points; ++p)
+  // average over all evaluation points belonging to a point along the line, i.e., in
+  // circumferential direction (the points are only requested by rank 0)
+  PointEvaluator<dim, Number> const & point_evaluator = point_evaluators[line_iterator];
+  for(unsigned int i = 0; i < point_evaluator.get_points().size(); ++i)
   {
-    auto & adjacent_cells(cells_global_velocity[line_iterator][p]);
-
-    // loop over all adjacent, locally owned cells for the current point
-    for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
+    if(point_evaluator.point_found(i))
     {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
-      for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            line.quantities.begin();
-          quantity != line.quantities.end();
-          ++quantity)
-      {
-        if((*quantity)->type == QuantityType::Velocity)
-        {
-          // interpolate solution using the precomputed shape values and the global dof index
-          dealii::Tensor<1, dim, Number> velocity_value = Interpolator<1, dim, Number>::value(
-            dof_handler_velocity, velocity, iter->first, iter->second);
-
-          // add result to array with velocity values
-          velocity_vector_local[p] += velocity_value;
-        }
-        else
-        {
-          AssertThrow(false, dealii::ExcMessage("Not implemented."));
-        }
-      }
+      unsigned int const p = point_indices[line_iterator][i];
+      for(unsigned int d = 0; d < dim; ++d)
+        velocity_vector[p][d] += velocity_values[i * dim + d];
+      counter_vector[p] += 1;
     }
   }
 
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communcation as well as averaging for all quantities of the current line.
   for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
         line.quantities.begin();
       quantity != line.quantities.end();
@@ -396,30 +326,19 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const
   {
     if((*quantity)->type == QuantityType::Velocity)
     {
-      dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(&velocity_vector_local[0][0],
-                                                                  dim *
-                                                                    velocity_vector_local.size()),
-                                  mpi_comm,
-                                  dealii::ArrayView<Number>(&velocity_vector_local[0][0],
-                                                            dim * velocity_vector_local.size()));
-
       // Accumulate instantaneous values into global vector.
       // When writing the output files, we calculate the time-averaged values
       // by dividing the global (accumulated) values by the number of samples.
       for(unsigned int p = 0; p < line.n_points; ++p)
       {
-        // Take average value over all adjacent cells for a given point.
-        for(unsigned int d = 0; d < dim; ++d)
+        if(counter_vector[p] > 0)
         {
-          if(counter_vector_local[p] > 0)
-          {
-            velocity_global[line_iterator][p][d] +=
-              velocity_vector_local[p][d] / counter_vector_local[p];
-          }
+          velocity_global[line_iterator][p] += velocity_vector[p] / Number(counter_vector[p]);
         }
       }
     }
-    else
+    else if((*quantity)->type == QuantityType::SkinFriction ||
+            (*quantity)->type == QuantityType::ReynoldsStresses)
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
@@ -428,56 +347,31 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const
 
 template<int dim, typename Number>
 void
-LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const & pressure,
-                                                                Line<dim> const &  line,
-                                                                unsigned int const line_iterator)
+LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(
+  std::vector<Number> const & pressure_values,
+  Line<dim> const &           line,
+  unsigned int const          line_iterator)
 {
   // Local variables for the current line:
 
   // for all points along the line: pressure value
-  std::vector<Number> pressure_vector_local(line.n_points);
+  std::vector<Number> pressure_vector(line.n_points);
   // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
+  std::vector<unsigned int> counter_vector(line.n_points);
 
-  for(unsigned int p = 0; p < line.n_points; ++p)
+  // average over all evaluation points belonging to a point along the line, i.e., in
+  // circumferential direction (the points are only requested by rank 0)
+  PointEvaluator<dim, Number> const & point_evaluator = point_evaluators[line_iterator];
+  for(unsigned int i = 0; i < point_evaluator.get_points().size(); ++i)
   {
-    auto & adjacent_cells(cells_global_pressure[line_iterator][p]);
-
-    // loop over all adjacent, locally owned cells for the current point
-    for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
+    if(point_evaluator.point_found(i))
     {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
-      for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            line.quantities.begin();
-          quantity != line.quantities.end();
-          ++quantity)
-      {
-        if((*quantity)->type == QuantityType::Pressure)
-        {
-          // interpolate solution using the precomputed shape values and the global dof index
-          Number pressure_value = Interpolator<0, dim, Number>::value(dof_handler_pressure,
-                                                                      pressure,
-                                                                      iter->first,
-                                                                      iter->second);
-
-          // add result to array with pressure values
-          pressure_vector_local[p] += pressure_value;
-        }
-        else
-        {
-          AssertThrow(false, dealii::ExcMessage("Not implemented."));
-        }
-      }
+      unsigned int const p = point_indices[line_iterator][i];
+      pressure_vector[p] += pressure_values[i];
+      counter_vector[p] += 1;
     }
   }
 
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communcation as well as averaging for all quantities of the current line.
   for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
         line.quantities.begin();
       quantity != line.quantities.end();
@@ -485,21 +379,18 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const
   {
     if((*quantity)->type == QuantityType::Pressure)
     {
-      dealii::Utilities::MPI::sum(pressure_vector_local, mpi_comm, pressure_vector_local);
-
       // Accumulate instantaneous values into global vector.
       // When writing the output files, we calculate the time-averaged values
       // by dividing the global (accumulated) values by the number of samples.
       for(unsigned int p = 0; p < line.n_points; ++p)
       {
-        // Take average value over all adjacent cells for a given point.
-        if(counter_vector_local[p] > 0)
+        if(counter_vector[p] > 0)
         {
-          pressure_global[line_iterator][p] += pressure_vector_local[p] / counter_vector_local[p];
+          pressure_global[line_iterator][p] += pressure_vector[p] / counter_vector[p];
         }
       }
     }
-    else
+    else if((*quantity)->type == QuantityType::PressureCoefficient)
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
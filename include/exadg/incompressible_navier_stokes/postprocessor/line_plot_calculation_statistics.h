@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/vector_tools/point_evaluator.h>
 
 namespace ExaDG
 {
@@ -90,20 +91,20 @@ private:
   }
 
   void
-  initialize_cell_data(VectorType const & velocity, VectorType const & pressure);
+  initialize_point_evaluators();
 
   void
   do_evaluate(VectorType const & velocity, VectorType const & pressure);
 
   void
-  do_evaluate_velocity(VectorType const & velocity,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
+  do_evaluate_velocity(std::vector<Number> const & velocity_values,
+                       Line<dim> const &           line,
+                       unsigned int const          line_iterator);
 
   void
-  do_evaluate_pressure(VectorType const & pressure,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
+  do_evaluate_pressure(std::vector<Number> const & pressure_values,
+                       Line<dim> const &           line,
+                       unsigned int const          line_iterator);
 
   void
   do_write_output() const;
@@ -122,17 +123,12 @@ private:
 
   bool cell_data_has_been_initialized;
 
-  // For all lines: for all points along the line: for all relevant cells: dof index of first dof of
-  // current cell and all shape function values
-  std::vector<std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>>
-    cells_global_velocity;
-
-  // For all lines: for all points along the line: for all relevant cells: dof index of first dof of
-  // current cell and all shape function values
-  std::vector<std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>>
-    cells_global_pressure;
+  // For all lines: evaluator for all points along the line, including the points for averaging in
+  // circumferential direction
+  std::vector<PointEvaluator<dim, Number>> point_evaluators;
+
+  // For all lines: for all evaluation points: index of the corresponding point along the line
+  std::vector<std::vector<unsigned int>> point_indices;
 
   // number of samples for averaging in time
   unsigned int number_of_samples;
@@ -263,6 +263,7 @@ MeanVelocityCalculator<dim, Number>::local_calculate_volume(
     }
   }
 
+  std::lock_guard<dealii::Threads::Mutex> lock(mutex);
   dst.at(0) += volume;
 }
 
@@ -378,6 +379,7 @@ MeanVelocityCalculator<dim, Number>::local_calculate_flow_rate_volume(
     }
   }
 
+  std::lock_guard<dealii::Threads::Mutex> lock(mutex);
   dst.at(0) += flow_rate;
 }
 
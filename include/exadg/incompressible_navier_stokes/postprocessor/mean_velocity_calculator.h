@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_MEAN_VELOCITY_CALCULATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_MEAN_VELOCITY_CALCULATOR_H_
 
+// deal.II
+#include <deal.II/base/thread_management.h>
+
+// ExaDG
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -168,6 +172,9 @@ private:
   mutable bool                            clear_files;
 
   MPI_Comm const mpi_comm;
+
+  // protects the accumulation of the results of all cell ranges in task-parallel loops
+  mutable dealii::Threads::Mutex mutex;
 };
 
 } // namespace IncNS
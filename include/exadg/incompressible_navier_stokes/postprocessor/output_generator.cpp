@@ -45,37 +45,42 @@ write_output(OutputData const &                                         output_d
              dealii::LinearAlgebra::distributed::Vector<Number> const & pressure,
              std::vector<SolutionField<dim, Number>> const &            additional_fields,
              unsigned int const                                         output_counter,
-             MPI_Comm const &                                           mpi_comm)
+             double const                                               time,
+             MPI_Comm const &                                           mpi_comm,
+             OutputPipeline *                                           pipeline,
+             HDF5Output<dim> *                                          hdf5_output)
 {
-  std::string folder = output_data.directory, file = output_data.filename;
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
 
-  dealii::DataOut<dim> data_out;
-  data_out.set_flags(flags);
+  auto data_out = std::make_shared<dealii::DataOut<dim>>();
+  data_out->set_flags(flags);
+
+  auto vectors = std::make_shared<OutputVectors<VectorType>>(pipeline != nullptr);
 
   std::vector<std::string> velocity_names(dim, "velocity");
   std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
     velocity_component_interpretation(
       dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
 
-  data_out.add_data_vector(dof_handler_velocity,
-                           velocity,
-                           velocity_names,
-                           velocity_component_interpretation);
+  data_out->add_data_vector(dof_handler_velocity,
+                            vectors->get(velocity),
+                            velocity_names,
+                            velocity_component_interpretation);
 
-  data_out.add_data_vector(dof_handler_pressure, pressure, "p");
+  data_out->add_data_vector(dof_handler_pressure, vectors->get(pressure), "p");
 
   // vector needs to survive until build_patches
-  dealii::Vector<double> aspect_ratios;
+  auto aspect_ratios = std::make_shared<dealii::Vector<double>>();
   if(output_data.write_aspect_ratio)
   {
-    aspect_ratios =
+    *aspect_ratios =
       dealii::GridTools::compute_aspect_ratio_of_cells(mapping,
                                                        dof_handler_velocity.get_triangulation(),
                                                        dealii::QGauss<dim>(4));
-    data_out.add_data_vector(aspect_ratios, "aspect_ratio");
+    data_out->add_data_vector(*aspect_ratios, "aspect_ratio");
   }
 
   for(typename std::vector<SolutionField<dim, Number>>::const_iterator it =
@@ -85,11 +90,11 @@ write_output(OutputData const &                                         output_d
   {
     if(it->type == SolutionFieldType::scalar)
     {
-      data_out.add_data_vector(*it->dof_handler, *it->vector, it->name);
+      data_out->add_data_vector(*it->dof_handler, vectors->get(*it->vector), it->name);
     }
     else if(it->type == SolutionFieldType::cellwise)
     {
-      data_out.add_data_vector(*it->vector, it->name);
+      data_out->add_data_vector(vectors->get(*it->vector), it->name);
     }
     else if(it->type == SolutionFieldType::vector)
     {
@@ -98,7 +103,10 @@ write_output(OutputData const &                                         output_d
         component_interpretation(dim,
                                  dealii::DataComponentInterpretation::component_is_part_of_vector);
 
-      data_out.add_data_vector(*it->dof_handler, *it->vector, names, component_interpretation);
+      data_out->add_data_vector(*it->dof_handler,
+                                vectors->get(*it->vector),
+                                names,
+                                component_interpretation);
     }
     else
     {
@@ -106,9 +114,15 @@ write_output(OutputData const &                                         output_d
     }
   }
 
-  data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
-
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  build_patches_and_write(data_out,
+                          {vectors, aspect_ratios},
+                          mapping,
+                          output_data,
+                          output_counter,
+                          time,
+                          mpi_comm,
+                          pipeline,
+                          hdf5_output);
 }
 
 template<int dim, typename Number>
@@ -131,6 +145,8 @@ OutputGenerator<dim, Number>::setup(NavierStokesOperator const &    navier_stoke
   mapping                = &mapping_in;
   output_data            = output_data_in;
 
+  output_data.check();
+
   // reset output counter
   output_counter = output_data.start_counter;
 
@@ -140,6 +156,12 @@ OutputGenerator<dim, Number>::setup(NavierStokesOperator const &    navier_stoke
   {
     create_directories(output_data.directory, mpi_comm);
 
+    if(output_data.asynchronous)
+      pipeline = std::make_shared<OutputPipeline>(output_data.max_pending_outputs);
+
+    if(output_data.write_hdf5)
+      hdf5_output = std::make_shared<HDF5Output<dim>>(mpi_comm);
+
     // Visualize boundary IDs:
     // since boundary IDs typically do not change during the simulation, we only do this
     // once at the beginning of the simulation (i.e., in the setup function).
@@ -182,6 +204,14 @@ OutputGenerator<dim, Number>::setup(NavierStokesOperator const &    navier_stoke
   }
 }
 
+template<int dim, typename Number>
+void
+OutputGenerator<dim, Number>::add_additional_fields(
+  std::vector<SolutionField<dim, Number>> const & fields)
+{
+  additional_fields.insert(additional_fields.end(), fields.begin(), fields.end());
+}
+
 template<int dim, typename Number>
 void
 OutputGenerator<dim, Number>::evaluate(VectorType const & velocity,
@@ -228,7 +258,10 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & velocity,
                           pressure,
                           additional_fields,
                           output_counter,
-                          mpi_comm);
+                          time,
+                          mpi_comm,
+                          pipeline.get(),
+                          hdf5_output.get());
 
         ++output_counter;
       }
@@ -249,7 +282,10 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & velocity,
                         pressure,
                         additional_fields,
                         output_counter,
-                        mpi_comm);
+                        time,
+                        mpi_comm,
+                        pipeline.get(),
+                        hdf5_output.get());
 
       ++output_counter;
     }
@@ -22,7 +22,9 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 
+#include <exadg/postprocessor/hdf5_output.h>
 #include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/output_pipeline.h>
 #include <exadg/postprocessor/solution_field.h>
 
 namespace ExaDG
@@ -147,6 +149,12 @@ public:
         dealii::Mapping<dim> const &    mapping_in,
         OutputData const &              output_data_in);
 
+  /*
+   * Fields computed by other postprocessing tools that are written together with the solution.
+   */
+  void
+  add_additional_fields(std::vector<SolutionField<dim, Number>> const & fields);
+
   void
   evaluate(VectorType const & velocity,
            VectorType const & pressure,
@@ -192,6 +200,9 @@ private:
   unsigned int counter_mean_velocity;
 
   std::vector<SolutionField<dim, Number>> additional_fields;
+
+  std::shared_ptr<OutputPipeline>  pipeline;
+  std::shared_ptr<HDF5Output<dim>> hdf5_output;
 };
 
 } // namespace IncNS
@@ -59,6 +59,9 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                          *pde_operator.get_mapping(),
                          pp_data.output_data);
 
+  volume_statistics_calculator.setup(pde_operator, pp_data.volume_statistics_data);
+  output_generator.add_additional_fields(volume_statistics_calculator.get_solution_fields());
+
   error_calculator_u.setup(pde_operator.get_dof_handler_u(),
                            *pde_operator.get_mapping(),
                            pp_data.error_data_u);
@@ -106,6 +109,11 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
                                               double const       time,
                                               int const          time_step_number)
 {
+  /*
+   *  accumulate statistics (before writing output so that the output contains the current sample)
+   */
+  volume_statistics_calculator.evaluate(velocity, pressure, time, time_step_number);
+
   /*
    *  write output
    */
@@ -148,6 +156,34 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
   line_plot_calculator.evaluate(velocity, pressure);
 }
 
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::write_restart_preamble(boost::archive::binary_oarchive & oa) const
+{
+  volume_statistics_calculator.write_restart_preamble(oa);
+}
+
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::write_restart_vectors(CollectiveRestartFile & file) const
+{
+  volume_statistics_calculator.write_restart_vectors(file);
+}
+
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::read_restart_preamble(boost::archive::binary_iarchive & ia)
+{
+  volume_statistics_calculator.read_restart_preamble(ia);
+}
+
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::read_restart_vectors(CollectiveRestartFile & file)
+{
+  volume_statistics_calculator.read_restart_vectors(file);
+}
+
 template class PostProcessor<2, float>;
 template class PostProcessor<2, double>;
 
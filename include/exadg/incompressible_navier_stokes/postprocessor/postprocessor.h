@@ -27,6 +27,7 @@
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/output_generator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/volume_statistics_calculator.h>
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
@@ -52,6 +53,7 @@ struct PostProcessorData
   KineticEnergyData              kinetic_energy_data;
   KineticEnergySpectrumData      kinetic_energy_spectrum_data;
   LinePlotDataInstantaneous<dim> line_plot_data;
+  VolumeStatisticsData           volume_statistics_data;
 };
 
 template<int dim, typename Number>
@@ -77,6 +79,18 @@ public:
                     double const       time             = 0.0,
                     int const          time_step_number = -1) override;
 
+  void
+  write_restart_preamble(boost::archive::binary_oarchive & oa) const override;
+
+  void
+  write_restart_vectors(CollectiveRestartFile & file) const override;
+
+  void
+  read_restart_preamble(boost::archive::binary_iarchive & ia) override;
+
+  void
+  read_restart_vectors(CollectiveRestartFile & file) override;
+
 protected:
   MPI_Comm const mpi_comm;
 
@@ -109,6 +123,9 @@ private:
 
   // evaluate quantities along lines through the domain
   LinePlotCalculator<dim, Number> line_plot_calculator;
+
+  // accumulate statistics of velocity and pressure over time in the whole domain
+  VolumeStatisticsCalculator<dim, Number> volume_statistics_calculator;
 };
 
 
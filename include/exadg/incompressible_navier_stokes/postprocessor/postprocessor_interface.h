@@ -22,8 +22,16 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_INTERFACE_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_INTERFACE_H_
 
+// boost
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+// deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/time_integration/restart.h>
+
 namespace ExaDG
 {
 namespace IncNS
@@ -47,6 +55,35 @@ public:
                     VectorType const & pressure,
                     double const       time             = 0.0,
                     int const          time_step_number = -1) = 0;
+
+  /*
+   * Restart: postprocessing tools accumulating data over time (e.g., statistics) can store their
+   * state in the restart file of the time integrator. Scalar data is written to the preamble,
+   * vectors are written after the solution vectors. The default implementation stores nothing.
+   */
+  virtual void
+  write_restart_preamble(boost::archive::binary_oarchive & oa) const
+  {
+    (void)oa;
+  }
+
+  virtual void
+  write_restart_vectors(CollectiveRestartFile & file) const
+  {
+    (void)file;
+  }
+
+  virtual void
+  read_restart_preamble(boost::archive::binary_iarchive & ia)
+  {
+    (void)ia;
+  }
+
+  virtual void
+  read_restart_vectors(CollectiveRestartFile & file)
+  {
+    (void)file;
+  }
 };
 
 } // namespace IncNS
@@ -0,0 +1,295 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/volume_statistics_calculator.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim, typename Number>
+VolumeStatisticsCalculator<dim, Number>::VolumeStatisticsCalculator() : number_of_samples(0)
+{
+}
+
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::setup(
+  NavierStokesOperator const & navier_stokes_operator_in,
+  VolumeStatisticsData const & data_in)
+{
+  navier_stokes_operator = &navier_stokes_operator_in;
+  data                   = data_in;
+
+  if(data.calculate)
+  {
+    navier_stokes_operator->initialize_vector_velocity(mean_velocity);
+    navier_stokes_operator->initialize_vector_pressure(mean_pressure);
+    navier_stokes_operator->initialize_vector_pressure(pressure_variance);
+
+    // diagonal entries first, then off-diagonal entries of the symmetric tensor
+    for(unsigned int i = 0; i < dim; ++i)
+      stress_components.push_back(std::make_pair(i, i));
+    for(unsigned int i = 0; i < dim; ++i)
+      for(unsigned int j = i + 1; j < dim; ++j)
+        stress_components.push_back(std::make_pair(i, j));
+
+    reynolds_stresses.resize(stress_components.size());
+    for(auto & stress : reynolds_stresses)
+      navier_stokes_operator->initialize_vector_velocity_scalar(stress);
+
+    number_of_samples = 0;
+  }
+}
+
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                                  VectorType const & pressure,
+                                                  double const       time,
+                                                  int const          time_step_number)
+{
+  if(data.calculate)
+  {
+    AssertThrow(time_step_number >= 0,
+                dealii::ExcMessage(
+                  "Volume statistics can only be computed for unsteady problems."));
+
+    if(time >= data.sample_start_time && time <= data.sample_end_time &&
+       time_step_number % data.sample_every_timesteps == 0)
+    {
+      do_evaluate(velocity, pressure);
+    }
+  }
+}
+
+template<int dim, typename Number>
+std::vector<SolutionField<dim, Number>>
+VolumeStatisticsCalculator<dim, Number>::get_solution_fields() const
+{
+  std::vector<SolutionField<dim, Number>> fields;
+
+  if(data.calculate)
+  {
+    SolutionField<dim, Number> sol;
+    sol.type        = SolutionFieldType::vector;
+    sol.name        = "mean_velocity";
+    sol.dof_handler = &navier_stokes_operator->get_dof_handler_u();
+    sol.vector      = &mean_velocity;
+    fields.push_back(sol);
+
+    sol.type        = SolutionFieldType::scalar;
+    sol.name        = "mean_pressure";
+    sol.dof_handler = &navier_stokes_operator->get_dof_handler_p();
+    sol.vector      = &mean_pressure;
+    fields.push_back(sol);
+
+    sol.name        = "pressure_variance";
+    sol.dof_handler = &navier_stokes_operator->get_dof_handler_p();
+    sol.vector      = &pressure_variance;
+    fields.push_back(sol);
+
+    std::string const component_names = "uvw";
+    for(unsigned int s = 0; s < stress_components.size(); ++s)
+    {
+      std::string const name = std::string("reynolds_stress_") +
+                               component_names[stress_components[s].first] +
+                               component_names[stress_components[s].second];
+
+      sol.name        = name;
+      sol.dof_handler = &navier_stokes_operator->get_dof_handler_u_scalar();
+      sol.vector      = &reynolds_stresses[s];
+      fields.push_back(sol);
+    }
+  }
+
+  return fields;
+}
+
+template<int dim, typename Number>
+unsigned int
+VolumeStatisticsCalculator<dim, Number>::get_number_of_samples() const
+{
+  return number_of_samples;
+}
+
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::write_restart_preamble(
+  boost::archive::binary_oarchive & oa) const
+{
+  if(data.calculate)
+    oa & number_of_samples;
+}
+
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::write_restart_vectors(CollectiveRestartFile & file) const
+{
+  if(data.calculate)
+  {
+    file.write_vector(mean_velocity, navier_stokes_operator->get_dof_handler_u());
+    file.write_vector(mean_pressure, navier_stokes_operator->get_dof_handler_p());
+    file.write_vector(pressure_variance, navier_stokes_operator->get_dof_handler_p());
+    for(auto const & stress : reynolds_stresses)
+      file.write_vector(stress, navier_stokes_operator->get_dof_handler_u_scalar());
+  }
+}
+
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::read_restart_preamble(
+  boost::archive::binary_iarchive & ia)
+{
+  if(data.calculate)
+    ia & number_of_samples;
+}
+
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::read_restart_vectors(CollectiveRestartFile & file)
+{
+  if(data.calculate)
+  {
+    file.read_vector(mean_velocity, navier_stokes_operator->get_dof_handler_u());
+    file.read_vector(mean_pressure, navier_stokes_operator->get_dof_handler_p());
+    file.read_vector(pressure_variance, navier_stokes_operator->get_dof_handler_p());
+    for(auto & stress : reynolds_stresses)
+      file.read_vector(stress, navier_stokes_operator->get_dof_handler_u_scalar());
+  }
+}
+
+/*
+ * Welford's algorithm: for a new sample x, the mean and the (co-)variance are updated as
+ *
+ *   delta     = x - <x>_{n-1}
+ *   <x>_n     = <x>_{n-1} + delta / n
+ *   C_ij,n    = C_ij,{n-1} + (delta_i * (x_j - <x_j>_n) - C_ij,{n-1}) / n
+ *
+ * The update is done for all degrees of freedom of a cell at once, so that the velocity and
+ * pressure vectors are read only once per sample.
+ */
+template<int dim, typename Number>
+void
+VolumeStatisticsCalculator<dim, Number>::do_evaluate(VectorType const & velocity,
+                                                     VectorType const & pressure)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  ++number_of_samples;
+
+  dealii::MatrixFree<dim, Number> const & matrix_free = navier_stokes_operator->get_matrix_free();
+
+  unsigned int const dof_index_u        = navier_stokes_operator->get_dof_index_velocity();
+  unsigned int const dof_index_u_scalar = navier_stokes_operator->get_dof_index_velocity_scalar();
+  unsigned int const dof_index_p        = navier_stokes_operator->get_dof_index_pressure();
+  unsigned int const quad_index_u       = navier_stokes_operator->get_quad_index_velocity_linear();
+  unsigned int const quad_index_p       = navier_stokes_operator->get_quad_index_pressure();
+
+  CellIntegrator<dim, dim, Number> integrator_u(matrix_free, dof_index_u, quad_index_u);
+  CellIntegrator<dim, dim, Number> integrator_u_mean(matrix_free, dof_index_u, quad_index_u);
+  CellIntegrator<dim, 1, Number>   integrator_stress(matrix_free, dof_index_u_scalar, quad_index_u);
+  CellIntegrator<dim, 1, Number>   integrator_p(matrix_free, dof_index_p, quad_index_p);
+  CellIntegrator<dim, 1, Number>   integrator_p_mean(matrix_free, dof_index_p, quad_index_p);
+  CellIntegrator<dim, 1, Number>   integrator_p_variance(matrix_free, dof_index_p, quad_index_p);
+
+  unsigned int const n_dofs_u = integrator_stress.dofs_per_cell;
+  unsigned int const n_dofs_p = integrator_p.dofs_per_cell;
+
+  scalar const inverse_n = dealii::make_vectorized_array<Number>(1.0 / (double)number_of_samples);
+
+  // deviations from the old and the new mean for all velocity components of a cell
+  dealii::AlignedVector<scalar> delta_old(dim * n_dofs_u);
+  dealii::AlignedVector<scalar> delta_new(dim * n_dofs_u);
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    // velocity: mean
+    integrator_u.reinit(cell);
+    integrator_u.read_dof_values(velocity);
+    integrator_u_mean.reinit(cell);
+    integrator_u_mean.read_dof_values(mean_velocity);
+
+    for(unsigned int i = 0; i < dim * n_dofs_u; ++i)
+    {
+      scalar const u    = integrator_u.begin_dof_values()[i];
+      scalar &     mean = integrator_u_mean.begin_dof_values()[i];
+
+      delta_old[i] = u - mean;
+      mean += delta_old[i] * inverse_n;
+      delta_new[i] = u - mean;
+    }
+
+    integrator_u_mean.set_dof_values(mean_velocity);
+
+    // velocity: Reynolds stresses
+    integrator_stress.reinit(cell);
+    for(unsigned int s = 0; s < stress_components.size(); ++s)
+    {
+      unsigned int const first  = stress_components[s].first * n_dofs_u;
+      unsigned int const second = stress_components[s].second * n_dofs_u;
+
+      integrator_stress.read_dof_values(reynolds_stresses[s]);
+
+      for(unsigned int i = 0; i < n_dofs_u; ++i)
+      {
+        scalar & stress = integrator_stress.begin_dof_values()[i];
+        stress += (delta_old[first + i] * delta_new[second + i] - stress) * inverse_n;
+      }
+
+      integrator_stress.set_dof_values(reynolds_stresses[s]);
+    }
+
+    // pressure: mean and variance
+    integrator_p.reinit(cell);
+    integrator_p.read_dof_values(pressure);
+    integrator_p_mean.reinit(cell);
+    integrator_p_mean.read_dof_values(mean_pressure);
+    integrator_p_variance.reinit(cell);
+    integrator_p_variance.read_dof_values(pressure_variance);
+
+    for(unsigned int i = 0; i < n_dofs_p; ++i)
+    {
+      scalar const p        = integrator_p.begin_dof_values()[i];
+      scalar &     mean     = integrator_p_mean.begin_dof_values()[i];
+      scalar &     variance = integrator_p_variance.begin_dof_values()[i];
+
+      scalar const delta = p - mean;
+      mean += delta * inverse_n;
+      variance += (delta * (p - mean) - variance) * inverse_n;
+    }
+
+    integrator_p_mean.set_dof_values(mean_pressure);
+    integrator_p_variance.set_dof_values(pressure_variance);
+  }
+}
+
+template class VolumeStatisticsCalculator<2, float>;
+template class VolumeStatisticsCalculator<2, double>;
+
+template class VolumeStatisticsCalculator<3, float>;
+template class VolumeStatisticsCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
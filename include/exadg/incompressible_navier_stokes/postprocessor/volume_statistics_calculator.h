@@ -0,0 +1,166 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_VOLUME_STATISTICS_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_VOLUME_STATISTICS_CALCULATOR_H_
+
+// boost
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+// deal.II
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/postprocessor/solution_field.h>
+#include <exadg/time_integration/restart.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Statistics of velocity and pressure accumulated over time in the whole domain, i.e., without
+ * averaging over homogeneous directions. This is useful for turbulent flows without homogeneous
+ * directions, where averaging over time is the only option.
+ */
+struct VolumeStatisticsData
+{
+  VolumeStatisticsData()
+    : calculate(false),
+      sample_start_time(0.0),
+      sample_end_time(std::numeric_limits<double>::max()),
+      sample_every_timesteps(1)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout)
+  {
+    if(calculate == true)
+    {
+      pcout << "  Volume statistics:" << std::endl;
+      print_parameter(pcout, "Sample start time", sample_start_time);
+      print_parameter(pcout, "Sample end time", sample_end_time);
+      print_parameter(pcout, "Sample every timesteps", sample_every_timesteps);
+    }
+  }
+
+  // calculate mean, variance, and Reynolds stresses of velocity and pressure
+  bool calculate;
+
+  // sampling information
+  double       sample_start_time;
+  double       sample_end_time;
+  unsigned int sample_every_timesteps;
+};
+
+template<int dim, typename Number>
+class SpatialOperatorBase;
+
+/*
+ * Computes the following quantities for every degree of freedom of the DG discretization
+ *
+ *   - mean velocity <u_i> and mean pressure <p>,
+ *   - Reynolds stresses <u_i'u_j'> (the diagonal entries are the variances of the velocity
+ *     components),
+ *   - and the variance of the pressure <p'p'>,
+ *
+ * where <.> denotes averaging over time samples. The statistics are updated with Welford's
+ * algorithm in a single loop over all cells, which is numerically stable also for long sampling
+ * periods. The statistics are registered as additional fields of the output generator and can be
+ * stored in the restart files of the time integrator to continue the sampling after a restart.
+ */
+template<int dim, typename Number>
+class VolumeStatisticsCalculator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef SpatialOperatorBase<dim, Number> NavierStokesOperator;
+
+  VolumeStatisticsCalculator();
+
+  void
+  setup(NavierStokesOperator const & navier_stokes_operator_in,
+        VolumeStatisticsData const & data_in);
+
+  void
+  evaluate(VectorType const & velocity,
+           VectorType const & pressure,
+           double const       time,
+           int const          time_step_number);
+
+  /*
+   * Returns the statistics as fields for the output generator. The fields point to the vectors of
+   * this class, so that the output always contains the current statistics.
+   */
+  std::vector<SolutionField<dim, Number>>
+  get_solution_fields() const;
+
+  unsigned int
+  get_number_of_samples() const;
+
+  /*
+   * Restart: the number of samples is stored in the preamble of the restart file, the statistics
+   * are stored as vectors.
+   */
+  void
+  write_restart_preamble(boost::archive::binary_oarchive & oa) const;
+
+  void
+  write_restart_vectors(CollectiveRestartFile & file) const;
+
+  void
+  read_restart_preamble(boost::archive::binary_iarchive & ia);
+
+  void
+  read_restart_vectors(CollectiveRestartFile & file);
+
+private:
+  void
+  do_evaluate(VectorType const & velocity, VectorType const & pressure);
+
+  VolumeStatisticsData data;
+
+  dealii::SmartPointer<NavierStokesOperator const> navier_stokes_operator;
+
+  unsigned int number_of_samples;
+
+  // mean velocity <u_i> and mean pressure <p>
+  VectorType mean_velocity;
+  VectorType mean_pressure;
+
+  // Reynolds stresses <u_i'u_j'> ordered as (11, 22, 33, 12, 13, 23) in 3D and (11, 22, 12) in 2D
+  std::vector<VectorType>                            reynolds_stresses;
+  std::vector<std::pair<unsigned int, unsigned int>> stress_components;
+
+  // variance of pressure <p'p'>
+  VectorType pressure_variance;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_VOLUME_STATISTICS_CALCULATOR_H_ \
+        */
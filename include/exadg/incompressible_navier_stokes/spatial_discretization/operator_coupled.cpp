@@ -100,6 +100,7 @@ OperatorCoupled<dim, Number>::initialize_solver_coupled()
     solver_data.max_iter             = this->param.solver_data_coupled.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_coupled.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_coupled.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_coupled.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_coupled.max_krylov_size;
     solver_data.compute_eigenvalues  = false;
 
@@ -118,6 +119,7 @@ OperatorCoupled<dim, Number>::initialize_solver_coupled()
     solver_data.max_iter             = this->param.solver_data_coupled.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_coupled.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_coupled.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_coupled.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_coupled.max_krylov_size;
 
     if(this->param.preconditioner_coupled != PreconditionerCoupled::None)
@@ -159,6 +159,7 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_solver()
     solver_data.max_iter             = this->param.solver_data_viscous.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_viscous.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_viscous.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_viscous.n_projection_vectors;
 
     if(this->param.preconditioner_viscous == PreconditionerViscous::PointJacobi ||
        this->param.preconditioner_viscous == PreconditionerViscous::BlockJacobi ||
@@ -179,6 +180,7 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_solver()
     solver_data.max_iter             = this->param.solver_data_viscous.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_viscous.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_viscous.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_viscous.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_viscous.max_krylov_size;
     // use default value of compute_eigenvalues
 
@@ -201,6 +203,7 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_solver()
     solver_data.max_iter             = this->param.solver_data_viscous.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_viscous.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_viscous.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_viscous.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_viscous.max_krylov_size;
 
     if(this->param.preconditioner_viscous == PreconditionerViscous::PointJacobi ||
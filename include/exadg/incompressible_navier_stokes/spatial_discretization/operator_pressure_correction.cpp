@@ -166,6 +166,7 @@ OperatorPressureCorrection<dim, Number>::initialize_momentum_solver()
     solver_data.max_iter             = this->param.solver_data_momentum.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_momentum.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_momentum.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_momentum.n_projection_vectors;
     if(this->param.preconditioner_momentum != MomentumPreconditioner::None)
       solver_data.use_preconditioner = true;
 
@@ -181,6 +182,7 @@ OperatorPressureCorrection<dim, Number>::initialize_momentum_solver()
     solver_data.max_iter             = this->param.solver_data_momentum.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_momentum.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_momentum.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_momentum.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_momentum.max_krylov_size;
     solver_data.compute_eigenvalues  = false;
     if(this->param.preconditioner_momentum != MomentumPreconditioner::None)
@@ -197,6 +199,7 @@ OperatorPressureCorrection<dim, Number>::initialize_momentum_solver()
     solver_data.max_iter             = this->param.solver_data_momentum.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_momentum.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_momentum.rel_tol;
+    solver_data.n_projection_vectors = this->param.solver_data_momentum.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_momentum.max_krylov_size;
     if(this->param.preconditioner_momentum != MomentumPreconditioner::None)
       solver_data.use_preconditioner = true;
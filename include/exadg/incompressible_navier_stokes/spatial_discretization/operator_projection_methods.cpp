@@ -22,6 +22,8 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_projection_methods.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/fused_cg.h>
+#include <exadg/solvers_and_preconditioners/solvers/pipelined_cg.h>
 #include <exadg/solvers_and_preconditioners/utilities/check_multigrid.h>
 
 namespace ExaDG
@@ -201,6 +203,8 @@ OperatorProjectionMethods<dim, Number>::initialize_solver_pressure_poisson()
     solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.n_projection_vectors =
+      this->param.solver_data_pressure_poisson.n_projection_vectors;
     // use default value of update_preconditioner (=false)
 
     if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
@@ -216,12 +220,62 @@ OperatorProjectionMethods<dim, Number>::initialize_solver_pressure_poisson()
                                                      *preconditioner_pressure_poisson,
                                                      solver_data);
   }
+  else if(this->param.solver_pressure_poisson == SolverPressurePoisson::PipelinedCG)
+  {
+    // setup solver data
+    Krylov::SolverDataCG solver_data;
+    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.n_projection_vectors =
+      this->param.solver_data_pressure_poisson.n_projection_vectors;
+    // use default value of update_preconditioner (=false)
+
+    if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
+    {
+      solver_data.use_preconditioner = true;
+    }
+
+    // setup solver
+    pressure_poisson_solver =
+      std::make_shared<Krylov::SolverPipelinedCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                                 PreconditionerBase<Number>,
+                                                 VectorType>>(laplace_operator,
+                                                              *preconditioner_pressure_poisson,
+                                                              solver_data);
+  }
+  else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FusedCG)
+  {
+    // setup solver data
+    Krylov::SolverDataCG solver_data;
+    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.n_projection_vectors =
+      this->param.solver_data_pressure_poisson.n_projection_vectors;
+    // use default value of update_preconditioner (=false)
+
+    if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
+    {
+      solver_data.use_preconditioner = true;
+    }
+
+    // setup solver
+    pressure_poisson_solver =
+      std::make_shared<Krylov::SolverCGFused<Poisson::LaplaceOperator<dim, Number, 1>,
+                                             PreconditionerBase<Number>,
+                                             VectorType>>(laplace_operator,
+                                                          *preconditioner_pressure_poisson,
+                                                          solver_data);
+  }
   else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FGMRES)
   {
     Krylov::SolverDataFGMRES solver_data;
     solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
     solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
     solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.n_projection_vectors =
+      this->param.solver_data_pressure_poisson.n_projection_vectors;
     solver_data.max_n_tmp_vectors    = this->param.solver_data_pressure_poisson.max_krylov_size;
     // use default value of update_preconditioner (=false)
 
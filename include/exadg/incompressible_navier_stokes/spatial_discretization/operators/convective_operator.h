@@ -12,6 +12,7 @@
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/operator_base.h>
+#include <exadg/operators/thread_local_ptr.h>
 
 namespace ExaDG
 {
@@ -69,19 +70,24 @@ public:
     this->data = data;
 
     // integrators for linearized problem
-    integrator_velocity =
-      std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index_linearized);
-    integrator_velocity_m =
-      std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index_linearized);
-    integrator_velocity_p =
-      std::make_shared<IntegratorFace>(matrix_free, false, dof_index, quad_index_linearized);
+    integrator_velocity.reset(
+      std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index_linearized),
+      matrix_free);
+    integrator_velocity_m.reset(
+      std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index_linearized),
+      matrix_free);
+    integrator_velocity_p.reset(
+      std::make_shared<IntegratorFace>(matrix_free, false, dof_index, quad_index_linearized),
+      matrix_free);
 
     if(data.ale)
     {
-      integrator_grid_velocity =
-        std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index_linearized);
-      integrator_grid_velocity_face =
-        std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index_linearized);
+      integrator_grid_velocity.reset(
+        std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index_linearized),
+        matrix_free);
+      integrator_grid_velocity_face.reset(
+        std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index_linearized),
+        matrix_free);
     }
 
     // use own storage of velocity vector only in case of multigrid
@@ -918,12 +924,14 @@ private:
   mutable lazy_ptr<VectorType> velocity;
   mutable VectorType           grid_velocity;
 
-  std::shared_ptr<IntegratorCell> integrator_velocity;
-  std::shared_ptr<IntegratorFace> integrator_velocity_m;
-  std::shared_ptr<IntegratorFace> integrator_velocity_p;
+  // integrators evaluating the linearization velocity on the current cell or face, one per thread
+  // if the matrix-free loops are executed task-parallel
+  thread_local_ptr<IntegratorCell> integrator_velocity;
+  thread_local_ptr<IntegratorFace> integrator_velocity_m;
+  thread_local_ptr<IntegratorFace> integrator_velocity_p;
 
-  std::shared_ptr<IntegratorCell> integrator_grid_velocity;
-  std::shared_ptr<IntegratorFace> integrator_grid_velocity_face;
+  thread_local_ptr<IntegratorCell> integrator_grid_velocity;
+  thread_local_ptr<IntegratorFace> integrator_grid_velocity_face;
 };
 
 
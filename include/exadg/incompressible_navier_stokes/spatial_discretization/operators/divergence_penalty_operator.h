@@ -204,7 +204,9 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current cell, set in reinit_cell(). It is stored per thread so
+  // that the kernel can be used in task-parallel matrix-free loops.
+  static inline thread_local scalar tau;
 };
 
 } // namespace Operators
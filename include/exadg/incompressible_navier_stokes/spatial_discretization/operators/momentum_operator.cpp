@@ -165,6 +165,26 @@ MomentumOperator<dim, Number>::set_scaling_factor_mass_operator(Number const & n
   this->scaling_factor_mass = number;
 }
 
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::get_fast_diagonalization_coefficients(double & mass_factor,
+                                                                     double & diffusivity,
+                                                                     double & IP_factor) const
+{
+  mass_factor = operator_data.unsteady_problem ? scaling_factor_mass : 0.0;
+
+  if(operator_data.viscous_problem)
+  {
+    diffusivity = viscous_kernel->get_data().viscosity;
+    IP_factor   = viscous_kernel->get_data().IP_factor;
+  }
+  else
+  {
+    diffusivity = 0.0;
+    IP_factor   = 0.0;
+  }
+}
+
 template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::rhs(VectorType & dst) const
@@ -165,6 +165,13 @@ private:
                        OperatorType const &               operator_type,
                        dealii::types::boundary_id const & boundary_id) const;
 
+  // The convective term is neglected and the viscous term is approximated by a Laplace operator
+  // with constant viscosity.
+  void
+  get_fast_diagonalization_coefficients(double & mass_factor,
+                                        double & diffusivity,
+                                        double & IP_factor) const;
+
   MomentumOperatorData<dim> operator_data;
 
   std::shared_ptr<MassKernel<dim, Number>>                  mass_kernel;
@@ -24,7 +24,7 @@ RHSOperator<dim, Number>::initialize(dealii::MatrixFree<dim, Number> const & mat
   this->matrix_free = &matrix_free_in;
   this->data        = data_in;
 
-  kernel.reinit(data.kernel_data);
+  kernel.reinit(matrix_free_in, data.kernel_data, data.quad_index);
 }
 
 template<int dim, typename Number>
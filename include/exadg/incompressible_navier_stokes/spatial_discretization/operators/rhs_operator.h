@@ -9,6 +9,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_RHS_OPERATOR_H_
 
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/functions_and_boundary_conditions/quadrature_values_cache.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/mapping_flags.h>
 
@@ -25,7 +26,8 @@ struct RHSKernelData
     : boussinesq_term(false),
       boussinesq_dynamic_part_only(false),
       thermal_expansion_coefficient(1.0),
-      reference_temperature(0.0)
+      reference_temperature(0.0),
+      use_cache(false)
   {
   }
 
@@ -37,6 +39,9 @@ struct RHSKernelData
   double                                 thermal_expansion_coefficient;
   double                                 reference_temperature;
   std::shared_ptr<dealii::Function<dim>> gravitational_force;
+
+  // store values of f and gravitational force at quadrature points
+  bool use_cache;
 };
 
 template<int dim, typename Number>
@@ -51,9 +56,19 @@ private:
 
 public:
   void
-  reinit(RHSKernelData<dim> const & data_in) const
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
+         RHSKernelData<dim> const &              data_in,
+         unsigned int const                      quad_index)
   {
     data = data_in;
+
+    if(data.use_cache)
+    {
+      cache_f.reinit(matrix_free, quad_index);
+
+      if(data.boussinesq_term)
+        cache_gravitational_force.reinit(matrix_free, quad_index);
+    }
   }
 
   static MappingFlags
@@ -79,13 +94,12 @@ public:
                     unsigned int const       q,
                     Number const &           time) const
   {
-    dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
-
-    vector f = FunctionEvaluator<1, dim, Number>::value(data.f, q_points, time);
+    vector f = evaluate_function(cache_f, data.f, integrator, q, time);
 
     if(data.boussinesq_term)
     {
-      vector g = FunctionEvaluator<1, dim, Number>::value(data.gravitational_force, q_points, time);
+      vector g = evaluate_function(
+        cache_gravitational_force, data.gravitational_force, integrator, q, time);
       scalar T = integrator_temperature.get_value(q);
       scalar T_ref = data.reference_temperature;
       // solve only for the dynamic pressure variations
@@ -99,7 +113,26 @@ public:
   }
 
 private:
-  mutable RHSKernelData<dim> data;
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    evaluate_function(QuadratureValuesCache<1, dim, Number> const &  cache,
+                      std::shared_ptr<dealii::Function<dim>> const & function,
+                      Integrator const &                             integrator,
+                      unsigned int const                             q,
+                      Number const &                                 time) const
+  {
+    if(data.use_cache)
+      return cache.get_value_cell(function, integrator, q, time);
+    else
+      return FunctionEvaluator<1, dim, Number>::value(function,
+                                                      integrator.quadrature_point(q),
+                                                      time);
+  }
+
+  RHSKernelData<dim> data;
+
+  QuadratureValuesCache<1, dim, Number> cache_f;
+  QuadratureValuesCache<1, dim, Number> cache_gravitational_force;
 };
 
 } // namespace Operators
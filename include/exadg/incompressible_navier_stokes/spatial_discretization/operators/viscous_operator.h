@@ -55,7 +55,7 @@ private:
   typedef FaceIntegrator<dim, dim, Number> IntegratorFace;
 
 public:
-  ViscousKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  ViscousKernel() : degree(1)
   {
   }
 
@@ -491,7 +491,9 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, set in reinit_face*(). It is stored per thread so
+  // that the kernel can be used in task-parallel matrix-free loops.
+  static inline thread_local scalar tau;
 
   VariableCoefficients<dim, Number> viscosity_coefficients;
 };
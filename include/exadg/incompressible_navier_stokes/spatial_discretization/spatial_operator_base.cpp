@@ -29,6 +29,7 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/pipelined_cg.h>
 #include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
@@ -348,6 +349,7 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   rhs_data.kernel_data.thermal_expansion_coefficient = param.thermal_expansion_coefficient;
   rhs_data.kernel_data.reference_temperature         = param.reference_temperature;
   rhs_data.kernel_data.gravitational_force           = field_functions->gravitational_force;
+  rhs_data.kernel_data.use_cache                     = param.cache_analytical_functions;
 
   rhs_operator.initialize(*matrix_free, rhs_data);
 
@@ -419,6 +421,8 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   data.use_cell_based_loops = param.use_cell_based_face_loops;
   data.implement_block_diagonal_preconditioner_matrix_free =
     param.implement_block_diagonal_preconditioner_matrix_free;
+  data.implement_block_diagonal_preconditioner_fast_diagonalization =
+    param.implement_block_diagonal_preconditioner_fast_diagonalization;
   if(data.convective_problem)
     data.solver_block_diagonal = Elementwise::Solver::GMRES;
   else
@@ -1509,6 +1513,7 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
       solver_data.max_iter             = param.solver_data_projection.max_iter;
       solver_data.solver_tolerance_abs = param.solver_data_projection.abs_tol;
       solver_data.solver_tolerance_rel = param.solver_data_projection.rel_tol;
+      solver_data.n_projection_vectors = param.solver_data_projection.n_projection_vectors;
       // default value of use_preconditioner = false
       if(param.preconditioner_projection != PreconditionerProjection::None)
       {
@@ -1520,6 +1525,25 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
         std::make_shared<Krylov::SolverCG<ProjOperator, PreconditionerBase<Number>, VectorType>>(
           *projection_operator, *preconditioner_projection, solver_data);
     }
+    else if(param.solver_projection == SolverProjection::PipelinedCG)
+    {
+      // setup solver data
+      Krylov::SolverDataCG solver_data;
+      solver_data.max_iter             = param.solver_data_projection.max_iter;
+      solver_data.solver_tolerance_abs = param.solver_data_projection.abs_tol;
+      solver_data.solver_tolerance_rel = param.solver_data_projection.rel_tol;
+      solver_data.n_projection_vectors = param.solver_data_projection.n_projection_vectors;
+      // default value of use_preconditioner = false
+      if(param.preconditioner_projection != PreconditionerProjection::None)
+      {
+        solver_data.use_preconditioner = true;
+      }
+
+      // setup solver
+      projection_solver = std::make_shared<
+        Krylov::SolverPipelinedCG<ProjOperator, PreconditionerBase<Number>, VectorType>>(
+        *projection_operator, *preconditioner_projection, solver_data);
+    }
     else if(param.solver_projection == SolverProjection::FGMRES)
     {
       // setup solver data
@@ -1527,6 +1551,7 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
       solver_data.max_iter             = param.solver_data_projection.max_iter;
       solver_data.solver_tolerance_abs = param.solver_data_projection.abs_tol;
       solver_data.solver_tolerance_rel = param.solver_data_projection.rel_tol;
+      solver_data.n_projection_vectors = param.solver_data_projection.n_projection_vectors;
       solver_data.max_n_tmp_vectors    = param.solver_data_projection.max_krylov_size;
 
       // default value of use_preconditioner = false
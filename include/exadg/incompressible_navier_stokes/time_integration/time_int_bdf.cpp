@@ -204,7 +204,33 @@ TimeIntBDF<dim, Number>::initialize_oif()
     convective_operator_OIF = std::make_shared<OperatorOIF<dim, Number>>(operator_base);
 
     // initialize OIF time integrator
-    if(param.time_integrator_oif == IncNS::TimeIntegratorOIF::ExplRK1Stage1)
+    if(param.embedded_error_control.active)
+    {
+      // embedded error control requires the low-storage schemes with embedded weights
+      if(param.time_integrator_oif == IncNS::TimeIntegratorOIF::ExplRK3Stage4Reg2C)
+      {
+        time_integrator_OIF =
+          std::make_shared<LowStorageRKReg2Embedded<OperatorOIF<dim, Number>, VectorType>>(
+            convective_operator_OIF, 3, 4);
+      }
+      else if(param.time_integrator_oif == IncNS::TimeIntegratorOIF::ExplRK4Stage5Reg2C)
+      {
+        time_integrator_OIF =
+          std::make_shared<LowStorageRKReg2Embedded<OperatorOIF<dim, Number>, VectorType>>(
+            convective_operator_OIF, 4, 5);
+      }
+      else
+      {
+        AssertThrow(false,
+                    dealii::ExcMessage("Embedded error control is not available for the "
+                                       "specified time integration scheme."));
+      }
+
+      this->oif_error_controller =
+        std::make_shared<PIController>(param.embedded_error_control,
+                                       time_integrator_OIF->get_order_embedded_scheme());
+    }
+    else if(param.time_integrator_oif == IncNS::TimeIntegratorOIF::ExplRK1Stage1)
     {
       time_integrator_OIF =
         std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorOIF<dim, Number>, VectorType>>(
@@ -274,18 +300,30 @@ TimeIntBDF<dim, Number>::initialize_oif()
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDF<dim, Number>::read_restart_preamble(boost::archive::binary_iarchive & ia)
+{
+  Base::read_restart_preamble(ia);
+
+  postprocessor->read_restart_preamble(ia);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::read_restart_vectors(CollectiveRestartFile & file)
 {
+  dealii::DoFHandler<dim> const & dof_handler_u = operator_base->get_dof_handler_u();
+  dealii::DoFHandler<dim> const & dof_handler_p = operator_base->get_dof_handler_p();
+
   for(unsigned int i = 0; i < this->order; i++)
   {
     VectorType tmp = get_velocity(i);
-    ia >> tmp;
+    file.read_vector(tmp, dof_handler_u);
     set_velocity(tmp, i);
   }
   for(unsigned int i = 0; i < this->order; i++)
   {
     VectorType tmp = get_pressure(i);
-    ia >> tmp;
+    file.read_vector(tmp, dof_handler_p);
     set_pressure(tmp, i);
   }
 
@@ -296,7 +334,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        file.read_vector(vec_convective_term[i], dof_handler_u);
       }
     }
   }
@@ -305,22 +343,36 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      ia >> vec_grid_coordinates[i];
+      file.read_vector(vec_grid_coordinates[i], dof_handler_u);
     }
   }
+
+  postprocessor->read_restart_vectors(file);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::write_restart_preamble(boost::archive::binary_oarchive & oa) const
+{
+  Base::write_restart_preamble(oa);
+
+  postprocessor->write_restart_preamble(oa);
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
+TimeIntBDF<dim, Number>::write_restart_vectors(CollectiveRestartFile & file) const
 {
+  dealii::DoFHandler<dim> const & dof_handler_u = operator_base->get_dof_handler_u();
+  dealii::DoFHandler<dim> const & dof_handler_p = operator_base->get_dof_handler_p();
+
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << get_velocity(i);
+    file.write_vector(get_velocity(i), dof_handler_u);
   }
   for(unsigned int i = 0; i < this->order; i++)
   {
-    oa << get_pressure(i);
+    file.write_vector(get_pressure(i), dof_handler_p);
   }
 
   if(this->param.convective_problem() &&
@@ -330,7 +382,7 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        file.write_vector(vec_convective_term[i], dof_handler_u);
       }
     }
   }
@@ -339,9 +391,11 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
   {
     for(unsigned int i = 0; i < vec_grid_coordinates.size(); i++)
     {
-      oa << vec_grid_coordinates[i];
+      file.write_vector(vec_grid_coordinates[i], dof_handler_u);
     }
   }
+
+  postprocessor->write_restart_vectors(file);
 }
 
 template<int dim, typename Number>
@@ -595,6 +649,20 @@ TimeIntBDF<dim, Number>::do_timestep_oif_substepping(VectorType & solution_tilde
                                       time_step_size);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::do_timestep_oif_substepping_with_error_estimate(
+  VectorType & solution_tilde_mp,
+  VectorType & solution_tilde_m,
+  VectorType & error,
+  double const start_time,
+  double const time_step_size)
+{
+  // solve sub-step and estimate error
+  time_integrator_OIF->solve_timestep_with_error_estimate(
+    solution_tilde_mp, solution_tilde_m, error, start_time, time_step_size);
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::postprocessing() const
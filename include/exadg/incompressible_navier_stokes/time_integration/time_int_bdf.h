@@ -104,10 +104,16 @@ protected:
   setup_derived() override;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) override;
+  read_restart_preamble(boost::archive::binary_iarchive & ia) override;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const override;
+  read_restart_vectors(CollectiveRestartFile & file) override;
+
+  void
+  write_restart_preamble(boost::archive::binary_oarchive & oa) const override;
+
+  void
+  write_restart_vectors(CollectiveRestartFile & file) const override;
 
   void
   prepare_vectors_for_next_timestep() override;
@@ -165,6 +171,13 @@ private:
                               double const start_time,
                               double const time_step_size) final;
 
+  void
+  do_timestep_oif_substepping_with_error_estimate(VectorType & solution_tilde_mp,
+                                                  VectorType & solution_tilde_m,
+                                                  VectorType & error,
+                                                  double const start_time,
+                                                  double const time_step_size) final;
+
   double
   calculate_time_step_size() final;
 
@@ -89,26 +89,25 @@ TimeIntBDFDualSplitting<dim, Number>::setup_derived()
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(CollectiveRestartFile & file)
 {
-  Base::read_restart_vectors(ia);
+  Base::read_restart_vectors(file);
 
   for(unsigned int i = 0; i < velocity_dbc.size(); i++)
   {
-    ia >> velocity_dbc[i];
+    file.read_vector(velocity_dbc[i], pde_operator->get_dof_handler_u());
   }
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(
-  boost::archive::binary_oarchive & oa) const
+TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(CollectiveRestartFile & file) const
 {
-  Base::write_restart_vectors(oa);
+  Base::write_restart_vectors(file);
 
   for(unsigned int i = 0; i < velocity_dbc.size(); i++)
   {
-    oa << velocity_dbc[i];
+    file.write_vector(velocity_dbc[i], pde_operator->get_dof_handler_u());
   }
 }
 
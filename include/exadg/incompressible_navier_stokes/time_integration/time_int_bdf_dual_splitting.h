@@ -79,10 +79,10 @@ private:
   setup_derived() final;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) final;
+  read_restart_vectors(CollectiveRestartFile & file) final;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const final;
+  write_restart_vectors(CollectiveRestartFile & file) const final;
 
   void
   do_timestep_solve() final;
@@ -100,27 +100,26 @@ TimeIntBDFPressureCorrection<dim, Number>::setup_derived()
 
 template<int dim, typename Number>
 void
-TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(
-  boost::archive::binary_iarchive & ia)
+TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(CollectiveRestartFile & file)
 {
-  Base::read_restart_vectors(ia);
+  Base::read_restart_vectors(file);
 
   for(unsigned int i = 0; i < pressure_dbc.size(); i++)
   {
-    ia >> pressure_dbc[i];
+    file.read_vector(pressure_dbc[i], pde_operator->get_dof_handler_p());
   }
 }
 
 template<int dim, typename Number>
 void
 TimeIntBDFPressureCorrection<dim, Number>::write_restart_vectors(
-  boost::archive::binary_oarchive & oa) const
+  CollectiveRestartFile & file) const
 {
-  Base::write_restart_vectors(oa);
+  Base::write_restart_vectors(file);
 
   for(unsigned int i = 0; i < pressure_dbc.size(); i++)
   {
-    oa << pressure_dbc[i];
+    file.write_vector(pressure_dbc[i], pde_operator->get_dof_handler_p());
   }
 }
 
@@ -88,10 +88,10 @@ private:
   initialize_former_solutions() final;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) final;
+  read_restart_vectors(CollectiveRestartFile & file) final;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const final;
+  write_restart_vectors(CollectiveRestartFile & file) const final;
 
   void
   initialize_pressure_on_boundary();
@@ -606,6 +606,12 @@ enum_to_string(SolverPressurePoisson const enum_type)
     case SolverPressurePoisson::CG:
       string_type = "CG";
       break;
+    case SolverPressurePoisson::PipelinedCG:
+      string_type = "PipelinedCG";
+      break;
+    case SolverPressurePoisson::FusedCG:
+      string_type = "FusedCG";
+      break;
     case SolverPressurePoisson::FGMRES:
       string_type = "FGMRES";
       break;
@@ -651,6 +657,9 @@ enum_to_string(SolverProjection const enum_type)
     case SolverProjection::CG:
       string_type = "CG";
       break;
+    case SolverProjection::PipelinedCG:
+      string_type = "PipelinedCG";
+      break;
     case SolverProjection::FGMRES:
       string_type = "FGMRES";
       break;
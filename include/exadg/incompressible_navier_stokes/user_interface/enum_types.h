@@ -421,11 +421,18 @@ enum_to_string(QuadratureRuleLinearization const enum_type);
  *
  *  use CG (conjugate gradient) method as default. FGMRES might be necessary
  *  if a Krylov method is used inside the preconditioner (e.g., as multigrid
- *  smoother or as multigrid coarse grid solver)
+ *  smoother or as multigrid coarse grid solver). PipelinedCG is a variant of CG
+ *  with a single non-blocking global reduction per iteration that is overlapped
+ *  with the operator evaluation and the preconditioner, which might be
+ *  beneficial at the strong-scaling limit. FusedCG is a variant of CG where
+ *  the vector updates are fused into the matrix-free operator evaluation in
+ *  order to reduce memory transfer.
  */
 enum class SolverPressurePoisson
 {
   CG,
+  PipelinedCG,
+  FusedCG,
   FGMRES
 };
 
@@ -452,10 +459,14 @@ enum_to_string(PreconditionerPressurePoisson const enum_type);
  *  Type of projection solver
  *
  *  - use CG as default
+ *  - PipelinedCG: CG variant with a single non-blocking global reduction per
+ *    iteration (only relevant for global solvers, i.e. not for the elementwise
+ *    solution of the projection step)
  */
 enum class SolverProjection
 {
   CG,
+  PipelinedCG,
   FGMRES
 };
 
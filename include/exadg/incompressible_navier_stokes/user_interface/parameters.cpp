@@ -68,6 +68,7 @@ Parameters::Parameters()
     max_velocity(-1.),
     cfl(-1.),
     cfl_oif(-1.),
+    embedded_error_control(EmbeddedErrorControlData()),
     cfl_exponent_fe_degree_velocity(2.0),
     c_eff(-1.),
     time_step_size(-1.),
@@ -136,7 +137,9 @@ Parameters::Parameters()
 
     // NUMERICAL PARAMETERS
     implement_block_diagonal_preconditioner_matrix_free(false),
+    implement_block_diagonal_preconditioner_fast_diagonalization(false),
     use_cell_based_face_loops(false),
+    cache_analytical_functions(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
 
@@ -267,6 +270,10 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage(
                   "ALE formulation is not implemented for OIF substepping technique."));
 
+    AssertThrow(cache_analytical_functions == false,
+                dealii::ExcMessage(
+                  "Caching of analytical functions is not possible for moving meshes."));
+
     AssertThrow(
       convective_problem() == true,
       dealii::ExcMessage(
@@ -488,6 +495,15 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     AssertThrow(cfl > 0., dealii::ExcMessage("parameter must be defined"));
     AssertThrow(cfl_oif > 0., dealii::ExcMessage("parameter must be defined"));
 
+    if(embedded_error_control.active)
+    {
+      AssertThrow(time_integrator_oif == TimeIntegratorOIF::ExplRK3Stage4Reg2C ||
+                    time_integrator_oif == TimeIntegratorOIF::ExplRK4Stage5Reg2C,
+                  dealii::ExcMessage(
+                    "Embedded error control is only implemented for ExplRK3Stage4Reg2C and "
+                    "ExplRK4Stage5Reg2C."));
+    }
+
     AssertThrow(ale_formulation == false,
                 dealii::ExcMessage(
                   "ALE formulation is not implemented for OIF substepping technique."));
@@ -681,6 +697,8 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout,
                     "Time integrator for OIF splitting",
                     enum_to_string(time_integrator_oif));
+
+    embedded_error_control.print(pcout);
   }
 
   print_parameter(pcout,
@@ -840,8 +858,29 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
                   "Block Jacobi matrix-free",
                   implement_block_diagonal_preconditioner_matrix_free);
 
+  // the fast diagonalization variant is only used by block Jacobi preconditioners of the momentum
+  // operator, either as preconditioner of the Krylov solver or within multigrid smoothers
+  bool const block_jacobi_momentum =
+    preconditioner_viscous == PreconditionerViscous::BlockJacobi ||
+    preconditioner_momentum == MomentumPreconditioner::BlockJacobi ||
+    preconditioner_velocity_block == MomentumPreconditioner::BlockJacobi ||
+    multigrid_data_viscous.smoother_data.preconditioner == PreconditionerSmoother::BlockJacobi ||
+    multigrid_data_momentum.smoother_data.preconditioner == PreconditionerSmoother::BlockJacobi ||
+    multigrid_data_velocity_block.smoother_data.preconditioner ==
+      PreconditionerSmoother::BlockJacobi;
+
+  if(block_jacobi_momentum && implement_block_diagonal_preconditioner_fast_diagonalization)
+  {
+    print_parameter(pcout,
+                    "Block Jacobi fast diagonalization",
+                    implement_block_diagonal_preconditioner_fast_diagonalization);
+  }
+
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
 
+  if(cache_analytical_functions)
+    print_parameter(pcout, "Cache analytical functions", cache_analytical_functions);
+
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     solver_data_block_diagonal.print(pcout);
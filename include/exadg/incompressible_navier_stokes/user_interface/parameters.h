@@ -33,6 +33,7 @@
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
+#include <exadg/time_integration/embedded_error_control.h>
 #include <exadg/time_integration/enum_types.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
@@ -227,6 +228,11 @@ public:
   // critical time step size arising from the CFL restriction, cfl_oif <= cfl)
   double cfl_oif;
 
+  // adaptive OIF sub-stepping based on the error estimate of an embedded Runge-Kutta scheme, where
+  // the sub-step size according to cfl_oif is only used initially (only available for
+  // ExplRK3Stage4Reg2C and ExplRK4Stage5Reg2C)
+  EmbeddedErrorControlData embedded_error_control;
+
   // dt = CFL/k_u^{exp} * h / || u ||
   double cfl_exponent_fe_degree_velocity;
 
@@ -404,6 +410,14 @@ public:
   // the matrix-based variant should be used.
   bool implement_block_diagonal_preconditioner_matrix_free;
 
+  // Implement block diagonal (block Jacobi) preconditioner of the momentum operator by a
+  // separable approximation of the block Jacobi problems (mass and Laplace-type viscous terms on
+  // Cartesian cells with constant viscosity, neglecting the convective term) that is inverted by
+  // the fast diagonalization method. Only 1D matrices are stored and the inverse is applied with
+  // O(p^{d+1}) operations per cell, making this variant attractive for high polynomial degrees.
+  // If true, this variant takes precedence over the matrix-free and matrix-based variants.
+  bool implement_block_diagonal_preconditioner_fast_diagonalization;
+
   // By default, the matrix-free implementation performs separate loops over all cells,
   // interior faces, and boundary faces. For a certain type of operations, however, it
   // is necessary to perform the face-loop as a loop over all faces of a cell with an
@@ -412,6 +426,11 @@ public:
   // can be changed to such an algorithm (cell_based_face_loops).
   bool use_cell_based_face_loops;
 
+  // Store the values of analytical functions (body force, gravitational force) at the quadrature
+  // points and re-evaluate them only if the time changes. Functions of type FunctionSeparable are
+  // evaluated only once. This option can not be used in combination with moving meshes.
+  bool cache_analytical_functions;
+
   // Solver data for block Jacobi preconditioner. Accordingly, this parameter is only
   // relevant if the block diagonal preconditioner is implemented in a matrix-free way
   // using an elementwise iterative solution procedure for which solver tolerances have to
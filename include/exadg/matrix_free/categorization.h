@@ -99,6 +99,29 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
     data.mapping_update_flags_inner_faces | data.mapping_update_flags_boundary_faces;
 }
 
+/*
+ * Adjust MatrixFree::AdditionalData such that cells of different step size classes of a multirate
+ * time integrator are put into different categories, i.e. each cell batch contains only cells of
+ * the same class (see calculate_step_size_classes()).
+ */
+template<int dim, typename AdditionalData>
+void
+do_step_size_classes(dealii::Triangulation<dim> const & tria,
+                     AdditionalData &                   data,
+                     std::vector<unsigned int> const &  cell_classes)
+{
+  data.cell_vectorization_category.resize(tria.n_active_cells());
+
+  for(auto cell = tria.begin_active(); cell != tria.end(); ++cell)
+  {
+    if(cell->is_locally_owned())
+      data.cell_vectorization_category[cell->active_cell_index()] =
+        cell_classes[cell->active_cell_index()];
+  }
+
+  data.cell_vectorization_categories_strict = true;
+}
+
 } // namespace Categorization
 } // namespace ExaDG
 
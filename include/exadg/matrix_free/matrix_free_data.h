@@ -23,6 +23,7 @@
 #define INCLUDE_FUNCTIONALITIES_MATRIX_FREE_DATA_H_
 
 // deal.II
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/dofs/dof_handler.h>
@@ -39,12 +40,27 @@ template<int dim, typename Number>
 struct MatrixFreeData
 {
 public:
+  typedef typename dealii::MatrixFree<dim, Number>::AdditionalData::TasksParallelScheme
+    TasksParallelScheme;
+
   /**
-   * Default constructor.
+   * Default constructor. By default, the matrix-free loops are executed task-parallel within an
+   * MPI process if more than one thread is available, see GeneralParameters::n_threads, and
+   * without task parallelism otherwise.
    */
-  MatrixFreeData()
+  MatrixFreeData(
+    TasksParallelScheme const tasks_parallel_scheme = get_default_tasks_parallel_scheme())
   {
-    data.tasks_parallel_scheme = dealii::MatrixFree<dim, Number>::AdditionalData::none;
+    data.tasks_parallel_scheme = tasks_parallel_scheme;
+  }
+
+  static TasksParallelScheme
+  get_default_tasks_parallel_scheme()
+  {
+    if(dealii::MultithreadInfo::n_threads() > 1)
+      return dealii::MatrixFree<dim, Number>::AdditionalData::partition_partition;
+    else
+      return dealii::MatrixFree<dim, Number>::AdditionalData::none;
   }
 
   /**
@@ -0,0 +1,311 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_STEP_SIZE_CLASSES_H_
+#define INCLUDE_EXADG_MATRIX_FREE_STEP_SIZE_CLASSES_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/grid/calculate_characteristic_element_length.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Assigns each cell to a step size class
+ *
+ *   c = min(n_classes - 1, floor(log2(h / h_min))) ,
+ *
+ * where h is the minimum vertex distance of the cell and h_min the global minimum over all cells,
+ * so that the stable time step size of class c is (at least) 2^c times the stable time step size
+ * of the finest cells. The returned vector is indexed by the active cell index and filled for
+ * locally owned and ghost cells.
+ */
+template<int dim>
+std::vector<unsigned int>
+calculate_step_size_classes(dealii::Triangulation<dim> const & triangulation,
+                            unsigned int const                 n_classes,
+                            MPI_Comm const &                   mpi_comm)
+{
+  AssertThrow(n_classes >= 1 && n_classes <= 32,
+              dealii::ExcMessage("The number of step size classes has to be in [1,32]."));
+
+  double const h_min = calculate_minimum_vertex_distance(triangulation, mpi_comm);
+
+  std::vector<unsigned int> cell_classes(triangulation.n_active_cells(), 0);
+
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned() || cell->is_ghost())
+    {
+      // add a small tolerance to obtain the same class for cells of the same size
+      double const ratio = cell->minimum_vertex_distance() / h_min * (1.0 + 1.e-10);
+
+      unsigned int const c = static_cast<unsigned int>(std::floor(std::log2(ratio)));
+
+      cell_classes[cell->active_cell_index()] = std::min(c, n_classes - 1);
+    }
+  }
+
+  return cell_classes;
+}
+
+/*
+ * This class splits the loops of the matrix-free operator evaluation into step size classes of a
+ * multirate time integrator, i.e. it realizes R = sum_c R^{(c)}, where R^{(c)} contains the cell
+ * integrals of the cells of class c and the face integrals of those faces for which the minimum
+ * class of the two adjacent cells equals c (boundary faces belong to the class of the interior
+ * cell). Since the face integrals are always added to both adjacent cells within the same R^{(c)},
+ * the splitting is conservative and no flux correction is needed at the interface between
+ * classes.
+ *
+ * The cell batches have to be categorized according to the step size classes (see
+ * Categorization::do_step_size_classes()) so that all cells of a cell batch belong to the same
+ * class. Face batches may contain faces of different classes, in which case the contributions of
+ * the lanes not selected are masked out before the integration.
+ *
+ * By default, all classes are selected so that an operator evaluation is not affected.
+ */
+template<int dim, typename Number>
+class StepSizeClasses
+{
+public:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  StepSizeClasses() : n_classes(1), first_selected(0), last_selected(0), selected_bits(1)
+  {
+  }
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
+             unsigned int const                      dof_index,
+             unsigned int const                      n_classes_in,
+             std::vector<unsigned int> const &       cell_classes)
+  {
+    n_classes = n_classes_in;
+
+    unsigned int const n_lanes = scalar::size();
+
+    auto const get_class = [&](auto const & cell) {
+      return cell_classes[cell->active_cell_index()];
+    };
+
+    // cell batches
+    cell_batch_class.resize(matrix_free.n_cell_batches());
+    cell_batch_touched.resize(matrix_free.n_cell_batches());
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      cell_batch_class[cell] = get_class(matrix_free.get_cell_iterator(cell, 0, dof_index));
+
+      for(unsigned int v = 1; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        AssertThrow(
+          get_class(matrix_free.get_cell_iterator(cell, v, dof_index)) == cell_batch_class[cell],
+          dealii::ExcMessage("A cell batch contains cells of different step size classes. The "
+                             "cells have to be categorized according to the step size classes."));
+      }
+
+      cell_batch_touched[cell] = 1u << cell_batch_class[cell];
+    }
+
+    // inner and boundary face batches
+    unsigned int const n_faces =
+      matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+
+    face_lane_class.resize(n_faces);
+    face_batch_classes.resize(n_faces);
+    for(unsigned int face = 0; face < n_faces; ++face)
+    {
+      bool const is_inner_face = face < matrix_free.n_inner_face_batches();
+
+      face_batch_classes[face] = 0;
+      face_lane_class[face].fill(dealii::numbers::invalid_unsigned_int);
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+      {
+        unsigned int c = get_class(matrix_free.get_face_iterator(face, v, true, dof_index).first);
+        if(is_inner_face)
+        {
+          unsigned int const c_p =
+            get_class(matrix_free.get_face_iterator(face, v, false, dof_index).first);
+          c = std::min(c, c_p);
+        }
+
+        face_lane_class[face][v] = c;
+        face_batch_classes[face] |= 1u << c;
+
+        // the inverse mass operator has to be applied to the cells touched by this face
+        unsigned int const cell_m = matrix_free.get_face_info(face).cells_interior[v] / n_lanes;
+        if(cell_m < cell_batch_touched.size())
+          cell_batch_touched[cell_m] |= 1u << c;
+
+        if(is_inner_face)
+        {
+          unsigned int const cell_p = matrix_free.get_face_info(face).cells_exterior[v] / n_lanes;
+          if(cell_p < cell_batch_touched.size())
+            cell_batch_touched[cell_p] |= 1u << c;
+        }
+      }
+    }
+
+    select_all_classes();
+  }
+
+  /*
+   * Restricts subsequent operator evaluations to the classes first, ..., last.
+   */
+  void
+  select_classes(unsigned int const first, unsigned int const last) const
+  {
+    AssertThrow(first <= last && last < n_classes,
+                dealii::ExcMessage("Invalid range of step size classes."));
+
+    first_selected = first;
+    last_selected  = last;
+    selected_bits  = ((last + 1 < 32) ? (1u << (last + 1)) : 0u) - (1u << first);
+  }
+
+  void
+  select_all_classes() const
+  {
+    select_classes(0, n_classes - 1);
+  }
+
+  unsigned int
+  get_n_classes() const
+  {
+    return n_classes;
+  }
+
+  bool
+  cell_batch_is_selected(unsigned int const cell) const
+  {
+    return cell_batch_class[cell] >= first_selected && cell_batch_class[cell] <= last_selected;
+  }
+
+  /*
+   * Returns true if the result of the selected classes is non-zero on the given cell batch, i.e.
+   * if the cell batch belongs to a selected class or if it is adjacent to a selected face.
+   */
+  bool
+  cell_batch_is_touched(unsigned int const cell) const
+  {
+    return (cell_batch_touched[cell] & selected_bits) != 0;
+  }
+
+  bool
+  face_batch_is_selected(unsigned int const face) const
+  {
+    return (face_batch_classes[face] & selected_bits) != 0;
+  }
+
+  /*
+   * Sets the values and/or gradients submitted to the integrator to zero for those lanes of the
+   * face batch that do not belong to a selected class. Nothing is done if all faces of the batch
+   * are selected.
+   */
+  template<typename Integrator>
+  void
+  mask_face_batch(unsigned int const face,
+                  Integrator &       integrator,
+                  bool const         values,
+                  bool const         gradients) const
+  {
+    if((face_batch_classes[face] & ~selected_bits) == 0)
+      return;
+
+    scalar mask = 0.0;
+    for(unsigned int v = 0; v < scalar::size(); ++v)
+      if(face_lane_class[face][v] >= first_selected && face_lane_class[face][v] <= last_selected)
+        mask[v] = 1.0;
+
+    unsigned int const n_values = Integrator::n_components * integrator.n_q_points;
+
+    if(values)
+    {
+      scalar * value_ptr = integrator.begin_values();
+      for(unsigned int i = 0; i < n_values; ++i)
+        value_ptr[i] *= mask;
+    }
+
+    if(gradients)
+    {
+      scalar * gradient_ptr = integrator.begin_gradients();
+      for(unsigned int i = 0; i < dim * n_values; ++i)
+        gradient_ptr[i] *= mask;
+    }
+  }
+
+  /*
+   * Prints the number of cells per class and the theoretical speedup of a multirate scheme
+   * compared to a single-rate scheme using the time step size of the finest class, measured in
+   * terms of cell integrals per macro time step.
+   */
+  void
+  print_statistics(dealii::ConditionalOStream const & pcout,
+                   std::vector<unsigned int> const &  cell_classes,
+                   dealii::Triangulation<dim> const & triangulation,
+                   MPI_Comm const &                   mpi_comm) const
+  {
+    std::vector<double> n_cells_local(n_classes, 0.0);
+    for(auto const & cell : triangulation.active_cell_iterators())
+      if(cell->is_locally_owned())
+        n_cells_local[cell_classes[cell->active_cell_index()]] += 1.0;
+
+    std::vector<double> n_cells(n_classes, 0.0);
+    dealii::Utilities::MPI::sum(n_cells_local, mpi_comm, n_cells);
+
+    double work_single_rate = 0.0, work_multirate = 0.0;
+
+    pcout << std::endl << "Step size classes:" << std::endl << std::endl;
+    for(unsigned int c = 0; c < n_classes; ++c)
+    {
+      print_parameter(pcout, "Number of cells of class " + std::to_string(c), n_cells[c]);
+
+      work_single_rate += n_cells[c] * std::pow(2.0, n_classes - 1);
+      work_multirate += n_cells[c] * std::pow(2.0, n_classes - 1 - c);
+    }
+    print_parameter(pcout, "Theoretical speedup", work_single_rate / work_multirate);
+  }
+
+private:
+  unsigned int n_classes;
+
+  std::vector<unsigned int> cell_batch_class;
+
+  // bit c is set if the result of class c is non-zero on the cell batch
+  std::vector<unsigned int> cell_batch_touched;
+
+  std::vector<std::array<unsigned int, dealii::VectorizedArray<Number>::size()>> face_lane_class;
+
+  // bit c is set if the face batch contains a face of class c
+  std::vector<unsigned int> face_batch_classes;
+
+  mutable unsigned int first_selected, last_selected, selected_bits;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_STEP_SIZE_CLASSES_H_ */
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_OPERATORS_ELEMENTWISE_OPERATOR_H_
 #define INCLUDE_EXADG_OPERATORS_ELEMENTWISE_OPERATOR_H_
 
+// deal.II
+#include <deal.II/base/thread_local_storage.h>
+
+// ExaDG
 #include <exadg/solvers_and_preconditioners/solvers/elementwise_krylov_solvers.h>
 
 namespace ExaDG
@@ -57,9 +61,11 @@ public:
   void
   setup(unsigned int const cell, unsigned int const size)
   {
-    current_cell = cell;
+    current_cell.get() = cell;
 
-    problem_size = size;
+    // the problem size is the same for all cells, avoid concurrent writes in task-parallel loops
+    if(problem_size != size)
+      problem_size = size;
   }
 
   unsigned int
@@ -75,13 +81,14 @@ public:
     Elementwise::vector_init(dst, problem_size);
 
     // evaluate block diagonal
-    op.apply_add_block_diagonal_elementwise(current_cell, dst, src, problem_size);
+    op.apply_add_block_diagonal_elementwise(current_cell.get(), dst, src, problem_size);
   }
 
 private:
   Operator const & op;
 
-  unsigned int current_cell;
+  // the current cell is stored per thread for task-parallel matrix-free loops
+  mutable dealii::Threads::ThreadLocalStorage<unsigned int> current_cell;
 
   unsigned int problem_size;
 };
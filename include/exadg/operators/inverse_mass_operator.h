@@ -22,6 +22,12 @@
 #ifndef INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 #define INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 
+// C/C++
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/operators.h>
@@ -48,7 +54,8 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
-  InverseMassOperator() : matrix_free(nullptr), dof_index(0), quad_index(0)
+  InverseMassOperator()
+    : matrix_free(nullptr), dof_index(0), quad_index(0), dofs_are_numbered_cell_wise(false)
   {
   }
 
@@ -70,7 +77,236 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Same as apply(), but only for those cell batches for which is_selected(cell) returns true.
+   * The vector dst is not accessed on the remaining cell batches, which is used in case dst is
+   * known to be zero there (e.g. for dst = src).
+   */
+  template<typename Selector>
+  void
+  apply_selected(VectorType & dst, VectorType const & src, Selector const & is_selected) const
+  {
+    Integrator          integrator(*matrix_free, dof_index, quad_index);
+    CellwiseInverseMass inverse(integrator);
+
+    // the inverse mass operator is local to each cell, so that the ghost values are not needed
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      if(!is_selected(cell))
+        continue;
+
+      integrator.reinit(cell);
+      integrator.read_dof_values(src, 0);
+
+      inverse.apply(integrator.begin_dof_values(), integrator.begin_dof_values());
+
+      integrator.set_dof_values(dst, 0);
+    }
+  }
+
+  /*
+   * Applies the inverse mass operator to the vector rhs and performs the vector updates of a stage
+   * of a low-storage Runge-Kutta method with two registers in the same loop over all cells
+   *
+   *   k_i      = scaling * M^{-1} rhs ,
+   *   next_ri  = solution + factor_ai * k_i ,
+   *   solution = solution + factor_solution * k_i ,
+   *
+   * (fused inverse mass + register update), so that each vector is read or written only once by
+   * this function. The evaluation of rhs is not part of this loop. The vector next_ri is not
+   * accessed if update_next_ri is false (last stage). The vector k_i is not stored, and next_ri
+   * may be the vector at which the right-hand side rhs has been evaluated.
+   */
+  void
+  apply_and_update_low_storage_rk_stage(VectorType &       next_ri,
+                                        VectorType &       solution,
+                                        VectorType const & rhs,
+                                        Number const       scaling,
+                                        Number const       factor_solution,
+                                        Number const       factor_ai,
+                                        bool const         update_next_ri) const
+  {
+    Integrator          integrator(*matrix_free, dof_index, quad_index);
+    Integrator          integrator_solution(*matrix_free, dof_index, quad_index);
+    CellwiseInverseMass inverse(integrator);
+
+    // the vector updates are local to each cell, so that the ghost values are not needed
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      apply_and_update_low_storage_rk_stage_cell_batch(cell,
+                                                       integrator,
+                                                       integrator_solution,
+                                                       inverse,
+                                                       next_ri,
+                                                       solution,
+                                                       rhs,
+                                                       scaling,
+                                                       factor_solution,
+                                                       factor_ai,
+                                                       update_next_ri);
+    }
+  }
+
+  /*
+   * Sets up the data structures of get_low_storage_rk_stage_update_after_loop(). The fused
+   * variant is only available if the degrees of freedom of each locally owned cell are numbered
+   * contiguously, which is the case for discontinuous elements without renumbering.
+   */
+  void
+  initialize_low_storage_rk_stage_after_loop()
+  {
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free->get_dof_handler(dof_index);
+    dealii::Utilities::MPI::Partitioner const & partitioner =
+      *matrix_free->get_vector_partitioner(dof_index);
+
+    unsigned int const dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+    dofs_are_numbered_cell_wise = partitioner.locally_owned_size() % dofs_per_cell == 0;
+    cell_batch_of_cell.assign(partitioner.locally_owned_size() / dofs_per_cell,
+                              dealii::numbers::invalid_unsigned_int);
+
+    std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      {
+        matrix_free->get_cell_iterator(cell, v, dof_index)->get_dof_indices(dof_indices);
+
+        bool const         first_dof_is_local = partitioner.in_local_range(dof_indices[0]);
+        unsigned int const first_dof =
+          first_dof_is_local ? partitioner.global_to_local(dof_indices[0]) : 0;
+
+        dofs_are_numbered_cell_wise =
+          dofs_are_numbered_cell_wise && first_dof_is_local && first_dof % dofs_per_cell == 0;
+        for(unsigned int i = 0; i < dofs_per_cell; ++i)
+          dofs_are_numbered_cell_wise =
+            dofs_are_numbered_cell_wise && dof_indices[i] == dof_indices[0] + i;
+
+        if(!dofs_are_numbered_cell_wise)
+          return;
+
+        cell_batch_of_cell[first_dof / dofs_per_cell] = cell;
+      }
+    }
+
+    n_missing_dofs = std::vector<std::atomic<unsigned int>>(matrix_free->n_cell_batches());
+  }
+
+  bool
+  low_storage_rk_stage_can_be_fused() const
+  {
+    return dofs_are_numbered_cell_wise;
+  }
+
+  /*
+   * Returns an operation_after_loop for the matrix-free loop computing rhs (see MatrixFree::loop())
+   * that performs apply_and_update_low_storage_rk_stage() on each cell batch as soon as the loop
+   * has finished with all degrees of freedom of the cell batch, i.e., while rhs is still in cache,
+   * so that the separate loop over all cells is avoided. The vector next_ri may be the src vector
+   * of the loop, since the loop does not access src on a cell batch any more once the
+   * corresponding entries of rhs are final. The returned function has to be passed to a single
+   * loop. It requires initialize_low_storage_rk_stage_after_loop() and
+   * low_storage_rk_stage_can_be_fused().
+   */
+  std::function<void(unsigned int const, unsigned int const)>
+  get_low_storage_rk_stage_update_after_loop(VectorType &       next_ri,
+                                             VectorType &       solution,
+                                             VectorType const & rhs,
+                                             Number const       scaling,
+                                             Number const       factor_solution,
+                                             Number const       factor_ai,
+                                             bool const         update_next_ri) const
+  {
+    AssertThrow(dofs_are_numbered_cell_wise,
+                dealii::ExcMessage("The degrees of freedom are not numbered cell-wise."));
+
+    unsigned int const dofs_per_cell =
+      matrix_free->get_dof_handler(dof_index).get_fe().n_dofs_per_cell();
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      n_missing_dofs[cell] = matrix_free->n_active_entries_per_cell_batch(cell) * dofs_per_cell;
+
+    return [&, scaling, factor_solution, factor_ai, update_next_ri, dofs_per_cell](
+             unsigned int const begin, unsigned int const end) {
+      Integrator          integrator(*matrix_free, dof_index, quad_index);
+      Integrator          integrator_solution(*matrix_free, dof_index, quad_index);
+      CellwiseInverseMass inverse(integrator);
+
+      for(unsigned int c = begin / dofs_per_cell; c * dofs_per_cell < end; ++c)
+      {
+        unsigned int const n_dofs =
+          std::min(end, (c + 1) * dofs_per_cell) - std::max(begin, c * dofs_per_cell);
+        unsigned int const cell = cell_batch_of_cell[c];
+
+        // the range completing the last degrees of freedom of the cell batch performs the update
+        if(n_missing_dofs[cell].fetch_sub(n_dofs) == n_dofs)
+        {
+          apply_and_update_low_storage_rk_stage_cell_batch(cell,
+                                                           integrator,
+                                                           integrator_solution,
+                                                           inverse,
+                                                           next_ri,
+                                                           solution,
+                                                           rhs,
+                                                           scaling,
+                                                           factor_solution,
+                                                           factor_ai,
+                                                           update_next_ri);
+        }
+      }
+    };
+  }
+
 private:
+  void
+  apply_and_update_low_storage_rk_stage_cell_batch(unsigned int const          cell,
+                                                   Integrator &                integrator,
+                                                   Integrator &                integrator_solution,
+                                                   CellwiseInverseMass const & inverse,
+                                                   VectorType &                next_ri,
+                                                   VectorType &                solution,
+                                                   VectorType const &          rhs,
+                                                   Number const                scaling,
+                                                   Number const                factor_solution,
+                                                   Number const                factor_ai,
+                                                   bool const                  update_next_ri) const
+  {
+    unsigned int const dofs_per_cell = integrator.dofs_per_cell;
+
+    integrator.reinit(cell);
+    integrator.read_dof_values(rhs, 0);
+
+    inverse.apply(integrator.begin_dof_values(), integrator.begin_dof_values());
+
+    integrator_solution.reinit(cell);
+    integrator_solution.read_dof_values(solution, 0);
+
+    dealii::VectorizedArray<Number> * k_i = integrator.begin_dof_values();
+    dealii::VectorizedArray<Number> * u   = integrator_solution.begin_dof_values();
+
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+    {
+      k_i[i] *= scaling;
+
+      if(update_next_ri)
+      {
+        dealii::VectorizedArray<Number> const r = u[i] + factor_ai * k_i[i];
+
+        u[i] += factor_solution * k_i[i];
+        k_i[i] = r;
+      }
+      else
+      {
+        u[i] += factor_solution * k_i[i];
+      }
+    }
+
+    if(update_next_ri)
+      integrator.set_dof_values(next_ri, 0);
+
+    integrator_solution.set_dof_values(solution, 0);
+  }
+
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &,
             VectorType &       dst,
@@ -94,6 +330,13 @@ private:
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   unsigned int dof_index, quad_index;
+
+  // data of get_low_storage_rk_stage_update_after_loop(): the cell batch of each locally owned
+  // cell in the order of the degrees of freedom, and the number of degrees of freedom of each cell
+  // batch that are not final yet in the current loop
+  bool                                            dofs_are_numbered_cell_wise;
+  std::vector<unsigned int>                       cell_batch_of_cell;
+  mutable std::vector<std::atomic<unsigned int>> n_missing_dofs;
 };
 
 } // namespace ExaDG
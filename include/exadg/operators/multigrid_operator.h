@@ -134,6 +134,18 @@ public:
     pde_operator->apply_inverse_block_diagonal(dst, src);
   }
 
+  virtual void
+  update_vertex_patch_preconditioner() const
+  {
+    pde_operator->update_vertex_patch_preconditioner();
+  }
+
+  virtual void
+  apply_inverse_vertex_patch(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->apply_inverse_vertex_patch(dst, src);
+  }
+
 #ifdef DEAL_II_WITH_TRILINOS
   virtual void
   init_system_matrix(dealii::TrilinosWrappers::SparseMatrix & system_matrix,
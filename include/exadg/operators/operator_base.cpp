@@ -19,12 +19,17 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <map>
+
 // deal.II
 #include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_dgq.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/matrix_free/tools.h>
 
 // ExaDG
+#include <exadg/operators/interior_penalty_parameter.h>
 #include <exadg/operators/operator_base.h>
 #include <exadg/solvers_and_preconditioners/utilities/block_jacobi_matrices.h>
 #include <exadg/solvers_and_preconditioners/utilities/invert_diagonal.h>
@@ -42,6 +47,7 @@ OperatorBase<dim, Number, n_components>::OperatorBase()
     data(OperatorBaseData()),
     level(dealii::numbers::invalid_unsigned_int),
     block_diagonal_preconditioner_is_initialized(false),
+    compute_diagonal_column_by_column(false),
     n_mpi_processes(0)
 {
 }
@@ -69,17 +75,20 @@ OperatorBase<dim, Number, n_components>::reinit(
   // in 3D, and thus necessarily has dofs_per_vertex=0
   is_dg = (this->matrix_free->get_dof_handler(this->data.dof_index).get_fe().dofs_per_vertex == 0);
 
-  integrator   = std::make_shared<IntegratorCell>(*this->matrix_free,
-                                                this->data.dof_index,
-                                                this->data.quad_index);
-  integrator_m = std::make_shared<IntegratorFace>(*this->matrix_free,
-                                                  true,
-                                                  this->data.dof_index,
-                                                  this->data.quad_index);
-  integrator_p = std::make_shared<IntegratorFace>(*this->matrix_free,
-                                                  false,
-                                                  this->data.dof_index,
-                                                  this->data.quad_index);
+  integrator.reset(std::make_shared<IntegratorCell>(*this->matrix_free,
+                                                   this->data.dof_index,
+                                                   this->data.quad_index),
+                   *this->matrix_free);
+  integrator_m.reset(std::make_shared<IntegratorFace>(*this->matrix_free,
+                                                     true,
+                                                     this->data.dof_index,
+                                                     this->data.quad_index),
+                     *this->matrix_free);
+  integrator_p.reset(std::make_shared<IntegratorFace>(*this->matrix_free,
+                                                     false,
+                                                     this->data.dof_index,
+                                                     this->data.quad_index),
+                     *this->matrix_free);
 
   if(!is_dg)
   {
@@ -169,6 +178,52 @@ OperatorBase<dim, Number, n_components>::vmult(VectorType & dst, VectorType cons
   this->apply(dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::vmult(
+  VectorType &                                                        dst,
+  VectorType const &                                                  src,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop) const
+{
+  if(is_dg)
+  {
+    auto const before_loop = [&](unsigned int const begin, unsigned int const end) {
+      operation_before_loop(begin, end);
+
+      Number * const dst_ptr = dst.begin();
+      for(unsigned int i = begin; i < end; ++i)
+        dst_ptr[i] = Number(0.0);
+    };
+
+    if(evaluate_face_integrals())
+      matrix_free->loop(&This::cell_loop,
+                        &This::face_loop,
+                        &This::boundary_face_loop_hom_operator,
+                        this,
+                        dst,
+                        src,
+                        before_loop,
+                        operation_after_loop,
+                        get_dof_index());
+    else
+      matrix_free->cell_loop(
+        &This::cell_loop, this, dst, src, before_loop, operation_after_loop, get_dof_index());
+  }
+  else
+  {
+    // The treatment of constrained degrees of freedom in apply() requires access to the whole
+    // src vector before and after the loop, so that the operations can not be fused here.
+    unsigned int const size = dst.get_partitioner()->locally_owned_size();
+
+    operation_before_loop(0, size);
+
+    apply(dst, src);
+
+    operation_after_loop(0, size);
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::vmult_add(VectorType & dst, VectorType const & src) const
@@ -249,6 +304,7 @@ OperatorBase<dim, Number, n_components>::calculate_inverse_diagonal(VectorType &
   this->calculate_diagonal(diagonal);
 
   //  verify_calculation_of_diagonal(*this,diagonal);
+  //  verify_calculation_of_diagonal_sum_factorization(*this, mpi_comm);
 
   invert_diagonal(diagonal);
 }
@@ -414,6 +470,16 @@ OperatorBase<dim, Number, n_components>::calculate_diagonal(VectorType & diagona
   add_diagonal(diagonal);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::calculate_diagonal_column_by_column(
+  VectorType & diagonal) const
+{
+  compute_diagonal_column_by_column = true;
+  calculate_diagonal(diagonal);
+  compute_diagonal_column_by_column = false;
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::add_diagonal(VectorType & diagonal) const
@@ -539,8 +605,13 @@ void
 OperatorBase<dim, Number, n_components>::apply_inverse_block_diagonal(VectorType &       dst,
                                                                       VectorType const & src) const
 {
+  // fast diagonalization
+  if(this->data.implement_block_diagonal_preconditioner_fast_diagonalization)
+  {
+    apply_inverse_block_diagonal_fast_diagonalization(dst, src);
+  }
   // matrix-free
-  if(this->data.implement_block_diagonal_preconditioner_matrix_free)
+  else if(this->data.implement_block_diagonal_preconditioner_matrix_free)
   {
     // Solve elementwise block Jacobi problems iteratively using an elementwise solver vectorized
     // over several elements.
@@ -673,12 +744,475 @@ OperatorBase<dim, Number, n_components>::apply_add_block_diagonal_elementwise(
   }
 }
 
+namespace
+{
+/*
+ * 1D matrices of the symmetric interior penalty discretization of the negative Laplacian for
+ * FE_DGQ on the reference interval [0,1]: mass matrix, stiffness matrix including the consistency
+ * terms of both faces, and the penalty terms of both faces. Only face terms coupling the cell
+ * with itself are considered.
+ */
+void
+compute_1d_matrices_interior_penalty(unsigned int const           degree,
+                                     dealii::FullMatrix<double> & mass_1d,
+                                     dealii::FullMatrix<double> & laplace_1d,
+                                     dealii::FullMatrix<double> & penalty_1d)
+{
+  unsigned int const n_dofs_1d = degree + 1;
+
+  dealii::FE_DGQ<1> fe_1d(degree);
+  dealii::QGauss<1> quadrature_1d(degree + 1);
+
+  mass_1d.reinit(n_dofs_1d, n_dofs_1d);
+  laplace_1d.reinit(n_dofs_1d, n_dofs_1d);
+  penalty_1d.reinit(n_dofs_1d, n_dofs_1d);
+
+  for(unsigned int i = 0; i < n_dofs_1d; ++i)
+  {
+    for(unsigned int j = 0; j < n_dofs_1d; ++j)
+    {
+      for(unsigned int q = 0; q < quadrature_1d.size(); ++q)
+      {
+        dealii::Point<1> const & point = quadrature_1d.point(q);
+
+        mass_1d(i, j) += quadrature_1d.weight(q) * fe_1d.shape_value(i, point) *
+                         fe_1d.shape_value(j, point);
+        laplace_1d(i, j) += quadrature_1d.weight(q) * fe_1d.shape_grad(i, point)[0] *
+                            fe_1d.shape_grad(j, point)[0];
+      }
+
+      for(unsigned int face = 0; face < 2; ++face)
+      {
+        dealii::Point<1> const point(static_cast<double>(face));
+        double const           normal = (face == 0) ? -1.0 : 1.0;
+
+        double const value_i = fe_1d.shape_value(i, point);
+        double const value_j = fe_1d.shape_value(j, point);
+
+        laplace_1d(i, j) -= 0.5 * normal *
+                            (value_i * fe_1d.shape_grad(j, point)[0] +
+                             value_j * fe_1d.shape_grad(i, point)[0]);
+        penalty_1d(i, j) += value_i * value_j;
+      }
+    }
+  }
+}
+} // namespace
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::update_block_diagonal_preconditioner_fast_diagonalization()
+  const
+{
+  AssertThrow(is_dg, dealii::ExcMessage("Block Jacobi only implemented for DG!"));
+
+  double mass_factor = 0.0;
+  double diffusivity = 0.0;
+  double IP_factor   = 0.0;
+  this->get_fast_diagonalization_coefficients(mass_factor, diffusivity, IP_factor);
+
+  AssertThrow(mass_factor > 0.0 || diffusivity > 0.0,
+              dealii::ExcMessage("Fast diagonalization requires a mass term or a diffusive term."));
+
+  unsigned int const degree    = matrix_free->get_dof_handler(data.dof_index).get_fe().degree;
+  unsigned int const n_dofs_1d = degree + 1;
+
+  dealii::FullMatrix<double> mass_1d, laplace_1d, penalty_1d;
+  compute_1d_matrices_interior_penalty(degree, mass_1d, laplace_1d, penalty_1d);
+
+  double const penalty_factor = IP::get_penalty_factor<double>(degree, IP_factor);
+
+  typedef dealii::Table<2, dealii::VectorizedArray<Number>> Table;
+
+  fast_diagonalization_matrices.resize(matrix_free->n_cell_batches());
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    std::array<Table, dim> mass_matrices;
+    std::array<Table, dim> derivative_matrices;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      mass_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+      derivative_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+    }
+
+    unsigned int const n_filled_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
+    for(unsigned int v = 0; v < vectorization_length; ++v)
+    {
+      // fill unused lanes with the data of the first lane in order to obtain regular matrices
+      auto const cell_iterator =
+        matrix_free->get_cell_iterator(cell, v < n_filled_lanes ? v : 0, data.dof_index);
+
+      // The cell is approximated by a Cartesian cell with the same extent in each direction.
+      std::array<double, dim> h;
+      double                  surface_to_volume = 0.0;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        h[d] = cell_iterator->extent_in_direction(d);
+        surface_to_volume += 1.0 / h[d];
+      }
+
+      // penalty parameter as defined in IP::calculate_penalty_parameter() for interior faces
+      double const tau = penalty_factor * surface_to_volume;
+
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          {
+            mass_matrices[d](i, j)[v] = h[d] * mass_1d(i, j);
+            derivative_matrices[d](i, j)[v] =
+              diffusivity * (laplace_1d(i, j) / h[d] + tau * penalty_1d(i, j)) +
+              mass_factor / dim * h[d] * mass_1d(i, j);
+          }
+        }
+      }
+    }
+
+    fast_diagonalization_matrices[cell].reinit(mass_matrices, derivative_matrices);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_inverse_block_diagonal_fast_diagonalization(
+  VectorType &       dst,
+  VectorType const & src) const
+{
+  AssertThrow(is_dg, dealii::ExcMessage("Block Jacobi only implemented for DG!"));
+  AssertThrow(block_diagonal_preconditioner_is_initialized,
+              dealii::ExcMessage("Block Jacobi matrices have not been initialized!"));
+
+  matrix_free->cell_loop(&This::cell_loop_apply_inverse_block_diagonal_fast_diagonalization,
+                         this,
+                         dst,
+                         src);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::update_vertex_patch_preconditioner() const
+{
+  AssertThrow(is_dg,
+              dealii::ExcMessage("Vertex-patch Schwarz preconditioner only implemented for DG!"));
+
+  double mass_factor = 0.0;
+  double diffusivity = 0.0;
+  double IP_factor   = 0.0;
+  this->get_fast_diagonalization_coefficients(mass_factor, diffusivity, IP_factor);
+
+  AssertThrow(mass_factor > 0.0 || diffusivity > 0.0,
+              dealii::ExcMessage("Fast diagonalization requires a mass term or a diffusive term."));
+
+  dealii::FiniteElement<dim> const & fe = matrix_free->get_dof_handler(data.dof_index).get_fe();
+
+  unsigned int const degree             = fe.degree;
+  unsigned int const n_dofs_1d          = degree + 1;
+  unsigned int const dofs_per_cell      = fe.n_dofs_per_cell();
+  unsigned int const dofs_per_component = dofs_per_cell / n_components;
+  unsigned int const n_cells_per_patch  = dealii::GeometryInfo<dim>::vertices_per_cell;
+
+  typedef typename dealii::DoFHandler<dim>::cell_iterator CellIterator;
+
+  /*
+   * Collect the locally owned cells around each vertex. Within a patch, cells are numbered
+   * lexicographically, i.e. the cell touching the vertex with its local vertex v is located at
+   * position (2^dim - 1) - v. Patches are only formed if all 2^dim positions are occupied by
+   * exactly one cell and if neighboring positions are connected by the faces expected for the
+   * lexicographic numbering, i.e. vertices at (physical, periodic, or processor) boundaries,
+   * hanging vertices, and vertices with inconsistently oriented cells do not form a patch.
+   */
+  std::vector<CellIterator>                cells;
+  std::map<unsigned int, std::vector<int>> vertex_to_cells;
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      CellIterator const cell_iterator = matrix_free->get_cell_iterator(cell, v, data.dof_index);
+
+      for(unsigned int vertex = 0; vertex < n_cells_per_patch; ++vertex)
+      {
+        std::vector<int> & patch = vertex_to_cells[cell_iterator->vertex_index(vertex)];
+        if(patch.empty())
+          patch.resize(n_cells_per_patch, -1);
+
+        // -1: position not occupied, -2: position occupied more than once (invalid patch)
+        int & entry = patch[n_cells_per_patch - 1 - vertex];
+        entry       = (entry == -1) ? static_cast<int>(cells.size()) : -2;
+      }
+
+      cells.push_back(cell_iterator);
+    }
+  }
+
+  // The cells at positions i and i + 2^d (with bit d of i not set) have to share the face 2d+1 of
+  // the first cell. Otherwise, e.g. for cells rotated by 180 degrees, each position might be
+  // occupied exactly once, but the tensor-product structure of the patch would couple wrong faces.
+  auto const is_consistently_oriented = [&](std::vector<int> const & patch) {
+    for(unsigned int i = 0; i < n_cells_per_patch; ++i)
+    {
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        if((i >> d) & 1)
+          continue;
+
+        CellIterator const & cell     = cells[patch[i]];
+        CellIterator const & neighbor = cells[patch[i + (1 << d)]];
+        if(cell->at_boundary(2 * d + 1) || cell->neighbor(2 * d + 1) != neighbor)
+          return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<std::vector<unsigned int>> patches;
+  std::vector<bool>                      cell_is_covered(cells.size(), false);
+  for(auto const & vertex_and_cells : vertex_to_cells)
+  {
+    std::vector<int> const & patch = vertex_and_cells.second;
+    if(std::all_of(patch.begin(), patch.end(), [](int const i) { return i >= 0; }) &&
+       is_consistently_oriented(patch))
+    {
+      patches.emplace_back(patch.begin(), patch.end());
+      for(int const i : patch)
+        cell_is_covered[i] = true;
+    }
+  }
+
+  // cells not contained in any patch are treated as patches consisting of a single cell
+  for(unsigned int i = 0; i < cells.size(); ++i)
+    if(!cell_is_covered[i])
+      patches.push_back(std::vector<unsigned int>(1, i));
+
+  // local dof indices of all cells in component-wise lexicographic numbering
+  std::shared_ptr<dealii::Utilities::MPI::Partitioner const> const partitioner =
+    matrix_free->get_vector_partitioner(data.dof_index);
+
+  std::vector<std::vector<unsigned int>>       cell_dof_indices(cells.size());
+  std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+  for(unsigned int i = 0; i < cells.size(); ++i)
+  {
+    if(is_mg)
+      cells[i]->get_mg_dof_indices(dof_indices);
+    else
+      cells[i]->get_dof_indices(dof_indices);
+
+    cell_dof_indices[i].resize(dofs_per_cell);
+    for(unsigned int j = 0; j < dofs_per_cell; ++j)
+    {
+      std::pair<unsigned int, unsigned int> const component_and_index =
+        fe.system_to_component_index(j);
+      cell_dof_indices[i][component_and_index.first * dofs_per_component +
+                          component_and_index.second] = partitioner->global_to_local(dof_indices[j]);
+    }
+  }
+
+  // 1D matrices on the reference interval and values/gradients of the shape functions at the
+  // end points needed for the coupling across the interior faces of a patch
+  dealii::FullMatrix<double> mass_1d, laplace_1d, penalty_1d;
+  compute_1d_matrices_interior_penalty(degree, mass_1d, laplace_1d, penalty_1d);
+
+  dealii::FE_DGQ<1>                  fe_1d(degree);
+  std::array<std::vector<double>, 2> values_1d, gradients_1d;
+  for(unsigned int face = 0; face < 2; ++face)
+  {
+    dealii::Point<1> const point(static_cast<double>(face));
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+    {
+      values_1d[face].push_back(fe_1d.shape_value(i, point));
+      gradients_1d[face].push_back(fe_1d.shape_grad(i, point)[0]);
+    }
+  }
+
+  double const penalty_factor = IP::get_penalty_factor<double>(degree, IP_factor);
+
+  vertex_patch_dof_indices.resize(patches.size());
+  vertex_patch_matrices.resize(patches.size());
+
+  for(unsigned int p = 0; p < patches.size(); ++p)
+  {
+    std::vector<unsigned int> const & patch = patches[p];
+
+    unsigned int const n_cells_1d = (patch.size() == 1) ? 1 : 2;
+    unsigned int const n_1d       = n_cells_1d * n_dofs_1d;
+
+    // The patch is approximated by a Cartesian patch, where the extent of the cells in direction
+    // d is taken from the cells at positions 0 and 2^d, and a single penalty parameter is used.
+    double tau = 0.0;
+    for(unsigned int const i : patch)
+    {
+      double surface_to_volume = 0.0;
+      for(unsigned int d = 0; d < dim; ++d)
+        surface_to_volume += 1.0 / cells[i]->extent_in_direction(d);
+      tau = std::max(tau, penalty_factor * surface_to_volume);
+    }
+
+    std::array<dealii::Table<2, Number>, dim> mass_matrices;
+    std::array<dealii::Table<2, Number>, dim> derivative_matrices;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      std::array<double, 2> h;
+      for(unsigned int c = 0; c < n_cells_1d; ++c)
+        h[c] = cells[patch[c << d]]->extent_in_direction(d);
+
+      dealii::FullMatrix<double> mass(n_1d, n_1d), laplace(n_1d, n_1d);
+      for(unsigned int c = 0; c < n_cells_1d; ++c)
+      {
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          {
+            mass(c * n_dofs_1d + i, c * n_dofs_1d + j) = h[c] * mass_1d(i, j);
+            laplace(c * n_dofs_1d + i, c * n_dofs_1d + j) =
+              laplace_1d(i, j) / h[c] + tau * penalty_1d(i, j);
+          }
+        }
+      }
+
+      // coupling of the two cells across the interior face (test function i of the left cell,
+      // trial function j of the right cell)
+      if(n_cells_1d == 2)
+      {
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          {
+            double const coupling = -0.5 * gradients_1d[0][j] / h[1] * values_1d[1][i] +
+                                    0.5 * gradients_1d[1][i] / h[0] * values_1d[0][j] -
+                                    tau * values_1d[1][i] * values_1d[0][j];
+
+            laplace(i, n_dofs_1d + j) = coupling;
+            laplace(n_dofs_1d + j, i) = coupling;
+          }
+        }
+      }
+
+      mass_matrices[d].reinit(n_1d, n_1d);
+      derivative_matrices[d].reinit(n_1d, n_1d);
+      for(unsigned int i = 0; i < n_1d; ++i)
+      {
+        for(unsigned int j = 0; j < n_1d; ++j)
+        {
+          mass_matrices[d](i, j) = mass(i, j);
+          derivative_matrices[d](i, j) =
+            diffusivity * laplace(i, j) + mass_factor / dim * mass(i, j);
+        }
+      }
+    }
+
+    vertex_patch_matrices[p].reinit(mass_matrices, derivative_matrices);
+
+    // dof indices of the patch in component-wise lexicographic numbering
+    unsigned int const n_patch_dofs_per_component = dealii::Utilities::pow(n_1d, dim);
+
+    std::vector<unsigned int> & indices = vertex_patch_dof_indices[p];
+    indices.resize(n_components * n_patch_dofs_per_component);
+    for(unsigned int position = 0; position < patch.size(); ++position)
+    {
+      for(unsigned int i = 0; i < dofs_per_component; ++i)
+      {
+        unsigned int patch_index = 0;
+        unsigned int stride_cell = 1, stride_patch = 1;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          unsigned int const i_d = (i / stride_cell) % n_dofs_1d;
+          unsigned int const c_d = (position >> d) & 1;
+          patch_index += (c_d * n_dofs_1d + i_d) * stride_patch;
+          stride_cell *= n_dofs_1d;
+          stride_patch *= n_1d;
+        }
+
+        for(unsigned int c = 0; c < n_components; ++c)
+          indices[c * n_patch_dofs_per_component + patch_index] =
+            cell_dof_indices[patch[position]][c * dofs_per_component + i];
+      }
+    }
+  }
+
+  // The additive Schwarz method is weighted symmetrically by the inverse square root of the
+  // number of patches a dof belongs to.
+  vertex_patch_weights.assign(partitioner->locally_owned_size(), 0.0);
+  for(auto const & indices : vertex_patch_dof_indices)
+    for(unsigned int const i : indices)
+      vertex_patch_weights[i] += 1.0;
+  for(Number & weight : vertex_patch_weights)
+    if(weight > 0.0)
+      weight = 1.0 / std::sqrt(weight);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_inverse_vertex_patch(VectorType &       dst,
+                                                                    VectorType const & src) const
+{
+  AssertThrow(vertex_patch_weights.size() == src.get_partitioner()->locally_owned_size(),
+              dealii::ExcMessage("Vertex-patch Schwarz preconditioner has not been initialized!"));
+
+  dst = 0.0;
+
+  std::vector<Number> & src_patch = vertex_patch_src;
+  std::vector<Number> & dst_patch = vertex_patch_dst;
+  for(unsigned int p = 0; p < vertex_patch_dof_indices.size(); ++p)
+  {
+    std::vector<unsigned int> const & indices = vertex_patch_dof_indices[p];
+
+    src_patch.resize(indices.size());
+    dst_patch.resize(indices.size());
+
+    for(unsigned int i = 0; i < indices.size(); ++i)
+      src_patch[i] = vertex_patch_weights[indices[i]] * src.local_element(indices[i]);
+
+    // the local problems decouple into identical problems for all components
+    unsigned int const n_patch_dofs_per_component = indices.size() / n_components;
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      vertex_patch_matrices[p].apply_inverse(
+        dealii::ArrayView<Number>(dst_patch.data() + c * n_patch_dofs_per_component,
+                                  n_patch_dofs_per_component),
+        dealii::ArrayView<Number const>(src_patch.data() + c * n_patch_dofs_per_component,
+                                        n_patch_dofs_per_component));
+    }
+
+    for(unsigned int i = 0; i < indices.size(); ++i)
+      dst.local_element(indices[i]) += vertex_patch_weights[indices[i]] * dst_patch[i];
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::get_fast_diagonalization_coefficients(
+  double & mass_factor,
+  double & diffusivity,
+  double & IP_factor) const
+{
+  (void)mass_factor;
+  (void)diffusivity;
+  (void)IP_factor;
+
+  AssertThrow(false,
+              dealii::ExcMessage(
+                "Fast diagonalization of block Jacobi problems is not implemented for this operator."));
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::update_block_diagonal_preconditioner() const
 {
   AssertThrow(is_dg, dealii::ExcMessage("Block Jacobi only implemented for DG!"));
 
+  // The fast diagonalization variant is recomputed in every update since the coefficients of the
+  // operator (e.g. the scaling factor of the mass operator) might have changed.
+  if(data.implement_block_diagonal_preconditioner_fast_diagonalization)
+  {
+    update_block_diagonal_preconditioner_fast_diagonalization();
+
+    block_diagonal_preconditioner_is_initialized = true;
+
+    return;
+  }
+
   // initialization
 
   if(!block_diagonal_preconditioner_is_initialized)
@@ -1256,6 +1790,237 @@ OperatorBase<dim, Number, n_components>::face_loop_empty(
   // do nothing
 }
 
+namespace
+{
+/*
+ * Computes dst[j] += sum_q src[q] * prod_d shape_a_d(j_d, q_d) * shape_b_d(j_d, q_d) for all
+ * cell dofs j in lexicographic numbering by successive 1D contractions (sum factorization), i.e.
+ * with O(n^{dim+1}) operations instead of O(n^{2 dim}). The 1D shape matrices are stored with the
+ * index of the basis function running slowest.
+ */
+template<int dim, typename Number>
+void
+add_tensor_product_diagonal(dealii::VectorizedArray<Number> * const              dst,
+                            dealii::VectorizedArray<Number> const * const        src,
+                            std::array<std::vector<Number> const *, dim> const & shape_a,
+                            std::array<std::vector<Number> const *, dim> const & shape_b,
+                            unsigned int const                                   n_dofs_1d,
+                            unsigned int const                                   n_q_points_1d,
+                            std::vector<dealii::VectorizedArray<Number>> &       tmp_in,
+                            std::vector<dealii::VectorizedArray<Number>> &       tmp_out)
+{
+  unsigned int const n_q_points = dealii::Utilities::pow(n_q_points_1d, dim);
+  tmp_in.assign(src, src + n_q_points);
+
+  // after contraction of direction d, directions 0,...,d refer to dofs and directions d+1,...,
+  // dim-1 to quadrature points
+  unsigned int stride = 1;
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    unsigned int const n_outer = dealii::Utilities::pow(n_q_points_1d, dim - d - 1);
+    tmp_out.resize(stride * n_dofs_1d * n_outer);
+
+    for(unsigned int k = 0; k < n_outer; ++k)
+    {
+      for(unsigned int j = 0; j < n_dofs_1d; ++j)
+      {
+        for(unsigned int s = 0; s < stride; ++s)
+        {
+          dealii::VectorizedArray<Number> sum = 0.0;
+          for(unsigned int q = 0; q < n_q_points_1d; ++q)
+            sum += (*shape_a[d])[j * n_q_points_1d + q] * (*shape_b[d])[j * n_q_points_1d + q] *
+                   tmp_in[s + stride * (q + n_q_points_1d * k)];
+
+          tmp_out[s + stride * (j + n_dofs_1d * k)] = sum;
+        }
+      }
+    }
+
+    tmp_in.swap(tmp_out);
+    stride *= n_dofs_1d;
+  }
+
+  for(unsigned int j = 0; j < stride; ++j)
+    dst[j] += tmp_in[j];
+}
+} // namespace
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::calculate_cell_diagonal(
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag) const
+{
+  if(compute_diagonal_column_by_column || !cell_diagonal_sum_factorization_is_applicable())
+    calculate_cell_diagonal_column_by_column(local_diag);
+  else
+    calculate_cell_diagonal_sum_factorization(local_diag);
+}
+
+template<int dim, typename Number, int n_components>
+bool
+OperatorBase<dim, Number, n_components>::cell_diagonal_sum_factorization_is_applicable() const
+{
+  // The 1D shape functions of FE_DGQ are used to evaluate the tensor-product structure, and the
+  // kernel is probed with values and gradients only.
+  dealii::FiniteElement<dim> const & fe = matrix_free->get_dof_handler(data.dof_index).get_fe();
+
+  return is_dg && typeid(fe.base_element(0)) == typeid(dealii::FE_DGQ<dim>) &&
+         !integrator_flags.cell_evaluate.hessian;
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::calculate_cell_diagonal_column_by_column(
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag) const
+{
+  for(unsigned int j = 0; j < integrator->dofs_per_cell; ++j)
+  {
+    // write standard basis into dof values of dealii::FEEvaluation
+    this->create_standard_basis(j, *integrator);
+
+    integrator->evaluate(integrator_flags.cell_evaluate.value,
+                         integrator_flags.cell_evaluate.gradient,
+                         integrator_flags.cell_evaluate.hessian);
+
+    this->do_cell_integral(*integrator);
+
+    integrator->integrate(integrator_flags.cell_integrate.value,
+                          integrator_flags.cell_integrate.gradient);
+
+    // extract single value from result vector and temporally store it
+    local_diag[j] = integrator->begin_dof_values()[j];
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::calculate_cell_diagonal_sum_factorization(
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag) const
+{
+  /*
+   * For a linear operator, the cell integral maps the values and reference-cell gradients at a
+   * quadrature point q to the values and gradients tested at q. This pointwise map B_q is
+   * determined by probing the kernel do_cell_integral() with unit data in all quadrature points
+   * simultaneously, i.e. with (1+dim) kernel evaluations per component instead of one evaluation
+   * per unit vector. The diagonal then reads
+   *
+   *  diag_j = sum_{a,b} sum_q S_a(j,q) B_q(a,b) S_b(j,q)
+   *
+   * with S_0 the shape values and S_{1+d} the shape gradients in direction d, which is evaluated
+   * by sum factorization.
+   */
+  unsigned int const degree = matrix_free->get_dof_handler(data.dof_index).get_fe().degree;
+  dealii::Quadrature<1> const & quadrature_1d =
+    matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0].quadrature;
+
+  unsigned int const n_dofs_1d     = degree + 1;
+  unsigned int const n_q_points_1d = quadrature_1d.size();
+
+  dealii::FE_DGQ<1> fe_1d(degree);
+
+  std::vector<Number> values_1d(n_dofs_1d * n_q_points_1d);
+  std::vector<Number> gradients_1d(n_dofs_1d * n_q_points_1d);
+  for(unsigned int i = 0; i < n_dofs_1d; ++i)
+  {
+    for(unsigned int q = 0; q < n_q_points_1d; ++q)
+    {
+      values_1d[i * n_q_points_1d + q]    = fe_1d.shape_value(i, quadrature_1d.point(q));
+      gradients_1d[i * n_q_points_1d + q] = fe_1d.shape_grad(i, quadrature_1d.point(q))[0];
+    }
+  }
+
+  unsigned int const n_q_points         = integrator->n_q_points;
+  unsigned int const dofs_per_component = integrator->dofs_per_component;
+  unsigned int const n_slots            = 1 + dim;
+
+  auto const slot_is_evaluated = [&](unsigned int const slot) {
+    return slot == 0 ? integrator_flags.cell_evaluate.value :
+                       integrator_flags.cell_evaluate.gradient;
+  };
+
+  auto const slot_is_integrated = [&](unsigned int const slot) {
+    return slot == 0 ? integrator_flags.cell_integrate.value :
+                       integrator_flags.cell_integrate.gradient;
+  };
+
+  // quadrature point data of slot a and component c in quadrature point q, where the layout of
+  // the reference-cell gradients depends on the deal.II version
+  auto const quadrature_data = [&](unsigned int const slot,
+                                   unsigned int const c,
+                                   unsigned int const q) -> dealii::VectorizedArray<Number> & {
+    if(slot == 0)
+      return integrator->begin_values()[c * n_q_points + q];
+
+    unsigned int const d = slot - 1;
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    return integrator->begin_gradients()[(c * n_q_points + q) * dim + d];
+#else
+    return integrator->begin_gradients()[(c * dim + d) * n_q_points + q];
+#endif
+  };
+
+  // 1D shape matrix in direction d for slot a
+  auto const shape_1d = [&](unsigned int const slot, unsigned int const d) {
+    return (slot == 1 + d) ? &gradients_1d : &values_1d;
+  };
+
+  for(unsigned int j = 0; j < integrator->dofs_per_cell; ++j)
+    local_diag[j] = 0.0;
+
+  std::vector<dealii::VectorizedArray<Number>> response(n_slots * n_q_points);
+  std::vector<dealii::VectorizedArray<Number>> tmp_in, tmp_out;
+
+  for(unsigned int c = 0; c < n_components; ++c)
+  {
+    for(unsigned int b = 0; b < n_slots; ++b)
+    {
+      if(!slot_is_evaluated(b))
+        continue;
+
+      // evaluate zero vector to initialize the quadrature point data and set unit data in slot b
+      for(unsigned int j = 0; j < integrator->dofs_per_cell; ++j)
+        integrator->begin_dof_values()[j] = dealii::make_vectorized_array<Number>(0.);
+
+      integrator->evaluate(integrator_flags.cell_evaluate.value,
+                           integrator_flags.cell_evaluate.gradient,
+                           integrator_flags.cell_evaluate.hessian);
+
+      for(unsigned int q = 0; q < n_q_points; ++q)
+        quadrature_data(b, c, q) = dealii::make_vectorized_array<Number>(1.);
+
+      this->do_cell_integral(*integrator);
+
+      // store response of component c since the quadrature point data is overwritten below
+      for(unsigned int a = 0; a < n_slots; ++a)
+        if(slot_is_integrated(a))
+          for(unsigned int q = 0; q < n_q_points; ++q)
+            response[a * n_q_points + q] = quadrature_data(a, c, q);
+
+      for(unsigned int a = 0; a < n_slots; ++a)
+      {
+        if(!slot_is_integrated(a))
+          continue;
+
+        std::array<std::vector<Number> const *, dim> shape_a, shape_b;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          shape_a[d] = shape_1d(a, d);
+          shape_b[d] = shape_1d(b, d);
+        }
+
+        add_tensor_product_diagonal<dim, Number>(local_diag.begin() + c * dofs_per_component,
+                                                 response.data() + a * n_q_points,
+                                                 shape_a,
+                                                 shape_b,
+                                                 n_dofs_1d,
+                                                 n_q_points_1d,
+                                                 tmp_in,
+                                                 tmp_out);
+      }
+    }
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::cell_loop_diagonal(
@@ -1275,23 +2040,8 @@ OperatorBase<dim, Number, n_components>::cell_loop_diagonal(
   {
     this->reinit_cell(cell);
 
-    for(unsigned int j = 0; j < dofs_per_cell; ++j)
-    {
-      // write standard basis into dof values of dealii::FEEvaluation
-      this->create_standard_basis(j, *integrator);
-
-      integrator->evaluate(integrator_flags.cell_evaluate.value,
-                           integrator_flags.cell_evaluate.gradient,
-                           integrator_flags.cell_evaluate.hessian);
-
-      this->do_cell_integral(*integrator);
+    this->calculate_cell_diagonal(local_diag);
 
-      integrator->integrate(integrator_flags.cell_integrate.value,
-                            integrator_flags.cell_integrate.gradient);
-
-      // extract single value from result vector and temporally store it
-      local_diag[j] = integrator->begin_dof_values()[j];
-    }
     // copy local diagonal entries into dof values of dealii::FEEvaluation ...
     for(unsigned int j = 0; j < dofs_per_cell; ++j)
       integrator->begin_dof_values()[j] = local_diag[j];
@@ -1425,21 +2175,7 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_diagonal(
   {
     this->reinit_cell(cell);
 
-    for(unsigned int j = 0; j < dofs_per_cell; ++j)
-    {
-      this->create_standard_basis(j, *integrator);
-
-      integrator->evaluate(integrator_flags.cell_evaluate.value,
-                           integrator_flags.cell_evaluate.gradient,
-                           integrator_flags.cell_evaluate.hessian);
-
-      this->do_cell_integral(*integrator);
-
-      integrator->integrate(integrator_flags.cell_integrate.value,
-                            integrator_flags.cell_integrate.gradient);
-
-      local_diag[j] = integrator->begin_dof_values()[j];
-    }
+    this->calculate_cell_diagonal(local_diag);
 
     // loop over all faces and gather results into local diagonal local_diag
     unsigned int const n_faces = dealii::ReferenceCells::template get_hypercube<dim>().n_faces();
@@ -1525,6 +2261,45 @@ OperatorBase<dim, Number, n_components>::cell_loop_apply_inverse_block_diagonal_
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_loop_apply_inverse_block_diagonal_fast_diagonalization(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           cell_range) const
+{
+  (void)matrix_free;
+
+  unsigned int const dofs_per_component = integrator->dofs_per_component;
+
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> solution(integrator->dofs_per_cell);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator->reinit(cell);
+
+    integrator->read_dof_values(src);
+
+    // the block Jacobi problem decouples into identical problems for all components
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      dealii::ArrayView<dealii::VectorizedArray<Number>> dst_view(solution.begin() +
+                                                                    c * dofs_per_component,
+                                                                  dofs_per_component);
+      dealii::ArrayView<dealii::VectorizedArray<Number> const> src_view(
+        integrator->begin_dof_values() + c * dofs_per_component, dofs_per_component);
+
+      fast_diagonalization_matrices[cell].apply_inverse(dst_view, src_view);
+    }
+
+    for(unsigned int j = 0; j < integrator->dofs_per_cell; ++j)
+      integrator->begin_dof_values()[j] = solution[j];
+
+    integrator->set_dof_values(dst);
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::cell_loop_apply_block_diagonal_matrix_based(
@@ -1845,6 +2620,7 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
       // of the matrix (vs 2 for off-diagonal ones); this implies a non-zero
       // entry is added to the diagonal of constrained matrix rows, ensuring
       // positive definiteness
+      std::lock_guard<dealii::Threads::Mutex> lock(system_matrix_mutex);
       constraint_double.distribute_local_to_global(matrices[v], dof_indices, dst);
     }
   }
@@ -1941,6 +2717,7 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
         cell_p->get_dof_indices(dof_indices_p);
       }
 
+      std::lock_guard<dealii::Threads::Mutex> lock(system_matrix_mutex);
       // save M_mm
       constraint_double.distribute_local_to_global(matrices_m[v], dof_indices_m, dst);
       // save M_pm
@@ -2005,6 +2782,7 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
         cell_p->get_dof_indices(dof_indices_p);
       }
 
+      std::lock_guard<dealii::Threads::Mutex> lock(system_matrix_mutex);
       // save M_mp
       constraint_double.distribute_local_to_global(matrices_m[v],
                                                    dof_indices_m,
@@ -2072,6 +2850,7 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
       else
         cell_v->get_dof_indices(dof_indices);
 
+      std::lock_guard<dealii::Threads::Mutex> lock(system_matrix_mutex);
       constraint_double.distribute_local_to_global(matrices[v], dof_indices, dst);
     }
   }
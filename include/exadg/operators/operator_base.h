@@ -24,10 +24,12 @@
 
 // deal.II
 #include <deal.II/base/subscriptor.h>
+#include <deal.II/base/thread_management.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/tensor_product_matrix.h>
 #ifdef DEAL_II_WITH_TRILINOS
 #  include <deal.II/lac/trilinos_sparse_matrix.h>
 #endif
@@ -51,6 +53,7 @@
 #include <exadg/operators/lazy_ptr.h>
 #include <exadg/operators/mapping_flags.h>
 #include <exadg/operators/operator_type.h>
+#include <exadg/operators/thread_local_ptr.h>
 
 namespace ExaDG
 {
@@ -62,6 +65,7 @@ struct OperatorBaseData
       operator_is_singular(false),
       use_cell_based_loops(false),
       implement_block_diagonal_preconditioner_matrix_free(false),
+      implement_block_diagonal_preconditioner_fast_diagonalization(false),
       solver_block_diagonal(Elementwise::Solver::GMRES),
       preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
       solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000))
@@ -79,6 +83,11 @@ struct OperatorBaseData
   // block Jacobi preconditioner
   bool implement_block_diagonal_preconditioner_matrix_free;
 
+  // block Jacobi preconditioner based on a separable (tensor-product) approximation of the block
+  // Jacobi problems, inverted by the fast diagonalization method. If true, this variant takes
+  // precedence over the matrix-free and matrix-based variants.
+  bool implement_block_diagonal_preconditioner_fast_diagonalization;
+
   // elementwise iterative solution of block Jacobi problems
   Elementwise::Solver         solver_block_diagonal;
   Elementwise::Preconditioner preconditioner_block_diagonal;
@@ -142,6 +151,23 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Matrix-vector product with additional operations on subranges [begin, end) of the locally owned
+   * degrees of freedom. The matrix-free loop guarantees that operation_before_loop is executed on a
+   * range before the range is accessed by the operator evaluation for the first time, and that
+   * operation_after_loop is executed once the operator evaluation has finished with a range. This
+   * allows to fuse vector updates and inner products of iterative solvers into the operator
+   * evaluation while the data is still in cache. The dst vector is set to zero internally. For
+   * continuous Galerkin discretizations, the operations are executed on the whole range before and
+   * after the operator evaluation, respectively.
+   */
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const;
+
   void
   vmult_add(VectorType & dst, VectorType const & src) const;
 
@@ -259,6 +285,13 @@ public:
   void
   add_diagonal(VectorType & diagonal) const;
 
+  // The diagonal contributions of cell integrals are computed by sum factorization in
+  // calculate_diagonal() whenever possible. This function computes the diagonal column by column,
+  // i.e. by applying the operator to all unit vectors of a cell, and is intended for
+  // verification.
+  void
+  calculate_diagonal_column_by_column(VectorType & diagonal) const;
+
   /*
    * block Jacobi preconditioner (block-diagonal)
    */
@@ -290,6 +323,32 @@ public:
                                        dealii::VectorizedArray<Number> const * const src,
                                        unsigned int const problem_size) const;
 
+  // fast diagonalization
+
+  // This function computes the separable approximation of the block Jacobi problems on all cells,
+  // i.e. the 1D mass and 1D Laplace matrices per coordinate direction and their generalized
+  // eigendecompositions. Only 1D matrices are stored and the inverse is applied with O(p^{d+1})
+  // operations per cell.
+  void
+  update_block_diagonal_preconditioner_fast_diagonalization() const;
+
+  void
+  apply_inverse_block_diagonal_fast_diagonalization(VectorType &       dst,
+                                                    VectorType const & src) const;
+
+  /*
+   * Vertex-patch Schwarz preconditioner/smoother: additive Schwarz method with overlapping patches
+   * of 2^dim cells around each vertex. The local problems are approximated by separable operators
+   * (see get_fast_diagonalization_coefficients()) and are inverted by the fast diagonalization
+   * method. Cells not contained in any patch (e.g. at boundaries) are treated as single-cell
+   * patches.
+   */
+  void
+  update_vertex_patch_preconditioner() const;
+
+  void
+  apply_inverse_vertex_patch(VectorType & dst, VectorType const & src) const;
+
 protected:
   void
   reinit(dealii::MatrixFree<dim, Number> const &   matrix_free,
@@ -350,6 +409,18 @@ protected:
   do_face_int_integral_cell_based(IntegratorFace & integrator_m,
                                   IntegratorFace & integrator_p) const;
 
+  /*
+   * The fast diagonalization variant of the block Jacobi preconditioner approximates the operator
+   * on each cell by mass_factor * M + diffusivity * L, where M is the mass matrix and L the
+   * symmetric interior penalty discretization of the negative Laplacian with penalty factor
+   * IP_factor. Derived classes supporting this variant have to overwrite this function and
+   * provide the coefficients of this approximation.
+   */
+  virtual void
+  get_fast_diagonalization_coefficients(double & mass_factor,
+                                        double & diffusivity,
+                                        double & IP_factor) const;
+
   /*
    * Matrix-free object.
    */
@@ -382,9 +453,13 @@ protected:
    */
   bool is_dg;
 
-  std::shared_ptr<IntegratorCell> integrator;
-  std::shared_ptr<IntegratorFace> integrator_m;
-  std::shared_ptr<IntegratorFace> integrator_p;
+  /*
+   * Cell and face integrators used when visiting a cell or face in the matrix-free loops. Each
+   * thread works on its own integrators if the loops are executed task-parallel.
+   */
+  thread_local_ptr<IntegratorCell> integrator;
+  thread_local_ptr<IntegratorFace> integrator_m;
+  thread_local_ptr<IntegratorFace> integrator_p;
 
   /*
    * Block Jacobi preconditioner/smoother: matrix-free version with elementwise iterative solver
@@ -517,6 +592,24 @@ private:
                            VectorType const &                      src,
                            Range const &                           range) const;
 
+  /*
+   * Calculate diagonal contributions of cell integrals for the current cell.
+   */
+  void
+  calculate_cell_diagonal(
+    dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag) const;
+
+  bool
+  cell_diagonal_sum_factorization_is_applicable() const;
+
+  void
+  calculate_cell_diagonal_column_by_column(
+    dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag) const;
+
+  void
+  calculate_cell_diagonal_sum_factorization(
+    dealii::AlignedVector<dealii::VectorizedArray<Number>> & local_diag) const;
+
   /*
    * Calculate (assemble) block diagonal.
    */
@@ -567,6 +660,13 @@ private:
     VectorType const &                      src,
     Range const &                           range) const;
 
+  void
+  cell_loop_apply_inverse_block_diagonal_fast_diagonalization(
+    dealii::MatrixFree<dim, Number> const & matrix_free,
+    VectorType &                            dst,
+    VectorType const &                      src,
+    Range const &                           range) const;
+
   /*
    * Set up sparse matrix internally for templated matrix type (Trilinos or
    * PETSc matrices)
@@ -632,6 +732,29 @@ private:
    */
   mutable std::vector<dealii::LAPACKFullMatrix<Number>> matrices;
 
+  /*
+   * Tensor-product matrices (one per cell batch) for the fast diagonalization variant of block
+   * Jacobi preconditioners.
+   */
+  mutable std::vector<
+    dealii::TensorProductMatrixSymmetricSum<dim, dealii::VectorizedArray<Number>, -1>>
+    fast_diagonalization_matrices;
+
+  /*
+   * Data structures of the vertex-patch Schwarz preconditioner: local dof indices of all patches
+   * in component-wise lexicographic numbering, tensor-product matrices of the local problems, and
+   * weights of the locally owned dofs.
+   */
+  mutable std::vector<std::vector<unsigned int>> vertex_patch_dof_indices;
+
+  mutable std::vector<dealii::TensorProductMatrixSymmetricSum<dim, Number, -1>>
+    vertex_patch_matrices;
+
+  mutable std::vector<Number> vertex_patch_weights;
+
+  // buffers for the local vectors of a patch
+  mutable std::vector<Number> vertex_patch_src, vertex_patch_dst;
+
   /*
    * We want to initialize the block diagonal preconditioner (block diagonal matrices or elementwise
    * iterative solvers in case of matrix-free implementation) only once, so we store the status of
@@ -639,6 +762,17 @@ private:
    */
   mutable bool block_diagonal_preconditioner_is_initialized;
 
+  /*
+   * Enforces the computation of the diagonal column by column (for verification).
+   */
+  mutable bool compute_diagonal_column_by_column;
+
+  /*
+   * Serializes the assembly of element matrices into the global sparse matrix if the matrix-free
+   * loops are executed task-parallel.
+   */
+  mutable dealii::Threads::Mutex system_matrix_mutex;
+
   unsigned int n_mpi_processes;
 
   /*
@@ -37,7 +37,7 @@ RHSOperator<dim, Number, n_components>::initialize(
   this->matrix_free = &matrix_free_in;
   this->data        = data_in;
 
-  kernel.reinit(data.kernel_data);
+  kernel.reinit(matrix_free_in, data.kernel_data, data.quad_index);
 }
 
 template<int dim, typename Number, int n_components>
@@ -23,6 +23,7 @@
 #define INCLUDE_OPERATORS_RHS_OPERATOR
 
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/functions_and_boundary_conditions/quadrature_values_cache.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/mapping_flags.h>
 
@@ -33,7 +34,14 @@ namespace Operators
 template<int dim>
 struct RHSKernelData
 {
+  RHSKernelData() : use_cache(false)
+  {
+  }
+
   std::shared_ptr<dealii::Function<dim>> f;
+
+  // store values of f at quadrature points
+  bool use_cache;
 };
 
 template<int dim, typename Number, int n_components = 1>
@@ -50,9 +58,14 @@ private:
 
 public:
   void
-  reinit(RHSKernelData<dim> const & data_in) const
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
+         RHSKernelData<dim> const &              data_in,
+         unsigned int const                      quad_index)
   {
     data = data_in;
+
+    if(data.use_cache)
+      cache.reinit(matrix_free, quad_index);
   }
 
   static MappingFlags
@@ -77,13 +90,18 @@ public:
                     unsigned int const     q,
                     Number const &         time) const
   {
+    if(data.use_cache)
+      return cache.get_value_cell(data.f, integrator, q, time);
+
     dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
     return FunctionEvaluator<rank, dim, Number>::value(data.f, q_points, time);
   }
 
 private:
-  mutable RHSKernelData<dim> data;
+  RHSKernelData<dim> data;
+
+  QuadratureValuesCache<rank, dim, Number> cache;
 };
 
 } // namespace Operators
@@ -0,0 +1,92 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef THREAD_LOCAL_PTR_H_
+#define THREAD_LOCAL_PTR_H_
+
+// C/C++
+#include <memory>
+
+// deal.II
+#include <deal.II/base/thread_local_storage.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+/*
+ * Pointer to an object that is modified when visiting a cell or face in a matrix-free loop, e.g.,
+ * an integrator. If the matrix-free loops are executed task-parallel, every thread works on its
+ * own copy of the object, which is created from the exemplar the first time the thread accesses
+ * the object. Otherwise, the exemplar is accessed directly.
+ */
+template<typename T>
+class thread_local_ptr
+{
+public:
+  thread_local_ptr() : task_parallel(false)
+  {
+  }
+
+  // resets the exemplar and deletes all copies of the previous exemplar
+  template<int dim, typename Number>
+  void
+  reset(std::shared_ptr<T> const & exemplar, dealii::MatrixFree<dim, Number> const & matrix_free)
+  {
+    this->exemplar      = exemplar;
+    this->task_parallel = (matrix_free.get_task_info().scheme !=
+                           dealii::internal::MatrixFreeFunctions::TaskInfo::none);
+    this->copies.clear();
+  }
+
+  T *
+  get() const
+  {
+    if(!task_parallel)
+      return exemplar.get();
+
+    std::shared_ptr<T> & copy = copies.get();
+    if(copy.get() == nullptr)
+      copy = std::make_shared<T>(*exemplar);
+
+    return copy.get();
+  }
+
+  T * operator->() const
+  {
+    return get();
+  }
+
+  T & operator*() const
+  {
+    return *get();
+  }
+
+private:
+  std::shared_ptr<T> exemplar;
+
+  bool task_parallel;
+
+  mutable dealii::Threads::ThreadLocalStorage<std::shared_ptr<T>> copies;
+};
+
+} // namespace ExaDG
+
+#endif
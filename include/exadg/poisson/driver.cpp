@@ -148,6 +148,13 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     pcout << std::endl << "Timings for level 3:" << std::endl;
     timer_tree.print_level(pcout, 3);
 
+    if(application->get_parameters().preconditioner == Preconditioner::Multigrid and
+       application->get_parameters().multigrid_data.enable_timings)
+    {
+      pcout << std::endl << "Timings of multigrid components:" << std::endl;
+      timer_tree.print_plain(pcout);
+    }
+
     // Throughput of linear solver in DoFs/s per core
     print_throughput_10(pcout, DoFs, t_10, N_mpi_processes);
 
@@ -202,11 +209,90 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
 #endif
   }
 
+  // CG iterations for the problem A x = b with b = 1 and x = 0 as initial guess. The vector src
+  // is used as search direction p and dst as v = A p. To avoid measuring iterations on an already
+  // converged problem, the iteration is restarted once the residual has been reduced sufficiently.
+  dealii::LinearAlgebra::distributed::Vector<Number> x, r;
+
+  double rho_0 = 1.0;
+  double rho   = 1.0;
+  double alpha = 0.0;
+  double beta  = 0.0;
+
+  const std::function<void(void)> restart_cg_iteration = [&](void) {
+    x = 0.0;
+    r = 1.0;
+    if(operator_type == OperatorType::CGIteration)
+      src = r;
+    else
+      src = 0.0;
+    rho   = r.norm_sqr();
+    alpha = 0.0;
+    beta  = 0.0;
+  };
+
+  if(operator_type == OperatorType::CGIteration or operator_type == OperatorType::FusedCGIteration)
+  {
+    poisson->pde_operator->initialize_dof_vector(x);
+    poisson->pde_operator->initialize_dof_vector(r);
+    restart_cg_iteration();
+    rho_0 = rho;
+  }
+
+  unsigned int const local_size = src.get_partitioner()->locally_owned_size();
+
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::MatrixFree)
     {
       poisson->pde_operator->vmult(dst, src);
     }
+    else if(operator_type == OperatorType::CGIteration)
+    {
+      poisson->pde_operator->vmult(dst, src);
+      alpha = rho / (src * dst);
+      x.add(alpha, src);
+      r.add(-alpha, dst);
+      double const rho_new = r.norm_sqr();
+      src.sadd(rho_new / rho, 1.0, r);
+      rho = rho_new;
+
+      if(rho < 1.e-20 * rho_0)
+        restart_cg_iteration();
+    }
+    else if(operator_type == OperatorType::FusedCGIteration)
+    {
+      double p_times_v = 0.0;
+      poisson->pde_operator->vmult(
+        dst,
+        src,
+        [&](unsigned int const begin, unsigned int const end) {
+          for(unsigned int i = begin; i < end; ++i)
+          {
+            x.local_element(i) += alpha * src.local_element(i);
+            src.local_element(i) = r.local_element(i) + beta * src.local_element(i);
+          }
+        },
+        [&](unsigned int const begin, unsigned int const end) {
+          for(unsigned int i = begin; i < end; ++i)
+            p_times_v += src.local_element(i) * dst.local_element(i);
+        });
+
+      alpha = rho / dealii::Utilities::MPI::sum(p_times_v, mpi_comm);
+
+      double rho_new = 0.0;
+      for(unsigned int i = 0; i < local_size; ++i)
+      {
+        r.local_element(i) -= alpha * dst.local_element(i);
+        rho_new += r.local_element(i) * r.local_element(i);
+      }
+      rho_new = dealii::Utilities::MPI::sum(rho_new, mpi_comm);
+
+      beta = rho_new / rho;
+      rho  = rho_new;
+
+      if(rho < 1.e-20 * rho_0)
+        restart_cg_iteration();
+    }
     else if(operator_type == OperatorType::MatrixBased)
     {
 #ifdef DEAL_II_WITH_TRILINOS
@@ -231,6 +317,24 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
 
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
+  // Minimal number of vector entries transferred from/to main memory per degree of freedom,
+  // assuming that data accessed within one matrix-free loop stays in cache. Data related to the
+  // geometry (e.g. Jacobians) and index data of the matrix-free implementation is not counted, so
+  // that this is a lower bound for the actual memory transfer.
+  unsigned int vector_accesses = 2; // read src, write dst
+  if(operator_type == OperatorType::CGIteration)
+  {
+    // vmult (2), (p,v) (2), x += alpha p (3), r -= alpha v (3), (r,r) (1), p = r + beta p (3)
+    vector_accesses = 14;
+  }
+  else if(operator_type == OperatorType::FusedCGIteration)
+  {
+    // x += alpha p and p = r + beta p (5), vmult and (p,v) (1), r -= alpha v and (r,r) (3)
+    vector_accesses = 9;
+  }
+
+  double const gigabytes_per_second = throughput * vector_accesses * sizeof(Number) / 1.e9;
+
   if(not(is_test))
   {
     // clang-format off
@@ -239,6 +343,10 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
           << "DoFs/sec:        " << throughput << std::endl
           << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
     // clang-format on
+
+    // the memory transfer of matrix-based computations is dominated by the sparse matrix
+    if(operator_type != OperatorType::MatrixBased)
+      pcout << "GB/sec (vectors): " << gigabytes_per_second << std::endl;
   }
 
   pcout << std::endl << " ... done." << std::endl << std::endl;
@@ -38,10 +38,19 @@ namespace ExaDG
 {
 namespace Poisson
 {
+/*
+ * MatrixFree:       matrix-vector product
+ * MatrixBased:      sparse matrix-vector product
+ * CGIteration:      one (unpreconditioned) CG iteration using separate vector operations
+ * FusedCGIteration: one (unpreconditioned) CG iteration with vector operations fused into the
+ *                   matrix-free loop
+ */
 enum class OperatorType
 {
   MatrixFree,
-  MatrixBased
+  MatrixBased,
+  CGIteration,
+  FusedCGIteration
 };
 
 inline std::string
@@ -52,8 +61,10 @@ enum_to_string(OperatorType const enum_type)
   switch(enum_type)
   {
     // clang-format off
-    case OperatorType::MatrixFree:  string_type = "MatrixFree";  break;
-    case OperatorType::MatrixBased: string_type = "MatrixBased"; break;
+    case OperatorType::MatrixFree:       string_type = "MatrixFree";       break;
+    case OperatorType::MatrixBased:      string_type = "MatrixBased";      break;
+    case OperatorType::CGIteration:      string_type = "CGIteration";      break;
+    case OperatorType::FusedCGIteration: string_type = "FusedCGIteration"; break;
     default: AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
       // clang-format on
   }
@@ -65,8 +76,10 @@ inline void
 string_to_enum(OperatorType & enum_type, std::string const string_type)
 {
   // clang-format off
-  if     (string_type == "MatrixFree")  enum_type = OperatorType::MatrixFree;
-  else if(string_type == "MatrixBased") enum_type = OperatorType::MatrixBased;
+  if     (string_type == "MatrixFree")       enum_type = OperatorType::MatrixFree;
+  else if(string_type == "MatrixBased")      enum_type = OperatorType::MatrixBased;
+  else if(string_type == "CGIteration")      enum_type = OperatorType::CGIteration;
+  else if(string_type == "FusedCGIteration") enum_type = OperatorType::FusedCGIteration;
   else AssertThrow(false, dealii::ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
 }
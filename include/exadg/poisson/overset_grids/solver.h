@@ -106,6 +106,9 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
+
   if(general.dim == 2 && general.precision == "float")
     ExaDG::run<2, 1, float>(input_file, mpi_comm);
   else if(general.dim == 2 && general.precision == "double")
@@ -123,6 +123,9 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters             general(input_file);
   ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
 
+  // set the number of threads per MPI process
+  ExaDG::set_number_of_threads(general);
+
   // fill resolution vector
   resolution.fill_resolution_vector(&ExaDG::Poisson::get_dofs_per_element, input_file);
 
@@ -113,6 +113,18 @@ LaplaceOperator<dim, Number, n_components>::reinit_face_cell_based(
   kernel.reinit_face_cell_based(boundary_id, *this->integrator_m, *this->integrator_p);
 }
 
+template<int dim, typename Number, int n_components>
+void
+LaplaceOperator<dim, Number, n_components>::get_fast_diagonalization_coefficients(
+  double & mass_factor,
+  double & diffusivity,
+  double & IP_factor) const
+{
+  mass_factor = 0.0;
+  diffusivity = 1.0;
+  IP_factor   = operator_data.kernel_data.IP_factor;
+}
+
 template<int dim, typename Number, int n_components>
 void
 LaplaceOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & integrator) const
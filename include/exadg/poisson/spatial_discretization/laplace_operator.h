@@ -53,7 +53,7 @@ private:
   typedef FaceIntegrator<dim, n_components, Number> IntegratorFace;
 
 public:
-  LaplaceKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  LaplaceKernel() : degree(1)
   {
   }
 
@@ -182,7 +182,9 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, set in reinit_face*(). It is stored per thread so
+  // that the kernel can be used in task-parallel matrix-free loops.
+  static inline thread_local scalar tau;
 };
 
 } // namespace Operators
@@ -315,6 +317,11 @@ private:
   do_boundary_integral_continuous(IntegratorFace &                   integrator_m,
                                   dealii::types::boundary_id const & boundary_id) const final;
 
+  void
+  get_fast_diagonalization_coefficients(double & mass_factor,
+                                        double & diffusivity,
+                                        double & IP_factor) const final;
+
   LaplaceOperatorData<rank, dim> operator_data;
 
   Operators::LaplaceKernel<dim, Number, n_components> kernel;
@@ -34,7 +34,9 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/fused_cg.h>
 #include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+#include <exadg/solvers_and_preconditioners/solvers/pipelined_cg.h>
 #include <exadg/solvers_and_preconditioners/utilities/check_multigrid.h>
 #include <exadg/solvers_and_preconditioners/utilities/petsc_operation.h>
 #include <exadg/utilities/exceptions.h>
@@ -327,6 +329,40 @@ Operator<dim, n_components, Number>::setup_solver()
       std::make_shared<Krylov::SolverCG<Laplace, PreconditionerBase<Number>, VectorType>>(
         laplace_operator, *preconditioner, solver_data);
   }
+  else if(param.solver == Solver::PipelinedCG)
+  {
+    // initialize solver_data
+    Krylov::SolverDataCG solver_data;
+    solver_data.solver_tolerance_abs        = param.solver_data.abs_tol;
+    solver_data.solver_tolerance_rel        = param.solver_data.rel_tol;
+    solver_data.max_iter                    = param.solver_data.max_iter;
+    solver_data.compute_performance_metrics = param.compute_performance_metrics;
+
+    if(param.preconditioner != Poisson::Preconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    // initialize solver
+    iterative_solver = std::make_shared<
+      Krylov::SolverPipelinedCG<Laplace, PreconditionerBase<Number>, VectorType>>(
+      laplace_operator, *preconditioner, solver_data);
+  }
+  else if(param.solver == Solver::FusedCG)
+  {
+    // initialize solver_data
+    Krylov::SolverDataCG solver_data;
+    solver_data.solver_tolerance_abs        = param.solver_data.abs_tol;
+    solver_data.solver_tolerance_rel        = param.solver_data.rel_tol;
+    solver_data.max_iter                    = param.solver_data.max_iter;
+    solver_data.compute_performance_metrics = param.compute_performance_metrics;
+
+    if(param.preconditioner != Poisson::Preconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    // initialize solver
+    iterative_solver =
+      std::make_shared<Krylov::SolverCGFused<Laplace, PreconditionerBase<Number>, VectorType>>(
+        laplace_operator, *preconditioner, solver_data);
+  }
   else if(param.solver == Solver::FGMRES)
   {
     // initialize solver_data
@@ -397,6 +433,17 @@ Operator<dim, n_components, Number>::vmult(VectorType & dst, VectorType const &
   laplace_operator.vmult(dst, src);
 }
 
+template<int dim, int n_components, typename Number>
+void
+Operator<dim, n_components, Number>::vmult(
+  VectorType &                                                        dst,
+  VectorType const &                                                  src,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop) const
+{
+  laplace_operator.vmult(dst, src, operation_before_loop, operation_after_loop);
+}
+
 template<int dim, int n_components, typename Number>
 unsigned int
 Operator<dim, n_components, Number>::solve(VectorType &       sol,
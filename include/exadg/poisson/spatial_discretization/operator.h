@@ -83,6 +83,17 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Matrix-vector product with vector operations fused into the matrix-free loop, see
+   * OperatorBase::vmult().
+   */
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const;
+
   unsigned int
   solve(VectorType & sol, VectorType const & rhs, double const time) const;
 
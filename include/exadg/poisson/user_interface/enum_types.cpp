@@ -78,6 +78,12 @@ enum_to_string(Solver const enum_type)
     case Solver::CG:
       string_type = "CG";
       break;
+    case Solver::PipelinedCG:
+      string_type = "PipelinedCG";
+      break;
+    case Solver::FusedCG:
+      string_type = "FusedCG";
+      break;
     case Solver::FGMRES:
       string_type = "FGMRES";
       break;
@@ -53,11 +53,16 @@ enum_to_string(SpatialDiscretization const enum_type);
 
 /*
  *   Solver for linear system of equations
+ *
+ *   PipelinedCG: CG variant with a single non-blocking global reduction per iteration
+ *   FusedCG: CG variant with vector updates fused into the matrix-free operator evaluation
  */
 enum class Solver
 {
   Undefined,
   CG,
+  PipelinedCG,
+  FusedCG,
   FGMRES
 };
 
@@ -0,0 +1,313 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_HDF5_OUTPUT_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_HDF5_OUTPUT_H_
+
+// C/C++
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/numerics/data_out.h>
+
+#ifdef DEAL_II_WITH_HDF5
+#  include <hdf5.h>
+#endif
+
+// ExaDG
+#include <exadg/postprocessor/output_data_base.h>
+
+namespace ExaDG
+{
+/*
+ * Writes the patches of a dealii::DataOut object collectively into one HDF5 file per output step
+ * and describes all output steps in an XDMF file, which can be opened with ParaView or VisIt.
+ *
+ * The mesh (nodes and cells) is written only once into a separate HDF5 file, and the files of the
+ * individual output steps contain the field data only. For moving meshes, the patches of later
+ * output steps differ from those of the mesh file only in the positions of the nodes. In this
+ * case, the node displacements with respect to the mesh file are written as an additional vector
+ * field "displacement" so that the deformed mesh can be visualized, e.g., with the WarpByVector
+ * filter of ParaView.
+ *
+ * After a restart, the output steps written before the restart are taken over from the existing
+ * XDMF file, and a new mesh file is written so that the mesh files of these steps remain valid.
+ */
+template<int dim>
+class HDF5Output
+{
+public:
+  HDF5Output(MPI_Comm const & mpi_comm_in) : mpi_comm(mpi_comm_in), mesh_moves(false)
+  {
+#ifndef DEAL_II_WITH_HDF5
+    AssertThrow(false, dealii::ExcMessage("HDF5 output requires deal.II with HDF5 support."));
+#endif
+  }
+
+  /*
+   * Writes the patches of data_out, for which build_patches() has to be called before.
+   */
+  void
+  write(dealii::DataOut<dim> & data_out,
+        OutputDataBase const & output_data,
+        unsigned int const     output_counter,
+        double const           time)
+  {
+    dealii::DataOutBase::DataOutFilter data_filter(
+      dealii::DataOutBase::DataOutFilterFlags(true /* filter duplicate vertices */,
+                                              true /* xdmf/hdf5 output */));
+    data_out.write_filtered_data(data_filter);
+
+    std::string const xdmf_filename = output_data.directory + output_data.filename + ".xdmf";
+    std::string const solution_filename =
+      output_data.filename + "_" + dealii::Utilities::int_to_string(output_counter, 4) + ".h5";
+
+    bool const write_mesh = entries.empty();
+
+    if(write_mesh)
+    {
+      mesh_filename = output_data.filename + "_mesh_" +
+                      dealii::Utilities::int_to_string(output_counter, 4) + ".h5";
+
+      // restart: take over the output steps start_counter, ..., output_counter - 1 (only rank 0
+      // writes the XDMF file)
+      if(output_counter > output_data.start_counter and
+         dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      {
+        previous_grids =
+          read_xdmf_grids(xdmf_filename, output_counter - output_data.start_counter);
+      }
+    }
+
+    data_out.write_hdf5_parallel(data_filter,
+                                 write_mesh,
+                                 output_data.directory + mesh_filename,
+                                 output_data.directory + solution_filename,
+                                 mpi_comm);
+
+    dealii::XDMFEntry entry =
+      data_out.create_xdmf_entry(data_filter, mesh_filename, solution_filename, time, mpi_comm);
+
+    std::vector<double> nodes;
+    data_filter.fill_node_data(nodes);
+
+    if(write_mesh)
+    {
+      reference_nodes = nodes;
+    }
+    else
+    {
+      AssertThrow(nodes.size() == reference_nodes.size(),
+                  dealii::ExcMessage("The patches do not match the mesh written before."));
+
+      std::vector<double> displacement(nodes.size());
+      double              max_displacement = 0.0;
+      for(unsigned int i = 0; i < nodes.size(); ++i)
+      {
+        displacement[i]  = nodes[i] - reference_nodes[i];
+        max_displacement = std::max(max_displacement, std::abs(displacement[i]));
+      }
+
+      // once the mesh has moved, the displacement is written in all subsequent output steps
+      mesh_moves = mesh_moves or dealii::Utilities::MPI::max(max_displacement, mpi_comm) > 0.0;
+
+      if(mesh_moves)
+      {
+        // processes without nodes can not deduce the number of components and take it over
+        // from the other processes
+        unsigned int const n_components = dealii::Utilities::MPI::max(
+          data_filter.n_nodes() > 0 ? (unsigned int)(nodes.size() / data_filter.n_nodes()) : 0u,
+          mpi_comm);
+
+        write_vector_field(output_data.directory + solution_filename,
+                           "displacement",
+                           displacement,
+                           n_components);
+
+        entry.add_attribute("displacement", n_components);
+      }
+    }
+
+    entries.push_back(entry);
+
+    write_xdmf_file(xdmf_filename);
+  }
+
+private:
+  /*
+   * Writes the XDMF file in the same format as dealii::DataOutBase::write_xdmf_file(), including
+   * the output steps taken over from a previous run. Only rank 0 writes the file.
+   */
+  void
+  write_xdmf_file(std::string const & filename) const
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      std::ofstream file(filename);
+      AssertThrow(file, dealii::ExcMessage("Can not open file " + filename + "."));
+
+      file << "<?xml version=\"1.0\" ?>" << std::endl
+           << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>" << std::endl
+           << "<Xdmf Version=\"2.0\">" << std::endl
+           << "  <Domain>" << std::endl
+           << "    <Grid Name=\"CellTime\" GridType=\"Collection\" CollectionType=\"Temporal\">"
+           << std::endl;
+
+      for(auto const & grid : previous_grids)
+        file << grid;
+
+      for(auto const & entry : entries)
+        file << entry.get_xdmf_content(3);
+
+      file << "    </Grid>" << std::endl << "  </Domain>" << std::endl << "</Xdmf>" << std::endl;
+    }
+  }
+
+  /*
+   * Returns (at most) the first n_steps output steps of an existing XDMF file, i.e., the <Grid>
+   * elements nested in the temporal collection. Nothing is returned if the file does not exist,
+   * e.g., if the output counter has been increased since the simulation starts after
+   * output_data.start_time.
+   */
+  static std::vector<std::string>
+  read_xdmf_grids(std::string const & filename, unsigned int const n_steps)
+  {
+    std::ifstream file(filename);
+
+    std::vector<std::string> grids;
+    std::string              grid, line;
+
+    // the outermost <Grid> element is the temporal collection
+    unsigned int depth = 0;
+    while(grids.size() < n_steps and std::getline(file, line))
+    {
+      std::size_t const first = line.find_first_not_of(' ');
+      if(first == std::string::npos)
+        continue;
+
+      if(line.compare(first, 5, "<Grid") == 0)
+        ++depth;
+
+      if(depth >= 2)
+        grid += line + "\n";
+
+      if(line.compare(first, 7, "</Grid>") == 0)
+      {
+        if(depth == 2)
+        {
+          grids.push_back(grid);
+          grid.clear();
+        }
+
+        AssertThrow(depth > 0, dealii::ExcMessage("Invalid XDMF file " + filename + "."));
+        --depth;
+      }
+    }
+
+    return grids;
+  }
+
+  /*
+   * Appends a node-based vector field to an existing HDF5 file, written collectively by all
+   * processes, where each process writes the data of its own nodes.
+   */
+  void
+  write_vector_field(std::string const &         filename,
+                     std::string const &         name,
+                     std::vector<double> const & values,
+                     unsigned int const          n_components) const
+  {
+#ifdef DEAL_II_WITH_HDF5
+    std::uint64_t const n_local_nodes = values.size() / n_components;
+
+    std::uint64_t offset = 0;
+    int           ierr = MPI_Exscan(&n_local_nodes, &offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+    AssertThrowMPI(ierr);
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      offset = 0;
+
+    std::uint64_t const n_global_nodes = dealii::Utilities::MPI::sum(n_local_nodes, mpi_comm);
+
+    hid_t file_access = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(file_access, mpi_comm, MPI_INFO_NULL);
+    hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, file_access);
+    AssertThrow(file >= 0, dealii::ExcMessage("Can not open file " + filename + "."));
+
+    hsize_t const dims[2]   = {n_global_nodes, n_components};
+    hid_t         filespace = H5Screate_simple(2, dims, nullptr);
+    hid_t         dataset   = H5Dcreate(
+      file, name.c_str(), H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    AssertThrow(dataset >= 0,
+                dealii::ExcMessage("Can not create data set " + name + " in file " + filename +
+                                   "."));
+
+    hsize_t const count[2] = {n_local_nodes, n_components};
+    hsize_t const start[2] = {offset, 0};
+    hid_t         memspace = H5Screate_simple(2, count, nullptr);
+    herr_t        status =
+      H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+    AssertThrow(status >= 0,
+                dealii::ExcMessage("Can not select hyperslab of data set " + name + "."));
+
+    hid_t transfer = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(transfer, H5FD_MPIO_COLLECTIVE);
+
+    status = H5Dwrite(dataset, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, values.data());
+    AssertThrow(status >= 0,
+                dealii::ExcMessage("Can not write data set " + name + " to file " + filename +
+                                   "."));
+
+    H5Pclose(transfer);
+    H5Sclose(memspace);
+    H5Dclose(dataset);
+    H5Sclose(filespace);
+    H5Fclose(file);
+    H5Pclose(file_access);
+#else
+    (void)filename;
+    (void)name;
+    (void)values;
+    (void)n_components;
+#endif
+  }
+
+  MPI_Comm const mpi_comm;
+
+  // mesh file and its node coordinates
+  std::string         mesh_filename;
+  std::vector<double> reference_nodes;
+
+  bool mesh_moves;
+
+  // output steps written by this object, and those taken over from the XDMF file after a restart
+  std::vector<dealii::XDMFEntry> entries;
+  std::vector<std::string>       previous_grids;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_HDF5_OUTPUT_H_ */
@@ -214,6 +214,7 @@ KineticEnergyCalculator<dim, Number>::cell_loop(
     }
   }
 
+  std::lock_guard<dealii::Threads::Mutex> lock(mutex);
   dst.at(0) += volume;
   dst.at(1) += energy;
   dst.at(2) += enstrophy;
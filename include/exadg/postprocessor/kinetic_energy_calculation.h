@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_POSTPROCESSOR_KINETIC_ENERGY_CALCULATION_H_
 
 // deal.II
+#include <deal.II/base/thread_management.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
@@ -145,6 +146,9 @@ protected:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   KineticEnergyData                       data;
+
+  // protects the accumulation of the results of all cell ranges in task-parallel loops
+  mutable dealii::Threads::Mutex mutex;
 };
 
 } // namespace ExaDG
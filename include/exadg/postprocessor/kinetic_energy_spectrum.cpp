@@ -25,6 +25,7 @@
 // ExaDG
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/mirror_dof_vector_taylor_green.h>
+#include <exadg/postprocessor/solution_snapshot.h>
 #include <exadg/utilities/create_directories.h>
 
 #ifdef EXADG_WITH_FFTW
@@ -47,10 +48,8 @@ using namespace dealspectrum;
  * Class ordering the calls of the deal.spectrum-components in a meaningful order
  * such that the user can simply integrate in his/her own application.
  *
- * Purpose is twofold:
- *      (1) create files which can be processed by the DEAL.SPECTRUM standalone
- *          application
- *      (2) post process on the fly
+ * Purpose is to post process on the fly. Files for later post processing are written as solution
+ * snapshots, see write_solution_snapshot().
  */
 class DealSpectrumWrapper
 {
@@ -58,12 +57,22 @@ public:
   /**
    * Constructor
    *
-   * @param write     flush simulation data to hard drive for later post processing
-   * @param inplace   create energy spectrum at run time
+   * @param inplace           create energy spectrum at run time
+   * @param planner_effort    planner effort used to create the FFTW plans
+   * @param wisdom_file       FFTW wisdom file (no wisdom is used for an empty string)
    *
    */
-  DealSpectrumWrapper(MPI_Comm const & comm, bool write, bool inplace)
-    : comm(comm), write(write), inplace(inplace), s(comm), ipol(comm, s), fftw(comm, s)
+  DealSpectrumWrapper(MPI_Comm const &        comm,
+                      bool                    inplace,
+                      FFTWPlannerEffort const planner_effort,
+                      std::string const &     wisdom_file)
+    : comm(comm),
+      inplace(inplace),
+      planner_effort(planner_effort),
+      wisdom_file(wisdom_file),
+      s(comm),
+      ipol(comm, s),
+      fftw(comm, s)
   {
   }
 
@@ -127,7 +136,7 @@ public:
 
     // ... fftw
     timer.start("Init-FFTW");
-    fftw.init();
+    fftw.init(get_planner_flags(planner_effort), wisdom_file);
     timer.stop("Init-FFTW");
 
     int start_;
@@ -181,25 +190,14 @@ public:
   }
 
   /**
-   * Process current velocity field:
-   *      - flush to hard drive
-   *      - compute energy spectrum
+   * Process current velocity field: compute energy spectrum
    *
    * @param src   current velocity field
    *
    */
   void
-  execute(double const * src, std::string const & file_name = "", double const time = 0.0)
+  execute(double const * src)
   {
-    if(write)
-    {
-      // flush flow field to hard drive
-      AssertThrow(file_name != "", dealii::ExcMessage("No file name has been provided!"));
-      s.time = time;
-      s.writeHeader(file_name.c_str());
-      ipol.serialize(file_name.c_str(), src);
-    }
-
     if(inplace)
     {
       // compute energy spectrum: interpolate ...
@@ -271,14 +269,35 @@ private:
     return 0;
   }
 
-  MPI_Comm const & comm;
+  static unsigned int
+  get_planner_flags(FFTWPlannerEffort const effort)
+  {
+    switch(effort)
+    {
+      case FFTWPlannerEffort::Estimate:
+        return FFTW_ESTIMATE;
+      case FFTWPlannerEffort::Measure:
+        return FFTW_MEASURE;
+      case FFTWPlannerEffort::Patient:
+        return FFTW_PATIENT;
+      case FFTWPlannerEffort::Exhaustive:
+        return FFTW_EXHAUSTIVE;
+      default:
+        AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    }
 
-  // flush flow field to hard drive?
-  bool const write;
+    return FFTW_ESTIMATE;
+  }
+
+  MPI_Comm const & comm;
 
   // perform spectral analysis
   bool const inplace;
 
+  // FFTW planning
+  FFTWPlannerEffort const planner_effort;
+  std::string const       wisdom_file;
+
   // struct containing the setup
   Setup s;
 
@@ -300,7 +319,7 @@ namespace ExaDG
 class DealSpectrumWrapper
 {
 public:
-  DealSpectrumWrapper(MPI_Comm const &, bool, bool)
+  DealSpectrumWrapper(MPI_Comm const &, bool, FFTWPlannerEffort const, std::string const &)
   {
   }
 
@@ -315,7 +334,7 @@ public:
   }
 
   void
-  execute(double const *, std::string const & = "", double const = 0.0)
+  execute(double const *)
   {
   }
 
@@ -350,19 +369,12 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
 
   if(data.calculate)
   {
-    if(data.write_raw_data_to_files)
-    {
-      AssertThrow(data.n_cells_1d_coarse_grid == 1,
-                  dealii::ExcMessage(
-                    "Choosing write_raw_data_to_files = true requires n_cells_1d_coarse_grid == 1. "
-                    "If you want to use n_cells_1d_coarse_grid != 1 (subdivided hypercube), set "
-                    "do_fftw = true and write_raw_data_to_files = false."));
-    }
-
     if(deal_spectrum_wrapper == nullptr)
     {
-      deal_spectrum_wrapper =
-        std::make_shared<DealSpectrumWrapper>(mpi_comm, data.write_raw_data_to_files, data.do_fftw);
+      deal_spectrum_wrapper = std::make_shared<DealSpectrumWrapper>(mpi_comm,
+                                                                    data.do_fftw,
+                                                                    data.fftw_planner_effort,
+                                                                    data.fftw_wisdom_file);
     }
 
     unsigned int evaluation_points = std::max(data.degree + 1, data.evaluation_points_per_cell);
@@ -504,15 +516,30 @@ void
 KineticEnergySpectrumCalculator<dim, Number>::do_evaluate(VectorType const & velocity,
                                                           double const       time)
 {
-  // extract beginning of vector...
-  Number const * temp = velocity.begin();
-
-  std::string const file_name = data.filename + "_" + dealii::Utilities::int_to_string(counter, 4);
-
-  deal_spectrum_wrapper->execute((double *)temp, file_name, time);
+  if(data.write_raw_data_to_files)
+  {
+    dealii::DoFHandler<dim> const & dof_handler_velocity =
+      data.exploit_symmetry ? *dof_handler_full : *dof_handler;
+
+    std::string const file_name = data.directory + data.filename + "_" +
+                                  dealii::Utilities::int_to_string(counter, 4) + ".snapshot";
+
+    write_solution_snapshot<dim, Number>(file_name,
+                                         dof_handler_velocity,
+                                         {"velocity"},
+                                         {&velocity},
+                                         time,
+                                         data.write_raw_data_single_precision,
+                                         mpi_comm);
+  }
 
   if(data.do_fftw)
   {
+    // extract beginning of vector...
+    Number const * temp = velocity.begin();
+
+    deal_spectrum_wrapper->execute((double *)temp);
+
     // write output file
     if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
     {
@@ -35,12 +35,46 @@ namespace ExaDG
 // forward declaration
 class DealSpectrumWrapper;
 
+/*
+ * Planner effort used to create the FFTW plans. A higher effort increases the setup costs once
+ * but typically results in faster transforms during the simulation.
+ */
+enum class FFTWPlannerEffort
+{
+  Estimate,
+  Measure,
+  Patient,
+  Exhaustive
+};
+
+inline std::string
+enum_to_string(FFTWPlannerEffort const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    // clang-format off
+    case FFTWPlannerEffort::Estimate:   string_type = "Estimate";   break;
+    case FFTWPlannerEffort::Measure:    string_type = "Measure";    break;
+    case FFTWPlannerEffort::Patient:    string_type = "Patient";    break;
+    case FFTWPlannerEffort::Exhaustive: string_type = "Exhaustive"; break;
+    default: AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
+      // clang-format on
+  }
+
+  return string_type;
+}
+
 struct KineticEnergySpectrumData
 {
   KineticEnergySpectrumData()
     : calculate(false),
       write_raw_data_to_files(false),
+      write_raw_data_single_precision(false),
       do_fftw(true),
+      fftw_planner_effort(FFTWPlannerEffort::Estimate),
+      fftw_wisdom_file(""),
       start_time(0.0),
       calculate_every_time_steps(-1),
       calculate_every_time_interval(-1.0),
@@ -63,7 +97,15 @@ struct KineticEnergySpectrumData
     {
       pcout << std::endl << "  Calculate kinetic energy spectrum:" << std::endl;
       print_parameter(pcout, "Write raw data to files", write_raw_data_to_files);
+      if(write_raw_data_to_files)
+        print_parameter(pcout, "Raw data in single precision", write_raw_data_single_precision);
       print_parameter(pcout, "Do FFTW", do_fftw);
+      if(do_fftw)
+      {
+        print_parameter(pcout, "FFTW planner effort", enum_to_string(fftw_planner_effort));
+        if(!fftw_wisdom_file.empty())
+          print_parameter(pcout, "FFTW wisdom file", fftw_wisdom_file);
+      }
       print_parameter(pcout, "Start time", start_time);
       if(calculate_every_time_steps >= 0)
         print_parameter(pcout, "Calculate every timesteps", calculate_every_time_steps);
@@ -85,9 +127,21 @@ struct KineticEnergySpectrumData
     }
   }
 
-  bool   calculate;
-  bool   write_raw_data_to_files;
-  bool   do_fftw;
+  bool calculate;
+
+  // write the velocity field as solution snapshot (raw DG coefficients) for later post processing,
+  // optionally converted to single precision
+  bool write_raw_data_to_files;
+  bool write_raw_data_single_precision;
+
+  bool do_fftw;
+
+  // FFTW plans are created once during setup with the given planner effort. If a wisdom file is
+  // specified, wisdom is imported from this file before planning and exported after planning so
+  // that the planning costs of a higher effort are paid only once across simulations.
+  FFTWPlannerEffort fftw_planner_effort;
+  std::string       fftw_wisdom_file;
+
   double start_time;
   int    calculate_every_time_steps;
   double calculate_every_time_interval;
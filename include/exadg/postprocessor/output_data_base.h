@@ -40,10 +40,23 @@ struct OutputDataBase
       write_grid(false),
       write_processor_id(false),
       write_higher_order(true),
-      degree(1)
+      degree(1),
+      asynchronous(false),
+      max_pending_outputs(1),
+      write_hdf5(false)
   {
   }
 
+  void
+  check() const
+  {
+    if(write_output == true)
+    {
+      AssertThrow(not(asynchronous and write_hdf5),
+                  dealii::ExcMessage("HDF5 output can not be written asynchronously."));
+    }
+  }
+
   void
   print(dealii::ConditionalOStream & pcout, bool unsteady)
   {
@@ -69,6 +82,12 @@ struct OutputDataBase
 
       print_parameter(pcout, "Write higher order", write_higher_order);
       print_parameter(pcout, "Polynomial degree", degree);
+
+      print_parameter(pcout, "Asynchronous output", asynchronous);
+      if(asynchronous)
+        print_parameter(pcout, "Maximum number of pending outputs", max_pending_outputs);
+
+      print_parameter(pcout, "Write HDF5/XDMF", write_hdf5);
     }
   }
 
@@ -114,6 +133,21 @@ struct OutputDataBase
   // case of write_higher_order = false, this variable defines the number of subdivisions of a cell,
   // with ParaView using linear interpolation for visualization on these subdivided cells.
   unsigned int degree;
+
+  // Build patches and write files on a background thread while the simulation continues. The
+  // solution vectors are copied, and the number of outputs that are pending at the same time is
+  // limited by max_pending_outputs to bound the memory consumption. Each process writes its own
+  // vtu file in this case. For moving meshes, the patches are built before the time loop continues
+  // since the mapping changes, and only the files are written in the background.
+  bool asynchronous;
+
+  unsigned int max_pending_outputs;
+
+  // Write the output collectively into one HDF5 file per output step instead of vtu files per
+  // process, together with an XDMF file describing all output steps. The mesh is written only once
+  // into a separate HDF5 file (and node displacements for moving meshes). Can not be combined with
+  // asynchronous output.
+  bool write_hdf5;
 };
 
 } // namespace ExaDG
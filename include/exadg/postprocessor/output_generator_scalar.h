@@ -28,7 +28,9 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/hdf5_output.h>
 #include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/output_pipeline.h>
 
 namespace ExaDG
 {
@@ -57,6 +59,9 @@ private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
   OutputDataBase                                      output_data;
+
+  std::shared_ptr<OutputPipeline>  pipeline;
+  std::shared_ptr<HDF5Output<dim>> hdf5_output;
 };
 
 } // namespace ExaDG
@@ -0,0 +1,170 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_PIPELINE_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_PIPELINE_H_
+
+// C/C++
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+namespace ExaDG
+{
+/*
+ * Executes output jobs, e.g. building patches and writing files, on a background thread so that
+ * the time loop can continue while output is written. Jobs are executed in the order in which they
+ * have been submitted. To bound the memory consumption of the data copied for pending jobs,
+ * submit() blocks if max_pending_jobs jobs are pending. Since the MPI library is not necessarily
+ * initialized with support for multiple threads, jobs must not call MPI functions.
+ */
+class OutputPipeline
+{
+public:
+  OutputPipeline(unsigned int const max_pending_jobs_in)
+    : max_pending_jobs(max_pending_jobs_in), n_pending_jobs(0), finished(false)
+  {
+    AssertThrow(max_pending_jobs > 0,
+                dealii::ExcMessage("The number of pending output jobs has to be positive."));
+
+    worker = std::thread(&OutputPipeline::run, this);
+  }
+
+  ~OutputPipeline()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished = true;
+    }
+    condition_jobs.notify_one();
+
+    worker.join();
+  }
+
+  void
+  submit(std::function<void()> const & job)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition_pending.wait(lock, [&]() { return n_pending_jobs < max_pending_jobs; });
+
+    jobs.push_back(job);
+    ++n_pending_jobs;
+
+    lock.unlock();
+    condition_jobs.notify_one();
+  }
+
+  /*
+   * Blocks until all submitted jobs have been completed.
+   */
+  void
+  wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition_pending.wait(lock, [&]() { return n_pending_jobs == 0; });
+  }
+
+private:
+  void
+  run()
+  {
+    while(true)
+    {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition_jobs.wait(lock, [&]() { return finished or not jobs.empty(); });
+
+        // complete all pending jobs before finishing
+        if(jobs.empty())
+          return;
+
+        job = jobs.front();
+        jobs.pop_front();
+      }
+
+      job();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        --n_pending_jobs;
+      }
+      condition_pending.notify_all();
+    }
+  }
+
+  unsigned int const max_pending_jobs;
+
+  // number of jobs that have been submitted but not yet completed
+  unsigned int n_pending_jobs;
+
+  bool finished;
+
+  std::deque<std::function<void()>> jobs;
+
+  std::mutex              mutex;
+  std::condition_variable condition_jobs;
+  std::condition_variable condition_pending;
+
+  std::thread worker;
+};
+
+/*
+ * Vectors attached to a dealii::DataOut object. For output in the background (see OutputPipeline),
+ * copies including ghost values are stored since the original vectors change while the output is
+ * written. Otherwise, the original vectors are used.
+ */
+template<typename VectorType>
+class OutputVectors
+{
+public:
+  OutputVectors(bool const copy_in) : copy(copy_in)
+  {
+  }
+
+  VectorType const &
+  get(VectorType const & vector)
+  {
+    if(not copy)
+      return vector;
+
+    copies.emplace_back(vector);
+    copies.back().update_ghost_values();
+
+    return copies.back();
+  }
+
+private:
+  bool const copy;
+
+  // std::list since references to the elements must remain valid
+  std::list<VectorType> copies;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_PIPELINE_H_ */
@@ -25,7 +25,6 @@
 // ExaDG
 #include <exadg/postprocessor/pressure_difference_calculation.h>
 #include <exadg/utilities/create_directories.h>
-#include <exadg/vector_tools/point_value.h>
 
 namespace ExaDG
 {
@@ -47,7 +46,18 @@ PressureDifferenceCalculator<dim, Number>::setup(
   data                 = data_in;
 
   if(data.calculate)
+  {
     create_directories(data.directory, mpi_comm);
+
+    // the pressure difference is only needed on rank 0, which writes the file
+    point_evaluator.setup({data.point_1, data.point_2},
+                          dof_handler_pressure->get_triangulation(),
+                          *mapping,
+                          1.e-10 /* tolerance */,
+                          0 /* consumer rank */);
+
+    AssertThrow(point_evaluator.all_points_found(), dealii::ExcMessage("No points found."));
+  }
 }
 
 template<int dim, typename Number>
@@ -57,21 +67,14 @@ PressureDifferenceCalculator<dim, Number>::evaluate(VectorType const & pressure,
 {
   if(data.calculate)
   {
-    Number pressure_1 = 0.0, pressure_2 = 0.0;
-
-    dealii::Point<dim> point_1, point_2;
-    point_1 = data.point_1;
-    point_2 = data.point_2;
-
-    evaluate_scalar_quantity_in_point(
-      pressure_1, *dof_handler_pressure, *mapping, pressure, point_1, mpi_comm);
-    evaluate_scalar_quantity_in_point(
-      pressure_2, *dof_handler_pressure, *mapping, pressure, point_2, mpi_comm);
-
-    Number const pressure_difference = pressure_1 - pressure_2;
+    // evaluate pressure in both points at once
+    std::vector<Number> const pressure_values =
+      point_evaluator.evaluate_scalar(*dof_handler_pressure, pressure);
 
     if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
     {
+      Number const pressure_difference = pressure_values[0] - pressure_values[1];
+
       std::string filename = data.directory + data.filename;
 
       unsigned int precision = 12;
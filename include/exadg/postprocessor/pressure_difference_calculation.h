@@ -28,6 +28,9 @@
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/vector_tools/point_evaluator.h>
+
 namespace ExaDG
 {
 template<int dim>
@@ -81,6 +84,8 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   PressureDifferenceData<dim> data;
+
+  PointEvaluator<dim, Number> point_evaluator;
 };
 
 } // namespace ExaDG
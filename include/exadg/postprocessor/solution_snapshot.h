@@ -0,0 +1,268 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_SOLUTION_SNAPSHOT_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_SOLUTION_SNAPSHOT_H_
+
+// C/C++
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+
+// boost
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/restart.h>
+
+namespace ExaDG
+{
+/*
+ * Meta data of a solution snapshot. The partition of the cells among the processes of the run
+ * that has written the snapshot is stored in terms of the number of cells per process, where the
+ * cells are numbered along the space-filling curve (see
+ * get_locally_owned_cells_space_filling_curve()).
+ */
+struct SnapshotMetadata
+{
+  SnapshotMetadata() : version(1), dim(0), time(0.0)
+  {
+  }
+
+  template<typename Archive>
+  void
+  serialize(Archive & ar, unsigned int const /* version */)
+  {
+    ar & version;
+    ar & dim;
+    ar & fe_name;
+    ar & time;
+    ar & field_names;
+    ar & n_cells_per_process;
+  }
+
+  unsigned int version;
+
+  unsigned int dim;
+
+  // name of the finite element, e.g., FESystem<3>[FE_DGQ<3>(3)^3]
+  std::string fe_name;
+
+  double time;
+
+  std::vector<std::string> field_names;
+
+  std::vector<std::uint64_t> n_cells_per_process;
+};
+
+/*
+ * Writes a snapshot of solution fields, i.e., the raw cell-wise coefficient vectors of the finite
+ * element described by dof_handler, collectively into a single file with MPI-IO. In contrast to
+ * the output for visualization, no interpolation to subdivided patches takes place, so that the
+ * high-order representation is retained at minimal file size. With single_precision = true, the
+ * coefficients are converted to float, which halves the file size. The file layout is that of the
+ * collective restart files (see CollectiveRestartFile), so that a snapshot can be read on any
+ * number of processes, see read_solution_snapshot() and SolutionSnapshotReader.
+ */
+template<int dim, typename Number>
+void
+write_solution_snapshot(
+  std::string const &                                                             filename,
+  dealii::DoFHandler<dim> const &                                                 dof_handler,
+  std::vector<std::string> const &                                                field_names,
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number> const *> const & fields,
+  double const                                                                    time,
+  bool const                                                                      single_precision,
+  MPI_Comm const &                                                                mpi_comm)
+{
+  AssertThrow(field_names.size() == fields.size(),
+              dealii::ExcMessage("Number of field names and fields do not match."));
+
+  SnapshotMetadata metadata;
+  metadata.dim         = dim;
+  metadata.fe_name     = dof_handler.get_fe().get_name();
+  metadata.time        = time;
+  metadata.field_names = field_names;
+
+  std::uint64_t const n_locally_owned_cells =
+    dof_handler.get_triangulation().n_locally_owned_active_cells();
+  metadata.n_cells_per_process = dealii::Utilities::MPI::gather(mpi_comm, n_locally_owned_cells, 0);
+
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    oa << metadata;
+  }
+
+  CollectiveRestartFile file(filename, mpi_comm, true /* write */);
+
+  file.write_preamble(oss.str());
+  for(auto const field : fields)
+    file.write_vector(*field, dof_handler, single_precision);
+
+  file.close();
+}
+
+/*
+ * Reads the meta data from the preamble of a snapshot file.
+ */
+inline SnapshotMetadata
+read_snapshot_metadata(CollectiveRestartFile & file)
+{
+  SnapshotMetadata metadata;
+
+  std::istringstream              iss(file.read_preamble());
+  boost::archive::binary_iarchive ia(iss);
+  ia >> metadata;
+
+  return metadata;
+}
+
+/*
+ * Reads a snapshot written by write_solution_snapshot() into the given vectors, which have to be
+ * initialized for dof_handler. The snapshot can be read on a different number of processes than
+ * it has been written with, as long as the triangulation and the finite element are the same.
+ * Coefficients stored in single precision are converted to Number. The meta data is returned.
+ */
+template<int dim, typename Number>
+SnapshotMetadata
+read_solution_snapshot(
+  std::string const &                                                       filename,
+  dealii::DoFHandler<dim> const &                                           dof_handler,
+  std::vector<dealii::LinearAlgebra::distributed::Vector<Number> *> const & fields,
+  MPI_Comm const &                                                          mpi_comm)
+{
+  CollectiveRestartFile file(filename, mpi_comm, false /* write */);
+
+  SnapshotMetadata const metadata = read_snapshot_metadata(file);
+
+  AssertThrow(metadata.dim == dim and metadata.fe_name == dof_handler.get_fe().get_name(),
+              dealii::ExcMessage("The snapshot " + filename + " has been written for " +
+                                 metadata.fe_name + " and can not be read for " +
+                                 dof_handler.get_fe().get_name() + "."));
+
+  AssertThrow(metadata.field_names.size() == fields.size(),
+              dealii::ExcMessage("The snapshot " + filename + " contains " +
+                                 std::to_string(metadata.field_names.size()) + " fields."));
+
+  for(auto const field : fields)
+    file.read_vector(*field, dof_handler);
+
+  file.close();
+
+  return metadata;
+}
+
+/*
+ * Reconstructs the fields of a snapshot for offline postprocessing. Only the triangulation the
+ * snapshot has been written for has to be provided, which may be distributed among a different
+ * number of processes than in the run that has written the snapshot. The finite element is
+ * created from its name stored in the snapshot, and the fields are stored in vectors of type
+ * Number for the DoFHandler of this class.
+ */
+template<int dim, typename Number>
+class SolutionSnapshotReader
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  SolutionSnapshotReader(dealii::Triangulation<dim> const & triangulation)
+    : mpi_comm(triangulation.get_communicator()), dof_handler(triangulation)
+  {
+  }
+
+  void
+  read(std::string const & filename)
+  {
+    SnapshotMetadata metadata_file;
+    {
+      CollectiveRestartFile file(filename, mpi_comm, false /* write */);
+      metadata_file = read_snapshot_metadata(file);
+      file.close();
+    }
+
+    AssertThrow(metadata_file.dim == dim,
+                dealii::ExcMessage("The snapshot " + filename + " has been written for dim = " +
+                                   std::to_string(metadata_file.dim) + "."));
+
+    fe = dealii::FETools::get_fe_by_name<dim, dim>(metadata_file.fe_name);
+    dof_handler.distribute_dofs(*fe);
+
+    fields.resize(metadata_file.field_names.size());
+    std::vector<VectorType *> field_pointers;
+    for(auto & field : fields)
+    {
+      field.reinit(dof_handler.locally_owned_dofs(), mpi_comm);
+      field_pointers.push_back(&field);
+    }
+
+    metadata = read_solution_snapshot<dim, Number>(filename, dof_handler, field_pointers, mpi_comm);
+  }
+
+  SnapshotMetadata const &
+  get_metadata() const
+  {
+    return metadata;
+  }
+
+  dealii::DoFHandler<dim> const &
+  get_dof_handler() const
+  {
+    return dof_handler;
+  }
+
+  VectorType const &
+  get_field(std::string const & name) const
+  {
+    auto const it = std::find(metadata.field_names.begin(), metadata.field_names.end(), name);
+
+    AssertThrow(it != metadata.field_names.end(),
+                dealii::ExcMessage("The snapshot does not contain the field " + name + "."));
+
+    return fields[it - metadata.field_names.begin()];
+  }
+
+private:
+  MPI_Comm const mpi_comm;
+
+  std::unique_ptr<dealii::FiniteElement<dim>> fe;
+
+  dealii::DoFHandler<dim> dof_handler;
+
+  SnapshotMetadata metadata;
+
+  std::vector<VectorType> fields;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_SOLUTION_SNAPSHOT_H_ */
@@ -54,8 +54,6 @@ public:
   Setup & s;
   // is initialized?
   bool initialized;
-  // source vector (values to be interpolated)
-  double * src = NULL;
   // destination vector (interpolated values)
   double * dst = NULL;
   // shape function (gauss lobatto to equidistant)
@@ -88,7 +86,6 @@ public:
     if(!initialized)
       return;
 
-    delete[] src;
     delete[] dst;
   }
 
@@ -129,9 +126,7 @@ public:
     // ...number of equidistant points per cell
     dofs_target = dealii::Utilities::pow(points_target, DIM);
 
-    // allocate memory for source (only needed if values are read by IO)...
-    src = new double[cells * dofs_source * DIM];
-    // ... and target
+    // allocate memory for target
     dst = new double[cells * dofs_target * DIM];
 
     // fill shape values
@@ -176,17 +171,6 @@ public:
         shape_values[i * points_target + q] = matrix(q, i);
   }
 
-  /**
-   * Perform interpolation and permute dofs such that u, v, and w
-   * for each point are grouped together. Use local source vector.
-   */
-  void
-  interpolate()
-  {
-    double const * src = this->src;
-    interpolate(src);
-  }
-
   /**
    * Perform interpolation and permute dofs such that u, v, and w
    * for each point are grouped together. Source vector is explicitly given
@@ -241,17 +225,6 @@ public:
     }
   }
 
-  /**
-   * Only for testing:
-   * Do not perform interpolation and only permute dofs such that u, v, and w
-   * for each point are grouped together. Use local source vector.
-   */
-  void
-  interpolate_simple()
-  {
-    interpolate_simple(src);
-  }
-
   /**
    * Only for testing:
    * Do not perform interpolation and only permute dofs such that u, v, and w
@@ -282,99 +255,6 @@ public:
       dst_ += dofs_target * DIM;
     }
   }
-
-  /**
-   * Read local source vector from file.
-   *
-   * @param filename  filename
-   */
-  void
-  deserialize(char const * filename)
-  {
-    deserialize(filename, src);
-  }
-
-  /**
-   * Read explicitly given source vector from file.
-   *
-   * @param filename  filename
-   * @param src       source vector
-   */
-  void
-  deserialize(char const * filename, double *& src)
-  {
-    io(0, filename, src);
-  }
-
-  /**
-   * Write local source vector to file.
-   *
-   * @param filename  filename
-   */
-  void
-  serialize(char const * filename)
-  {
-    double const * src = this->src;
-    serialize(filename, src);
-  }
-
-  /**
-   * Write explicitly given source vector to file.
-   *
-   * @param filename  filename
-   * @param src       source vector
-   */
-  void
-  serialize(char const * filename, double const *& src)
-  {
-    io(1, filename, src);
-  }
-
-  /**
-   * Read/write explicitly given source vector to file.
-   *
-   * @param type      0: read; 1: write
-   * @param filename  filename
-   * @param src       source vector
-   */
-  template<typename VEC>
-  void
-  io(int type, char const * filename, VEC & src)
-  {
-    // dofs to read/write per field
-    unsigned long int dofs = cells * dofs_source;
-    // local displacement in file (in bytes)
-    MPI_Offset disp =
-      8 * sizeof(int) + static_cast<unsigned long int>(start) * dofs_source * sizeof(double) * DIM;
-
-    // create view
-    MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
-    MPI_Type_commit(&stype);
-
-    // ooen file ...
-    MPI_File fh;
-    if(type == 0)
-      MPI_File_open(comm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
-    else
-      MPI_File_open(comm, filename, MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
-
-    // ... set view
-    MPI_File_set_view(fh, disp, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-
-    if(type == 0)
-      // ... read file
-      MPI_File_read_all(fh, (void *)src, dofs * DIM, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-    else
-      // ... write file
-      MPI_File_write_all(fh, src, dofs * DIM, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    // ... close file
-    MPI_File_close(&fh);
-
-    // clean up
-    MPI_Type_free(&stype);
-  }
 };
 
 } // namespace dealspectrum
@@ -119,114 +119,6 @@ public:
     this->points_dst = points_dst;
     this->bins       = 1;
   }
-
-  /**
-   * Read header of file
-   *
-   * @param filename name of file
-   */
-  int
-  readHeader(char *& filename)
-  {
-    FILE * fp;
-    int    crit[1 + 4];
-    crit[0] = 0;
-
-    if(this->rank == 0)
-    {
-      // read header only by rank 0 ...
-      if((fp = fopen(filename, "r")) != NULL)
-      {
-        // ... read header in one go
-        fread(crit + 1, sizeof(int), 4, fp);
-
-        // read time
-        fread(&this->time, sizeof(double), 1, fp);
-
-        // ... close file
-        fclose(fp);
-      }
-      else
-      {
-        // ... reading the file failed
-        crit[0] = 0;
-      }
-    }
-
-    // broadcast header to all processes
-    MPI_Bcast(&crit, 5, MPI_INT, 0, comm);
-    MPI_Bcast(&this->time, 1, MPI_DOUBLE, 0, comm);
-
-    if(this->initialized)
-    {
-      // ... extract header by each process and set properties
-      crit[0] += this->type != crit[1];
-      crit[0] += this->dim != crit[2];
-      crit[0] += this->cells != crit[3];
-      crit[0] += this->degree != crit[4];
-    }
-    else
-    {
-      // ... extract header by each process and set properties
-      this->type       = crit[1];
-      this->dim        = crit[2];
-      this->cells      = crit[3];
-      this->degree     = crit[4];
-      this->points_src = this->degree + 1;
-      if(this->points_dst == 0)
-        this->points_dst = this->points_src; // equal if nothing specified
-    }
-
-    // success or failure?
-    return crit[0];
-  }
-
-  /**
-   * Write header of file
-   *
-   * @param filename name of file
-   */
-  void
-  writeHeader(char const * filename)
-  {
-    FILE * fp;
-
-    if(this->rank == 0)
-    {
-      // write header only by rank 0 ...
-      if((fp = fopen(filename, "w")) != NULL)
-      {
-        // ... write type
-        fwrite(&this->type, sizeof(int), 1, fp);
-        // ... write dim
-        fwrite(&this->dim, sizeof(int), 1, fp);
-
-        if(this->type == 0)
-        {
-          // ... cell wise:
-          fwrite(&this->cells, sizeof(int), 1, fp);
-          fwrite(&this->degree, sizeof(int), 1, fp);
-        }
-        else
-        {
-          // ... row wise (degree is redundant):
-          int temp1 = this->cells * this->points_dst;
-          int temp2 = 0;
-          fwrite(&temp1, sizeof(int), temp1, fp);
-          fwrite(&temp2, sizeof(int), temp2, fp);
-        }
-
-        // write time
-        fwrite(&this->time, sizeof(double), 1, fp);
-
-        // ... close file
-        fclose(fp);
-      }
-    }
-
-    // synchronize all processes (not necessary)
-    MPI_Barrier(comm);
-  }
 };
 
 } // namespace dealspectrum
@@ -25,6 +25,7 @@
 #include <fftw3-mpi.h>
 #include <mpi.h>
 #include <cmath>
+#include <string>
 
 // ExaDG
 #include <exadg/postprocessor/spectral_analysis/setup.h>
@@ -87,10 +88,17 @@ public:
   }
 
   /**
-   * Initialize data structures
+   * Initialize data structures and create the FFTW plans, which are reused by all calls of
+   * execute().
+   *
+   * @param planner_flags   FFTW planner effort, e.g., FFTW_ESTIMATE, FFTW_MEASURE, or
+   *                        FFTW_PATIENT
+   * @param wisdom_file     file from which FFTW wisdom is imported before planning (if it exists)
+   *                        and to which the accumulated wisdom is exported after planning; no
+   *                        wisdom is used for an empty file name
    */
   void
-  init()
+  init(unsigned int const planner_flags = FFTW_ESTIMATE, std::string const & wisdom_file = "")
   {
     // check if already initialized
     if(this->initialized)
@@ -138,10 +146,6 @@ public:
     // ... and save required size
     this->bsize = 2 * alloc_local;
 
-    // initialize input array with zero (not needed: only useful for IO -> hard zero)
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-      u_real[i] = 0;
-
     // set pointer for v input field
     v_real = u_real + 2 * alloc_local;
 
@@ -156,6 +160,33 @@ public:
       w_comp = fftw_alloc_complex(alloc_local);
     }
 
+    // create plans: this has to be done before the input arrays are initialized since planning
+    // with a flag other than FFTW_ESTIMATE overwrites the arrays
+    if(!wisdom_file.empty())
+    {
+      // import wisdom on rank 0 (ignore a missing file) and share it with all processes
+      if(rank == 0)
+        fftw_import_wisdom_from_filename(wisdom_file.c_str());
+      fftw_mpi_broadcast_wisdom(comm);
+    }
+
+    plan_u = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, planner_flags);
+    plan_v = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, planner_flags);
+    if(dim == 3)
+      plan_w = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, planner_flags);
+
+    if(!wisdom_file.empty())
+    {
+      // collect wisdom of all processes and export it on rank 0
+      fftw_mpi_gather_wisdom(comm);
+      if(rank == 0)
+        fftw_export_wisdom_to_filename(wisdom_file.c_str());
+    }
+
+    // initialize input array with zero (not needed: only useful for IO -> hard zero)
+    for(int i = 0; i < 2 * alloc_local * dim; i++)
+      u_real[i] = 0;
+
     // allocate memory and ...
     this->e = new double[N];
     this->E = new double[N];
@@ -175,6 +206,11 @@ public:
       return;
 
     // free data structures
+    fftw_destroy_plan(plan_u);
+    fftw_destroy_plan(plan_v);
+    if(dim == 3)
+      fftw_destroy_plan(plan_w);
+
     delete[] _indices_proc_rows;
 
     free(n);
@@ -196,28 +232,20 @@ public:
   }
 
   /**
-   * Perform FFT with FFTW
+   * Perform FFT with FFTW using the plans created in init()
    */
   void
   execute()
   {
     // perform FFT for u
-    fftw_plan pu = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pu);
-    fftw_destroy_plan(pu);
+    fftw_execute(plan_u);
 
     // ... for v
-    fftw_plan pv = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pv);
-    fftw_destroy_plan(pv);
+    fftw_execute(plan_v);
 
     // ... for w
     if(dim == 3)
-    {
-      fftw_plan pw = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, FFTW_ESTIMATE);
-      fftw_execute(pw);
-      fftw_destroy_plan(pw);
-    }
+      fftw_execute(plan_w);
   }
 
   void
@@ -504,6 +532,10 @@ private:
   fftw_complex * v_comp;
   // ... for w
   fftw_complex * w_comp;
+  // FFTW plans for u, v, and w
+  fftw_plan plan_u;
+  fftw_plan plan_v;
+  fftw_plan plan_w;
 
 private:
   // array for locally collecting energy
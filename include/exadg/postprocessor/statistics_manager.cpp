@@ -23,11 +23,11 @@
 #include <fstream>
 
 // deal.II
-#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/distributed/tria_base.h>
 #include <deal.II/fe/fe_values.h>
 
 // ExaDG
+#include <exadg/matrix_free/integrators.h>
 #include <exadg/postprocessor/statistics_manager.h>
 #include <exadg/utilities/create_directories.h>
 
@@ -37,12 +37,19 @@ namespace ExaDG
 {
 template<int dim, typename Number>
 StatisticsManager<dim, Number>::StatisticsManager(
-  dealii::DoFHandler<dim> const & dof_handler_velocity,
-  dealii::Mapping<dim> const &    mapping_in)
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_velocity,
+  unsigned int const                      quad_index_velocity,
+  dealii::Mapping<dim> const &            mapping_in)
   : n_points_y_per_cell(0),
-    dof_handler(dof_handler_velocity),
+    matrix_free(matrix_free_in),
+    dof_index(dof_index_velocity),
+    quad_index(quad_index_velocity),
+    dof_handler(matrix_free_in.get_dof_handler(dof_index_velocity)),
     mapping(mapping_in),
-    mpi_comm(dof_handler_velocity.get_communicator()),
+    mpi_comm(dof_handler.get_communicator()),
+    n_q_points_1d(0),
+    n_q_points_xz(0),
     number_of_samples(0),
     write_final_output(true),
     data(TurbulentChannelData())
@@ -122,6 +129,11 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
     // calculate y-coordinates in physical space where we want to perform the sampling (averaging)
     y_glob.reserve(n_points_y_glob);
 
+    // precompute geometry information for the x-z-planes of all cells
+    std::vector<double> const y_planes = setup_plane_data();
+
+    unsigned int const n_lanes = scalar::size();
+
     // loop over all cells in y-direction
     if(data.cells_are_stretched == true)
     {
@@ -166,76 +178,29 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
       // 'fe_degree' which leads to slightly different values as compared to the exact mapping.
       // -> overwrite values in y_glob with values resulting from polynomial mapping
 
-      // use 2d quadrature to integrate over x-z-planes
-      unsigned int const      fe_degree = dof_handler.get_fe().degree;
-      dealii::QGauss<dim - 1> gauss_2d(fe_degree + 1);
-
       std::vector<double> y_processor;
       y_processor.resize(n_points_y_glob, std::numeric_limits<double>::lowest());
 
-      // vector of dealii::FEValues for all x-z-planes of a cell
-      std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
-
-      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
-      {
-        std::vector<dealii::Point<dim>> points(gauss_2d.size());
-        std::vector<double>             weights(gauss_2d.size());
-        for(unsigned int j = 0; j < gauss_2d.size(); ++j)
-        {
-          points[j][0] = gauss_2d.point(j)[0];
-          if(dim == 3)
-            points[j][2] = gauss_2d.point(j)[1];
-          points[j][1] = (double)i / (n_points_y_per_cell - 1);
-          weights[j]   = gauss_2d.weight(j);
-        }
-        fe_values[i].reset(new dealii::FEValues<dim>(mapping,
-                                                     dof_handler.get_fe().base_element(0),
-                                                     dealii::Quadrature<dim>(points, weights),
-                                                     dealii::update_values |
-                                                       dealii::update_jacobians |
-                                                       dealii::update_quadrature_points));
-      }
-
       // loop over all cells
-      for(auto const & cell : dof_handler.active_cell_iterators())
+      for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
       {
-        if(cell->is_locally_owned())
+        for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
         {
           // loop over all y-coordinates of current cell
           unsigned int idx = 0;
           for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
           {
-            fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
-
             // Transform cell index 'i' to global index 'idx' of y_glob-vector
-
-            // find index within the y-values: first do a binary search to find
-            // the next larger value of y in the list...
-            double const y = fe_values[i]->quadrature_point(0)[1];
+            double const y = y_planes[(cell * n_points_y_per_cell + i) * n_lanes + v];
 
             // identify index for first point located on the boundary of the cell because for this
             // point the mapping can not cause any trouble. For interior points, the deviations
             // introduced may the mapping can be so strong that the identification of the index is
             // no longer unique.
             if(i == 0)
-            {
-              idx =
-                std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
-
-              // make sure that the index does not exceed the array bounds in case of round-off
-              // errors
-              if(idx == y_glob.size())
-                idx--;
-
-              // reduce index by 1 in case that the previous point is closer to y than
-              // the next point
-              if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
-                idx--;
-            }
+              idx = find_closest_y_index(y);
             else // simply increment index for subsequent points of a cell
-            {
               ++idx;
-            }
 
             y_processor[idx] = y;
           }
@@ -285,10 +250,176 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
 
     AssertThrow(y_glob.size() == n_points_y_glob, dealii::ExcInternalError());
 
+    // identify the global index of the x-z-planes of all cells
+    plane_indices.resize(y_planes.size());
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+      {
+        for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+        {
+          unsigned int const index = (cell * n_points_y_per_cell + i) * n_lanes + v;
+
+          double const       y   = y_planes[index];
+          unsigned int const idx = find_closest_y_index(y);
+
+          AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
+                      dealii::ExcMessage("Could not locate " + std::to_string(y) +
+                                         " among pre-evaluated points. Closest point is " +
+                                         std::to_string(y_glob[idx]) + " at distance " +
+                                         std::to_string(std::abs(y_glob[idx] - y)) +
+                                         ". Check transform() function given to constructor."));
+
+          plane_indices[index] = idx;
+        }
+      }
+    }
+
     create_directories(data.directory, mpi_comm);
   }
 }
 
+template<int dim, typename Number>
+std::vector<double>
+StatisticsManager<dim, Number>::setup_plane_data()
+{
+  // the quadrature formula of the MatrixFree object is a tensor product of 1D quadrature formulas
+  // with lexicographic numbering of the quadrature points
+  dealii::Quadrature<dim> const & quadrature = matrix_free.get_quadrature(quad_index);
+
+  n_q_points_1d = static_cast<unsigned int>(std::round(std::pow(quadrature.size(), 1.0 / dim)));
+  n_q_points_xz = dealii::Utilities::pow(n_q_points_1d, dim - 1);
+
+  AssertThrow(n_q_points_xz * n_q_points_1d == quadrature.size(),
+              dealii::ExcMessage("Expected a tensor-product quadrature formula."));
+
+  // the interpolation in y-direction is exact if the velocity is a polynomial of degree
+  // n_q_points_1d - 1 or lower
+  AssertThrow(n_q_points_1d >= dof_handler.get_fe().degree + 1,
+              dealii::ExcMessage("The number of 1D quadrature points has to be larger than the "
+                                 "polynomial degree of the velocity."));
+
+  // 1D quadrature points in y-direction
+  std::vector<double> y_q(n_q_points_1d);
+  for(unsigned int j = 0; j < n_q_points_1d; ++j)
+    y_q[j] = quadrature.point(j * n_q_points_1d)[1];
+
+  // Lagrange polynomials with respect to the 1D quadrature points evaluated at the x-z-planes
+  interpolation_matrix.reinit(n_points_y_per_cell, n_q_points_1d);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  {
+    double const y = (double)i / (n_points_y_per_cell - 1);
+    for(unsigned int j = 0; j < n_q_points_1d; ++j)
+    {
+      double value = 1.0;
+      for(unsigned int k = 0; k < n_q_points_1d; ++k)
+        if(k != j)
+          value *= (y - y_q[k]) / (y_q[j] - y_q[k]);
+      interpolation_matrix(i, j) = value;
+    }
+  }
+
+  // vector of dealii::FEValues for all x-z-planes of a cell, using the quadrature points in x- and
+  // z-direction of the MatrixFree quadrature
+  std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  {
+    std::vector<dealii::Point<dim>> points(n_q_points_xz);
+    std::vector<double>             weights(n_q_points_xz, 0.0);
+    for(unsigned int q = 0; q < n_q_points_xz; ++q)
+    {
+      unsigned int const qx = q % n_q_points_1d;
+      unsigned int const qz = q / n_q_points_1d;
+
+      unsigned int const q_lower = qx + n_q_points_1d * n_q_points_1d * qz;
+
+      points[q]    = quadrature.point(q_lower);
+      points[q][1] = (double)i / (n_points_y_per_cell - 1);
+
+      // the 1D weights sum up to one, so that summing over y gives the weight in the x-z-plane
+      for(unsigned int j = 0; j < n_q_points_1d; ++j)
+        weights[q] += quadrature.weight(q_lower + n_q_points_1d * j);
+    }
+
+    fe_values[i].reset(new dealii::FEValues<dim>(mapping,
+                                                 dof_handler.get_fe().base_element(0),
+                                                 dealii::Quadrature<dim>(points, weights),
+                                                 dealii::update_jacobians |
+                                                   dealii::update_quadrature_points));
+  }
+
+  unsigned int const n_lanes = scalar::size();
+
+  plane_weights.resize_fast(matrix_free.n_cell_batches() * n_points_y_per_cell * n_q_points_xz);
+  plane_weights.fill(dealii::make_vectorized_array<Number>(0.));
+
+  std::vector<double> y_planes(matrix_free.n_cell_batches() * n_points_y_per_cell * n_lanes,
+                               std::numeric_limits<double>::lowest());
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      typename dealii::Triangulation<dim>::active_cell_iterator const cell_it(
+        matrix_free.get_cell_iterator(cell, v, dof_index));
+
+      // loop over all x-z-planes of current cell
+      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+      {
+        fe_values[i]->reinit(cell_it);
+
+        for(unsigned int q = 0; q < n_q_points_xz; ++q)
+        {
+          double det = 0.;
+          if(dim == 3)
+          {
+            dealii::Tensor<2, 2> reduced_jacobian;
+            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
+            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
+            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
+            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
+            det                    = determinant(reduced_jacobian);
+          }
+          else
+          {
+            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
+          }
+
+          plane_weights[(cell * n_points_y_per_cell + i) * n_q_points_xz + q][v] =
+            det * fe_values[i]->get_quadrature().weight(q);
+        }
+
+        y_planes[(cell * n_points_y_per_cell + i) * n_lanes + v] =
+          fe_values[i]->quadrature_point(0)[1];
+      }
+    }
+  }
+
+  return y_planes;
+}
+
+template<int dim, typename Number>
+unsigned int
+StatisticsManager<dim, Number>::find_closest_y_index(double const y) const
+{
+  // std::lower_bound: returns iterator to first element that is >= y.
+  // Note that the vector y_glob has to be sorted. As a result, the
+  // index might be too large.
+  unsigned int idx =
+    std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
+
+  // make sure that the index does not exceed the array bounds in case of round-off errors
+  if(idx == y_glob.size())
+    idx--;
+
+  // reduce index by 1 in case that the previous point is closer to y than
+  // the next point
+  if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
+    idx--;
+
+  return idx;
+}
+
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::evaluate(VectorType const &   velocity,
@@ -455,148 +586,94 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
 
   std::vector<double> veluv_loc(vel_glob[0].size());
 
-  // use 2d quadrature to integrate over x-z-planes
-  unsigned int const      fe_degree = dof_handler.get_fe().degree;
-  dealii::QGauss<dim - 1> gauss_2d(fe_degree + 1);
-
-  // vector of dealii::FEValues for all x-z-planes of a cell
-  std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
-
-  // TODO
-  //  dealii::MappingQ<dim> mapping(fe_degree);
-  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  // vector-valued FE where all components are explicitly listed in the dealii::DoFHandler, or
+  // scalar FE where we have several vectors referring to the same dealii::DoFHandler
+  std::shared_ptr<CellIntegrator<dim, dim, Number>> integrator_vector;
+  std::shared_ptr<CellIntegrator<dim, 1, Number>>   integrator_scalar;
+  if(dof_handler.get_fe().element_multiplicity(0) >= dim)
   {
-    std::vector<dealii::Point<dim>> points(gauss_2d.size());
-    std::vector<double>             weights(gauss_2d.size());
-    for(unsigned int j = 0; j < gauss_2d.size(); ++j)
-    {
-      points[j][0] = gauss_2d.point(j)[0];
-      if(dim == 3)
-        points[j][2] = gauss_2d.point(j)[1];
-      points[j][1] = (double)i / (n_points_y_per_cell - 1);
-      weights[j]   = gauss_2d.weight(j);
-    }
-
-    fe_values[i].reset(new dealii::FEValues<dim>(mapping,
-                                                 dof_handler.get_fe().base_element(0),
-                                                 dealii::Quadrature<dim>(points, weights),
-                                                 dealii::update_values | dealii::update_jacobians |
-                                                   dealii::update_quadrature_points));
+    integrator_vector =
+      std::make_shared<CellIntegrator<dim, dim, Number>>(matrix_free, dof_index, quad_index);
   }
+  else
+  {
+    AssertDimension(dof_handler.get_fe().element_multiplicity(0), 1);
+    AssertDimension(velocity.size(), dim);
+    integrator_scalar =
+      std::make_shared<CellIntegrator<dim, 1, Number>>(matrix_free, dof_index, quad_index);
+  }
+
+  unsigned int const n_lanes = scalar::size();
 
-  unsigned int const scalar_dofs_per_cell = dof_handler.get_fe().base_element(0).dofs_per_cell;
-  // TODO this variable is not used
-  //  std::vector<double> vel_values(fe_values[0]->n_quadrature_points);
-  std::vector<dealii::Tensor<1, dim>>          velocity_vector(scalar_dofs_per_cell);
-  std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
+  dealii::AlignedVector<dealii::Tensor<1, dim, scalar>> velocity_q(n_q_points_xz * n_q_points_1d);
 
-  // loop over all cells and perform averaging/integration for all locally owned cells
-  for(auto const & cell : dof_handler.active_cell_iterators())
+  // loop over all cell batches and perform averaging/integration for all locally owned cells
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
   {
-    if(cell->is_locally_owned())
+    // evaluate velocity in all quadrature points of the current cell batch
+    if(integrator_vector)
     {
-      cell->get_dof_indices(dof_indices);
-
-      // vector-valued FE where all components are explicitly listed in the dealii::DoFHandler
-      if(dof_handler.get_fe().element_multiplicity(0) >= dim)
-      {
-        for(unsigned int j = 0; j < dof_indices.size(); ++j)
-        {
-          const std::pair<unsigned int, unsigned int> comp =
-            dof_handler.get_fe().system_to_component_index(j);
-          if(comp.first < dim)
-            velocity_vector[comp.second][comp.first] = (*velocity[0])(dof_indices[j]);
-        }
-      }
-      else // scalar FE where we have several vectors referring to the same dealii::DoFHandler
+      integrator_vector->reinit(cell);
+      integrator_vector->gather_evaluate(*velocity[0], dealii::EvaluationFlags::values);
+      for(unsigned int q = 0; q < integrator_vector->n_q_points; ++q)
+        velocity_q[q] = integrator_vector->get_value(q);
+    }
+    else
+    {
+      integrator_scalar->reinit(cell);
+      for(unsigned int d = 0; d < dim; ++d)
       {
-        AssertDimension(dof_handler.get_fe().element_multiplicity(0), 1);
-        for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
-          for(unsigned int d = 0; d < dim; ++d)
-            velocity_vector[j][d] = (*velocity[d])(dof_indices[j]);
+        integrator_scalar->gather_evaluate(*velocity[d], dealii::EvaluationFlags::values);
+        for(unsigned int q = 0; q < integrator_scalar->n_q_points; ++q)
+          velocity_q[q][d] = integrator_scalar->get_value(q);
       }
+    }
 
-      // loop over all x-z-planes of current cell
-      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+    // loop over all x-z-planes of current cell
+    for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+    {
+      dealii::Tensor<1, dim, scalar> vel, velsq;
+      scalar                         area  = dealii::make_vectorized_array<Number>(0.);
+      scalar                         veluv = dealii::make_vectorized_array<Number>(0.);
+
+      // perform integral over current x-z-plane of current cell
+      for(unsigned int q = 0; q < n_q_points_xz; ++q)
       {
-        fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
+        unsigned int const q_lower =
+          (q % n_q_points_1d) + n_q_points_1d * n_q_points_1d * (q / n_q_points_1d);
 
-        std::vector<double> vel(dim, 0.);
-        std::vector<double> velsq(dim, 0.);
-        double              area = 0, veluv = 0;
+        // interpolate velocity in y-direction onto the current x-z-plane
+        dealii::Tensor<1, dim, scalar> u;
+        for(unsigned int j = 0; j < n_q_points_1d; ++j)
+          u += dealii::make_vectorized_array<Number>(interpolation_matrix(i, j)) *
+               velocity_q[q_lower + n_q_points_1d * j];
 
-        // perform integral over current x-z-plane of current cell
-        for(unsigned int q = 0; q < fe_values[i]->n_quadrature_points; ++q)
-        {
-          // interpolate velocity to the quadrature point
-          dealii::Tensor<1, dim> velocity;
-          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-            velocity += fe_values[i]->shape_value(j, q) * velocity_vector[j];
+        scalar const area_ele = plane_weights[(cell * n_points_y_per_cell + i) * n_q_points_xz + q];
+        area += area_ele;
 
-          double det = 0.;
-          if(dim == 3)
-          {
-            dealii::Tensor<2, 2> reduced_jacobian;
-            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
-            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
-            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
-            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
-            det                    = determinant(reduced_jacobian);
-          }
-          else
-          {
-            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
-          }
+        for(unsigned int d = 0; d < dim; d++)
+          vel[d] += u[d] * area_ele;
 
-          double area_ele = det * fe_values[i]->get_quadrature().weight(q);
-          area += area_ele;
+        for(unsigned int d = 0; d < dim; d++)
+          velsq[d] += u[d] * u[d] * area_ele;
 
-          for(unsigned int i = 0; i < dim; i++)
-            vel[i] += velocity[i] * area_ele;
+        veluv += u[0] * u[1] * area_ele;
+      }
+
+      // Add results of cellwise integral to xxx_loc vectors since we want
+      // to average/integrate over all locally owned cells.
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        unsigned int const idx = plane_indices[(cell * n_points_y_per_cell + i) * n_lanes + v];
 
-          for(unsigned int i = 0; i < dim; i++)
-            velsq[i] += velocity[i] * velocity[i] * area_ele;
+        for(unsigned int d = 0; d < dim; d++)
+          vel_loc[d].at(idx) += vel[d][v];
 
-          veluv += velocity[0] * velocity[1] * area_ele;
-        }
+        for(unsigned int d = 0; d < dim; d++)
+          velsq_loc[d].at(idx) += velsq[d][v];
 
-        // Tranform cell index 'i' to global index 'idx' of y_glob-vector
-
-        // find index within the y-values: first do a binary search to find
-        // the next larger value of y in the list...
-        double const y = fe_values[i]->quadrature_point(0)[1];
-        // std::lower_bound: returns iterator to first element that is >= y.
-        // Note that the vector y_glob has to be sorted. As a result, the
-        // index might be too large.
-        unsigned int idx =
-          std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
-
-        // make sure that the index does not exceed the array bounds in case of round-off errors
-        if(idx == y_glob.size())
-          idx--;
-
-        // reduce index by 1 in case that the previous point is closer to y than
-        // the next point
-        if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
-          idx--;
-
-        AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
-                    dealii::ExcMessage("Could not locate " + std::to_string(y) +
-                                       " among pre-evaluated points. Closest point is " +
-                                       std::to_string(y_glob[idx]) + " at distance " +
-                                       std::to_string(std::abs(y_glob[idx] - y)) +
-                                       ". Check transform() function given to constructor."));
-
-        // Add results of cellwise integral to xxx_loc vectors since we want
-        // to average/integrate over all locally owned cells.
-        for(unsigned int i = 0; i < dim; i++)
-          vel_loc[i].at(idx) += vel[i];
-
-        for(unsigned int i = 0; i < dim; i++)
-          velsq_loc[i].at(idx) += velsq[i];
-
-        veluv_loc.at(idx) += veluv;
-        area_loc.at(idx) += area;
+        veluv_loc.at(idx) += veluv[v];
+        area_loc.at(idx) += area[v];
       }
     }
   }
@@ -23,8 +23,11 @@
 #define INCLUDE_EXADG_POSTPROCESSOR_STATISTICS_MANAGER_H_
 
 // deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/table.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
 #include <exadg/utilities/print_functions.h>
@@ -92,14 +95,27 @@ struct TurbulentChannelData
   std::string filename;
 };
 
+/*
+ * Statistics of turbulent channel flow averaged over x-z-planes (homogeneous directions) and time.
+ *
+ * The velocity is evaluated in the quadrature points of the given MatrixFree object with
+ * sum-factorization and subsequently interpolated in y-direction onto the x-z-planes at which
+ * statistics are computed. The geometry information needed for this step (interpolation matrix,
+ * surface elements of the x-z-planes, and the global plane indices) is precomputed in setup(), so
+ * that the mesh is assumed to be static.
+ */
 template<int dim, typename Number>
 class StatisticsManager
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  StatisticsManager(dealii::DoFHandler<dim> const & dof_handler_velocity,
-                    dealii::Mapping<dim> const &    mapping);
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  StatisticsManager(dealii::MatrixFree<dim, Number> const & matrix_free,
+                    unsigned int const                      dof_index_velocity,
+                    unsigned int const                      quad_index_velocity,
+                    dealii::Mapping<dim> const &            mapping);
 
   // The argument grid_transform indicates how the y-direction that is initially distributed from
   // [0,1] is mapped to the actual grid. This must match the transformation applied to the
@@ -130,10 +146,42 @@ private:
   void
   do_evaluate(const std::vector<VectorType const *> & velocity);
 
+  /*
+   * Precomputes the interpolation from the quadrature points onto the x-z-planes as well as the
+   * surface elements of the x-z-planes for all cell batches. Returns the y-coordinates of the
+   * x-z-planes for all cell batches, planes, and lanes of the vectorized array.
+   */
+  std::vector<double>
+  setup_plane_data();
+
+  /*
+   * Returns the index of the entry of y_glob closest to the given y-coordinate.
+   */
+  unsigned int
+  find_closest_y_index(double const y) const;
+
+  dealii::MatrixFree<dim, Number> const & matrix_free;
+  unsigned int const                      dof_index;
+  unsigned int const                      quad_index;
+
   dealii::DoFHandler<dim> const & dof_handler;
   dealii::Mapping<dim> const &    mapping;
   MPI_Comm                        mpi_comm;
 
+  // number of quadrature points in 1D and in the x-z-plane of a cell
+  unsigned int n_q_points_1d;
+  unsigned int n_q_points_xz;
+
+  // interpolation matrix from the 1D quadrature points in y-direction onto the x-z-planes of a cell
+  dealii::Table<2, Number> interpolation_matrix;
+
+  // surface element times quadrature weight for all cell batches, x-z-planes, and quadrature points
+  // in the x-z-plane
+  dealii::AlignedVector<scalar> plane_weights;
+
+  // index into y_glob for all cell batches, x-z-planes, and lanes of the vectorized array
+  std::vector<unsigned int> plane_indices;
+
   // vector of y-coordinates at which statistical quantities are computed
   std::vector<double> y_glob;
 
@@ -24,14 +24,103 @@
 
 // C/C++
 #include <fstream>
+#include <memory>
 
 // deal.II
+#include <deal.II/fe/mapping_q_cache.h>
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/numerics/data_out.h>
 #include <deal.II/numerics/data_out_faces.h>
 
+// ExaDG
+#include <exadg/postprocessor/hdf5_output.h>
+#include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/output_pipeline.h>
+
 namespace ExaDG
 {
+/*
+ * Builds the patches of data_out and writes the output files. In case of a pipeline, this is done
+ * in the background. Then, the vectors attached to data_out have to be copies with ghost values
+ * (see OutputVectors), which are kept alive via the argument data until the output has been
+ * written. Moreover, each process writes its own vtu file without MPI communication, and the pvtu
+ * record is written by rank 0. A MappingQCache (as used for moving meshes, see MappingDoFVector) is
+ * updated in place when the mesh moves. In that case, the patches are built before this function
+ * returns, and only the files are written in the background. In case of hdf5_output, the patches
+ * are written collectively in HDF5/XDMF format instead of vtu format, which is not done in the
+ * background.
+ */
+template<int dim>
+void
+build_patches_and_write(std::shared_ptr<dealii::DataOut<dim>>           data_out,
+                        std::vector<std::shared_ptr<void const>> const & data,
+                        dealii::Mapping<dim> const &                    mapping,
+                        OutputDataBase const &                          output_data,
+                        unsigned int const                              output_counter,
+                        double const                                    time,
+                        MPI_Comm const &                                mpi_comm,
+                        OutputPipeline *                                pipeline,
+                        HDF5Output<dim> *                               hdf5_output)
+{
+  if(hdf5_output != nullptr)
+  {
+    data_out->build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
+
+    hdf5_output->write(*data_out, output_data, output_counter, time);
+  }
+  else if(pipeline == nullptr)
+  {
+    data_out->build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
+
+    data_out->write_vtu_with_pvtu_record(
+      output_data.directory, output_data.filename, output_counter, mpi_comm, 4);
+  }
+  else
+  {
+    unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+    unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    std::string const directory = output_data.directory;
+    std::string const file_base =
+      output_data.filename + "_" + dealii::Utilities::int_to_string(output_counter, 4);
+    unsigned int const degree = output_data.degree;
+
+    // the patches store the mapped geometry, i.e., the mapping is no longer needed once they have
+    // been built
+    bool const mapping_may_change =
+      dynamic_cast<dealii::MappingQCache<dim> const *>(&mapping) != nullptr;
+    if(mapping_may_change)
+      data_out->build_patches(mapping, degree, dealii::DataOut<dim>::curved_inner_cells);
+
+    dealii::Mapping<dim> const * mapping_ptr = &mapping;
+
+    pipeline->submit([=]() {
+      // keep data alive until the patches have been built
+      (void)data;
+
+      if(not mapping_may_change)
+        data_out->build_patches(*mapping_ptr, degree, dealii::DataOut<dim>::curved_inner_cells);
+
+      unsigned int const n_digits = dealii::Utilities::needed_digits(n_ranks - 1);
+
+      std::ofstream output(directory + file_base + "." +
+                           dealii::Utilities::int_to_string(rank, n_digits) + ".vtu");
+      data_out->write_vtu(output);
+
+      if(rank == 0)
+      {
+        std::vector<std::string> filenames;
+        for(unsigned int i = 0; i < n_ranks; ++i)
+          filenames.push_back(file_base + "." + dealii::Utilities::int_to_string(i, n_digits) +
+                              ".vtu");
+
+        std::ofstream pvtu_output(directory + file_base + ".pvtu");
+        data_out->write_pvtu_record(pvtu_output, filenames);
+      }
+    });
+  }
+}
+
 template<int dim>
 void
 write_surface_mesh(dealii::Triangulation<dim> const & triangulation,
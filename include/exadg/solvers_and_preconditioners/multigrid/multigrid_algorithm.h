@@ -22,6 +22,9 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_PRECONDITIONER_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIGRID_PRECONDITIONER_H_
 
+// C/C++
+#include <memory>
+
 // deal.II
 #include <deal.II/base/function_lib.h>
 #include <deal.II/base/timer.h>
@@ -32,23 +35,16 @@
 #include <deal.II/multigrid/multigrid.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
 #include <exadg/utilities/timer_tree.h>
 
-/*
- * Activate timings if desired.
- */
-#define ENABLE_TIMING false
-
-#ifndef ENABLE_TIMING
-#  define ENABLE_TIMING false
-#endif
-
 namespace ExaDG
 {
 /*
- * Re-implementation of multigrid preconditioner (V-cycle) in order to have more direct control over
- * its individual components and avoid inner products and other expensive stuff.
+ * Re-implementation of multigrid preconditioner in order to have more direct control over its
+ * individual components and avoid inner products and other expensive stuff. V-cycles, W-cycles,
+ * and F-cycles are supported.
  */
 template<typename VectorType, typename MatrixType, typename SmootherType>
 class MultigridAlgorithm
@@ -59,7 +55,8 @@ public:
                      MGTransfer<VectorType> const &                               transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     MultigridCycle const cycle_type     = MultigridCycle::V,
+                     bool const           enable_timings = false)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
@@ -70,10 +67,9 @@ public:
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      cycle_type(cycle_type),
+      enable_timings(enable_timings)
   {
-    AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
-
     for(unsigned int level = minlevel; level <= maxlevel; ++level)
     {
       matrix[level]->initialize_dof_vector(solution[level]);
@@ -81,6 +77,10 @@ public:
       t[level]      = solution[level];
     }
 
+    // The coarse-grid solver computes a correction for a non-zero initial guess if the coarsest
+    // level is visited more than once (W- and F-cycles) or if multigrid is used as a solver.
+    coarse_correction = solution[minlevel];
+
     timer_tree = std::make_shared<TimerTree>();
   }
 
@@ -88,23 +88,18 @@ public:
   void
   vmult(OtherVectorType & dst, OtherVectorType const & src) const
   {
-#if ENABLE_TIMING
-    dealii::Timer timer;
-#endif
+    std::unique_ptr<dealii::Timer> timer;
+    if(enable_timings)
+      timer = std::make_unique<dealii::Timer>();
 
-    for(unsigned int i = minlevel; i < maxlevel; i++)
-    {
-      defect[i] = 0.0;
-    }
     defect[maxlevel].copy_locally_owned_data_from(src);
 
-    v_cycle(maxlevel, false);
+    cycle(maxlevel, cycle_type, true);
 
     dst.copy_locally_owned_data_from(solution[maxlevel]);
 
-#if ENABLE_TIMING
-    timer_tree->insert({"Multigrid"}, timer.wall_time());
-#endif
+    if(enable_timings)
+      timer_tree->insert({"Multigrid"}, timer->wall_time());
   }
 
   template<class OtherVectorType>
@@ -130,12 +125,7 @@ public:
     bool converged = norm_r_0 < abstol;
     while(!converged)
     {
-      for(unsigned int i = minlevel; i < maxlevel; i++)
-      {
-        defect[i] = 0.0;
-      }
-
-      v_cycle(maxlevel, true);
+      cycle(maxlevel, cycle_type, false);
 
       // calculate residual and check convergence
       norm_r = calculate_residual(residual);
@@ -167,75 +157,105 @@ public:
 
 private:
   /**
-   * Implements the V-cycle
+   * Implements one multigrid cycle of type @p type on level @p level, i.e., approximately solves
+   * the level problem with right-hand side defect[level]. If @p zero_initial_guess is true, we can
+   * assume that solution[level] = 0 so that the smoother can apply optimizations (e.g., one does
+   * not need to evaluate the residual in the first iteration of the smoother). Otherwise, the
+   * current content of solution[level] is used as initial guess. This is the case if multigrid is
+   * used as a solver or if a level is visited repeatedly within a W-cycle or F-cycle.
    */
   void
-  v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
+  cycle(unsigned int const level, MultigridCycle const type, bool const zero_initial_guess) const
   {
-#if ENABLE_TIMING
-    dealii::Timer timer;
-#endif
+    std::unique_ptr<dealii::Timer> timer;
+    if(enable_timings)
+      timer = std::make_unique<dealii::Timer>();
 
     // call coarse grid solver
     if(level == minlevel)
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
-
-      (*coarse)(level, solution[level], defect[level]);
+      if(zero_initial_guess)
+      {
+        (*coarse)(level, solution[level], defect[level]);
+      }
+      else
+      {
+        // solve for a correction of the current approximation
+        (*matrix)[level]->vmult(t[level], solution[level]);
+        t[level].sadd(-1.0, 1.0, defect[level]);
+        coarse_correction = 0.0;
+        (*coarse)(level, coarse_correction, t[level]);
+        solution[level] += coarse_correction;
+      }
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      record_timing(timer, level, "Coarse solve");
     }
     else
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
-
       // pre-smoothing
-      if(multigrid_is_a_solver)
+      if(zero_initial_guess)
       {
-        // One has to take into account the initial guess of the solution when used as a solver
-        // and, therefore, call the function step().
-        (*smoother)[level]->step(solution[level], defect[level]);
+        (*smoother)[level]->vmult(solution[level], defect[level]);
       }
       else
       {
-        // We can assume that solution[level] = 0 when used as a preconditioner
-        // and, therefore, call the function vmult(), which makes use of this assumption
-        // in order to apply optimizations (e.g., one does not need to evaluate the residual in
-        // the first iteration of the smoother).
-        (*smoother)[level]->vmult(solution[level], defect[level]);
+        // One has to take into account the initial guess of the solution and, therefore, call the
+        // function step().
+        (*smoother)[level]->step(solution[level], defect[level]);
       }
 
-      // restriction
+      record_timing(timer, level, "Pre-smoothing");
+
+      // residual
       (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
       t[level].sadd(-1.0, 1.0, defect[level]);
+
+      record_timing(timer, level, "Residual");
+
+      // restriction
+      defect[level - 1] = 0.0;
       transfer.restrict_and_add(level, defect[level - 1], t[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      record_timing(timer, level, "Restriction");
 
-      // coarse grid correction
-      v_cycle(level - 1, false);
+      // coarse grid correction: the V-cycle visits the next coarser level once, the W-cycle twice,
+      // and the F-cycle performs an F-cycle followed by a V-cycle on the next coarser level
+      cycle(level - 1, type, true);
 
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      if(type == MultigridCycle::W)
+        cycle(level - 1, MultigridCycle::W, false);
+      else if(type == MultigridCycle::F)
+        cycle(level - 1, MultigridCycle::V, false);
+
+      if(enable_timings)
+        timer->restart();
 
       // prolongation
       transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
 
+      record_timing(timer, level, "Prolongation");
+
       // post-smoothing
       (*smoother)[level]->step(solution[level], defect[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      record_timing(timer, level, "Post-smoothing");
+    }
+  }
+
+  /**
+   * Adds the wall time measured by @p timer to the timer tree entry @p name of the given level and
+   * restarts the timer. This function does nothing if timings are disabled, in which case the timer
+   * is not constructed.
+   */
+  void
+  record_timing(std::unique_ptr<dealii::Timer> const & timer,
+                unsigned int const                     level,
+                std::string const &                    name) const
+  {
+    if(enable_timings)
+    {
+      timer_tree->insert({"Multigrid", "level " + std::to_string(level), name}, timer->wall_time());
+      timer->restart();
     }
   }
 
@@ -265,6 +285,11 @@ private:
    */
   mutable dealii::MGLevelObject<VectorType> t;
 
+  /**
+   * Auxiliary vector on the coarsest level (correction for a non-zero initial guess).
+   */
+  mutable VectorType coarse_correction;
+
   /**
    * The matrix for each level.
    */
@@ -287,7 +312,12 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  unsigned int const n_cycles;
+  MultigridCycle const cycle_type;
+
+  /**
+   * Measure wall times of the individual components of the multigrid cycle on each level.
+   */
+  bool const enable_timings;
 
   std::shared_ptr<TimerTree> timer_tree;
 };
@@ -70,12 +70,23 @@ enum class PSequenceType
 std::string
 enum_to_string(PSequenceType const enum_type);
 
+enum class MultigridCycle
+{
+  V,
+  W,
+  F
+};
+
+std::string
+enum_to_string(MultigridCycle const enum_type);
+
 enum class MultigridSmoother
 {
   Chebyshev,
   GMRES,
   CG,
-  Jacobi
+  Jacobi,
+  Schwarz
 };
 
 std::string
@@ -207,7 +218,7 @@ struct SmootherData
     print_parameter(pcout, "Preconditioner smoother", enum_to_string(preconditioner));
     print_parameter(pcout, "Iterations smoother", iterations);
 
-    if(smoother == MultigridSmoother::Jacobi)
+    if(smoother == MultigridSmoother::Jacobi || smoother == MultigridSmoother::Schwarz)
     {
       print_parameter(pcout, "Relaxation factor", relaxation_factor);
     }
@@ -228,7 +239,7 @@ struct SmootherData
   // Number of iterations
   unsigned int iterations;
 
-  // damping/relaxation factor for Jacobi smoother
+  // damping/relaxation factor for Jacobi and Schwarz smoothers
   double relaxation_factor;
 
   // Chebyshev smmother: sets the smoothing range (range of eigenvalues to be smoothed)
@@ -282,7 +293,9 @@ struct MultigridData
   MultigridData()
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
+      cycle(MultigridCycle::V),
       use_global_coarsening(false),
+      enable_timings(false),
       smoother_data(SmootherData()),
       coarse_problem(CoarseGridData())
   {
@@ -298,8 +311,18 @@ struct MultigridData
       print_parameter(pcout, "p-sequence", enum_to_string(p_sequence));
     }
 
+    if(cycle != MultigridCycle::V)
+    {
+      print_parameter(pcout, "Multigrid cycle", enum_to_string(cycle));
+    }
+
     print_parameter(pcout, "Global coarsening", use_global_coarsening);
 
+    if(enable_timings)
+    {
+      print_parameter(pcout, "Enable timings", enable_timings);
+    }
+
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
@@ -320,10 +343,21 @@ struct MultigridData
   // Sequence of polynomial degrees during p-multigrid
   PSequenceType p_sequence;
 
+  // Type of multigrid cycle: V-cycle, W-cycle, or F-cycle. W- and F-cycles visit coarser levels
+  // several times, i.e. they trade additional (cheap) coarse-level work for a potentially smaller
+  // number of outer iterations and, hence, fine-level operator evaluations.
+  MultigridCycle cycle;
+
   // Enable this option in order to invoke a multigrid transfer implementation that can deal with
   // hanging nodes
   bool use_global_coarsening;
 
+  // Measure wall times of pre-smoothing, residual evaluation, restriction, prolongation,
+  // post-smoothing, and the coarse-grid solver separately for each multigrid level. The results
+  // are available via the timer tree of the multigrid preconditioner. Note that this option
+  // introduces a small overhead since the timer tree is updated several times per level and cycle.
+  bool enable_timings;
+
   // Smoother data
   SmootherData smoother_data;
 
@@ -40,6 +40,7 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/chebyshev_smoother.h>
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/gmres_smoother.h>
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/jacobi_smoother.h>
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/schwarz_smoother.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_global_coarsening.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_global_refinement.h>
 #include <exadg/solvers_and_preconditioners/utilities/compute_eigenvalues.h>
@@ -810,6 +811,19 @@ MultigridPreconditionerBase<dim, Number>::initialize_smoother(Operator &   mg_op
       smoother->initialize(mg_operator, smoother_data);
       break;
     }
+    case MultigridSmoother::Schwarz:
+    {
+      typedef SchwarzSmoother<Operator, VectorTypeMG> Schwarz;
+      smoothers[level] = std::make_shared<Schwarz>();
+
+      typename Schwarz::AdditionalData smoother_data;
+      smoother_data.number_of_smoothing_steps = data.smoother_data.iterations;
+      smoother_data.damping_factor            = data.smoother_data.relaxation_factor;
+
+      std::shared_ptr<Schwarz> smoother = std::dynamic_pointer_cast<Schwarz>(smoothers[level]);
+      smoother->initialize(mg_operator, smoother_data);
+      break;
+    }
     default:
     {
       AssertThrow(false, dealii::ExcMessage("Specified MultigridSmoother not implemented!"));
@@ -867,6 +881,14 @@ MultigridPreconditionerBase<dim, Number>::update_smoother(unsigned int level)
       smoother->update();
       break;
     }
+    case MultigridSmoother::Schwarz:
+    {
+      typedef SchwarzSmoother<Operator, VectorTypeMG> Schwarz;
+
+      std::shared_ptr<Schwarz> smoother = std::dynamic_pointer_cast<Schwarz>(smoothers[level]);
+      smoother->update();
+      break;
+    }
     default:
     {
       AssertThrow(false, dealii::ExcMessage("Specified MultigridSmoother not implemented!"));
@@ -1031,7 +1053,13 @@ MultigridPreconditionerBase<dim, Number>::initialize_multigrid_algorithm()
 {
   this
     ->multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    this->operators, *this->coarse_grid_solver, *this->transfers, this->smoothers, this->mpi_comm);
+    this->operators,
+    *this->coarse_grid_solver,
+    *this->transfers,
+    this->smoothers,
+    this->mpi_comm,
+    data.cycle,
+    data.enable_timings);
 }
 
 template<int dim, typename Number>
@@ -0,0 +1,151 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_SCHWARZSMOOTHER_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_SCHWARZSMOOTHER_H_
+
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
+
+namespace ExaDG
+{
+/*
+ *  Additive overlapping Schwarz smoother with vertex patches, i.e. patches of 2^dim cells around
+ *  each vertex. The local problems on the patches are solved by tensor-product (fast
+ *  diagonalization) solvers provided by the underlying operator, see
+ *  OperatorBase::update_vertex_patch_preconditioner().
+ */
+template<typename Operator, typename VectorType>
+class SchwarzSmoother : public SmootherBase<VectorType>
+{
+public:
+  SchwarzSmoother() : underlying_operator(nullptr)
+  {
+  }
+
+  SchwarzSmoother(SchwarzSmoother const &) = delete;
+
+  SchwarzSmoother &
+  operator=(SchwarzSmoother const &) = delete;
+
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData() : number_of_smoothing_steps(5), damping_factor(1.0)
+    {
+    }
+
+    // number of iterations per smoothing step
+    unsigned int number_of_smoothing_steps;
+
+    // damping factor
+    double damping_factor;
+  };
+
+  void
+  initialize(Operator & operator_in, AdditionalData const & additional_data_in)
+  {
+    underlying_operator = &operator_in;
+
+    data = additional_data_in;
+
+    underlying_operator->update_vertex_patch_preconditioner();
+
+    underlying_operator->initialize_dof_vector(tmp);
+    underlying_operator->initialize_dof_vector(residual);
+  }
+
+  void
+  update()
+  {
+    underlying_operator->update_vertex_patch_preconditioner();
+  }
+
+  /*
+   *  Approximately solve linear system of equations (b=src, x=dst)
+   *
+   *    A*x = b   (r=b-A*x)
+   *
+   *  using the iteration
+   *
+   *    x^{k+1} = x^{k} + omega * P^{-1} * r^{k}
+   *
+   *  where
+   *
+   *    omega:  damping factor
+   *    P^{-1}: additive Schwarz preconditioner, sum_p R_p^T A_p^{-1} R_p
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    dst = 0;
+
+    for(unsigned int k = 0; k < data.number_of_smoothing_steps; ++k)
+    {
+      if(k > 0)
+      {
+        // calculate residual r^{k} = src - A * x^{k}
+        underlying_operator->vmult(residual, dst);
+        residual.sadd(-1.0, 1.0, src);
+      }
+      else // we do not have to evaluate the residual for k=0 since dst = 0
+      {
+        residual = src;
+      }
+
+      // apply Schwarz preconditioner: tmp = P^{-1} * residual
+      underlying_operator->apply_inverse_vertex_patch(tmp, residual);
+
+      // x^{k+1} = x^{k} + damping_factor * tmp
+      dst.add(data.damping_factor, tmp);
+    }
+  }
+
+  void
+  step(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int k = 0; k < data.number_of_smoothing_steps; ++k)
+    {
+      // calculate residual r^{k} = src - A * x^{k}
+      underlying_operator->vmult(residual, dst);
+      residual.sadd(-1.0, 1.0, src);
+
+      // apply Schwarz preconditioner: tmp = P^{-1} * residual
+      underlying_operator->apply_inverse_vertex_patch(tmp, residual);
+
+      // x^{k+1} = x^{k} + damping_factor * tmp
+      dst.add(data.damping_factor, tmp);
+    }
+  }
+
+private:
+  Operator * underlying_operator;
+
+  AdditionalData data;
+
+  // auxiliary vectors
+  mutable VectorType tmp, residual;
+};
+} // namespace ExaDG
+
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_SCHWARZSMOOTHER_H_ */
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONER_ELEMENTWISE_PRECONDITIONERS_H_
 
 // deal.II
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/matrix_free/operators.h>
 
 // ExaDG
@@ -101,27 +102,39 @@ public:
   InverseMassPreconditioner(dealii::MatrixFree<dim, Number> const & matrix_free,
                             unsigned int const                      dof_index,
                             unsigned int const                      quad_index)
+    : matrix_free(matrix_free), dof_index(dof_index), quad_index(quad_index)
   {
-    integrator = std::make_shared<Integrator>(matrix_free, dof_index, quad_index);
-    inverse    = std::make_shared<CellwiseInverseMass>(*integrator);
   }
 
   void
   setup(unsigned int const cell)
   {
+    // each thread needs its own integrator in case of task-parallel matrix-free loops
+    std::shared_ptr<Integrator> & integrator = integrator_thread.get();
+    if(integrator.get() == nullptr)
+    {
+      integrator           = std::make_shared<Integrator>(matrix_free, dof_index, quad_index);
+      inverse_thread.get() = std::make_shared<CellwiseInverseMass>(*integrator);
+    }
+
     integrator->reinit(cell);
   }
 
   void
   vmult(dealii::VectorizedArray<Number> * dst, dealii::VectorizedArray<Number> const * src) const
   {
-    inverse->apply(src, dst);
+    inverse_thread.get()->apply(src, dst);
   }
 
 private:
-  std::shared_ptr<Integrator> integrator;
+  dealii::MatrixFree<dim, Number> const & matrix_free;
+
+  unsigned int const dof_index;
+  unsigned int const quad_index;
+
+  dealii::Threads::ThreadLocalStorage<std::shared_ptr<Integrator>> integrator_thread;
 
-  std::shared_ptr<CellwiseInverseMass> inverse;
+  mutable dealii::Threads::ThreadLocalStorage<std::shared_ptr<CellwiseInverseMass>> inverse_thread;
 };
 
 } // namespace Elementwise
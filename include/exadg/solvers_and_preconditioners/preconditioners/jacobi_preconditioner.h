@@ -64,6 +64,12 @@ public:
     return inverse_diagonal.size();
   }
 
+  VectorType const &
+  get_inverse_diagonal() const
+  {
+    return inverse_diagonal;
+  }
+
 private:
   Operator const & underlying_operator;
 
@@ -0,0 +1,276 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_FUSED_CG_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_FUSED_CG_H_
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/lac/solver_control.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Preconditioned conjugate gradient method where the vector updates and inner products are fused
+ * into the matrix-free operator evaluation, so that one iteration comes close to a single sweep
+ * through memory. The operator has to provide a function
+ *
+ *   vmult(dst, src, operation_before_loop, operation_after_loop)
+ *
+ * as implemented by OperatorBase. The update of the solution vector x and the search direction p
+ * is performed in operation_before_loop (the update of x is lagged by one iteration for this
+ * purpose), and the inner product (p, A p) is computed in operation_after_loop. The update of the
+ * residual and the inner products needed for the next iteration are computed in one additional
+ * sweep. For the point-Jacobi preconditioner (or no preconditioner), the application of the
+ * preconditioner is fused into this sweep as well. For other preconditioners, the preconditioner
+ * is applied in the usual way after the update of the residual, requiring one additional sweep for
+ * the inner product (r, z).
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverCGFused : public SolverBase<VectorType>
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+public:
+  SolverCGFused(Operator const &     underlying_operator_in,
+                Preconditioner &     preconditioner_in,
+                SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs, bool const update_preconditioner) const override
+  {
+    dealii::Timer timer;
+
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+
+    this->project_initial_guess(
+      underlying_operator, dst, rhs, solver_data.n_projection_vectors, true /* symmetric */);
+
+    // The point-Jacobi preconditioner only requires the inverse diagonal, which can be applied
+    // within the fused vector operations.
+    VectorType const * inverse_diagonal    = nullptr;
+    bool               fuse_preconditioner = not solver_data.use_preconditioner;
+    if(solver_data.use_preconditioner)
+    {
+      auto jacobi = dynamic_cast<JacobiPreconditioner<Operator> const *>(&preconditioner);
+      if(jacobi != nullptr)
+      {
+        inverse_diagonal    = &jacobi->get_inverse_diagonal();
+        fuse_preconditioner = true;
+      }
+    }
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    VectorType r, p, v, z;
+    r.reinit(dst);
+    p.reinit(dst);
+    v.reinit(dst);
+    if(not fuse_preconditioner)
+      z.reinit(dst);
+
+    MPI_Comm const mpi_comm = dst.get_mpi_communicator();
+
+    Number * const       x_ptr = dst.begin();
+    Number * const       r_ptr = r.begin();
+    Number * const       p_ptr = p.begin();
+    Number const * const v_ptr = v.begin();
+    Number const * const d_ptr = inverse_diagonal ? inverse_diagonal->begin() : nullptr;
+    Number const * const z_ptr = fuse_preconditioner ? nullptr : z.begin();
+
+    // r = b - A x
+    underlying_operator.vmult(r, dst);
+    r.sadd(-1.0, 1.0, rhs);
+
+    // inner products (r, z) and (r, r), where z = M r
+    double sums[2] = {0.0, 0.0};
+    update_residual_and_compute_inner_products(
+      sums, r, z, nullptr, 0.0, inverse_diagonal, fuse_preconditioner, mpi_comm);
+
+    double rho       = sums[0];
+    double alpha_old = 0.0;
+    double beta      = 0.0;
+
+    unsigned int                 k     = 0;
+    dealii::SolverControl::State state = solver_control.check(k, std::sqrt(sums[1]));
+    while(state == dealii::SolverControl::iterate)
+    {
+      double p_times_v = 0.0;
+
+      // x += alpha_old * p, p = z + beta * p, v = A p, (p, v)
+      underlying_operator.vmult(
+        v,
+        p,
+        [&](unsigned int const begin, unsigned int const end) {
+          for(unsigned int i = begin; i < end; ++i)
+          {
+            Number const z_i = fuse_preconditioner ?
+                                 (d_ptr ? d_ptr[i] * r_ptr[i] : r_ptr[i]) :
+                                 z_ptr[i];
+            x_ptr[i] += Number(alpha_old) * p_ptr[i];
+            p_ptr[i] = z_i + Number(beta) * p_ptr[i];
+          }
+        },
+        [&](unsigned int const begin, unsigned int const end) {
+          for(unsigned int i = begin; i < end; ++i)
+            p_times_v += static_cast<double>(p_ptr[i]) * v_ptr[i];
+        });
+
+      p_times_v = dealii::Utilities::MPI::sum(p_times_v, mpi_comm);
+
+      AssertThrow(std::abs(p_times_v) > 0.0,
+                  dealii::ExcMessage("Breakdown of CG method: (p, A p) = 0."));
+
+      double const alpha = rho / p_times_v;
+
+      // r -= alpha * v, (r, z), (r, r)
+      update_residual_and_compute_inner_products(
+        sums, r, z, &v, alpha, inverse_diagonal, fuse_preconditioner, mpi_comm);
+
+      beta      = sums[0] / rho;
+      rho       = sums[0];
+      alpha_old = alpha;
+
+      state = solver_control.check(++k, std::sqrt(sums[1]));
+    }
+
+    // lagged update of solution vector
+    if(alpha_old != 0.0)
+      dst.add(alpha_old, p);
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Solver contained NaN of Inf values"));
+
+    this->update_projection_space(underlying_operator,
+                                  dst,
+                                  solver_data.n_projection_vectors,
+                                  true /* symmetric */,
+                                  false /* augmented */);
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverCGFused"}, timer.wall_time());
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    this->timer_tree->insert({"SolverCGFused"}, preconditioner.get_timings());
+
+    return this->timer_tree;
+  }
+
+private:
+  /*
+   * Updates the residual r -= alpha * v (unless v is a nullptr) and computes (r, z) and (r, r)
+   * with a single global reduction, where z = M r. If the preconditioner is fused, z is computed on
+   * the fly from the inverse diagonal (or z = r without preconditioner) so that the update and the
+   * inner products are performed in the same loop. Otherwise, the preconditioner is applied to the
+   * updated residual and (r, z) is computed in a second loop.
+   */
+  void
+  update_residual_and_compute_inner_products(double (&sums)[2],
+                                             VectorType &       r,
+                                             VectorType &       z,
+                                             VectorType const * v,
+                                             double const       alpha,
+                                             VectorType const * inverse_diagonal,
+                                             bool const         fuse_preconditioner,
+                                             MPI_Comm const     mpi_comm) const
+  {
+    unsigned int const   size  = r.get_partitioner()->locally_owned_size();
+    Number * const       r_ptr = r.begin();
+    Number const * const v_ptr = v ? v->begin() : nullptr;
+
+    sums[0] = 0.0;
+    sums[1] = 0.0;
+
+    if(fuse_preconditioner)
+    {
+      Number const * const d_ptr = inverse_diagonal ? inverse_diagonal->begin() : nullptr;
+      for(unsigned int i = 0; i < size; ++i)
+      {
+        if(v_ptr)
+          r_ptr[i] -= Number(alpha) * v_ptr[i];
+
+        double const r_i = r_ptr[i];
+        double const z_i = d_ptr ? d_ptr[i] * r_i : r_i;
+        sums[0] += r_i * z_i;
+        sums[1] += r_i * r_i;
+      }
+    }
+    else
+    {
+      for(unsigned int i = 0; i < size; ++i)
+      {
+        if(v_ptr)
+          r_ptr[i] -= Number(alpha) * v_ptr[i];
+
+        double const r_i = r_ptr[i];
+        sums[1] += r_i * r_i;
+      }
+
+      preconditioner.vmult(z, r);
+
+      Number const * const z_ptr = z.begin();
+      for(unsigned int i = 0; i < size; ++i)
+        sums[0] += static_cast<double>(r_ptr[i]) * z_ptr[i];
+    }
+
+    dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(sums, 2),
+                                mpi_comm,
+                                dealii::ArrayView<double>(sums, 2));
+  }
+
+  Operator const &   underlying_operator;
+  Preconditioner &   preconditioner;
+  SolverDataCG const solver_data;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_FUSED_CG_H_ */
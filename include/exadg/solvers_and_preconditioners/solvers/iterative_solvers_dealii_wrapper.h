@@ -82,7 +82,180 @@ public:
   mutable double       n10;  // number of iterations needed to reduce the residual by 1e10
 
 protected:
+  /*
+   * Initial guess by projection onto the space spanned by previous solutions (Fischer 1998).
+   *
+   * For symmetric positive definite operators, the basis is orthonormal with respect to the
+   * energy inner product, (x_i, A x_j) = delta_ij, and the projection minimizes the error in the
+   * energy norm. Otherwise, the images A x_i are orthonormal in the l2 inner product and the
+   * projection minimizes the l2 norm of the residual.
+   */
+  template<typename Operator>
+  void
+  project_initial_guess(Operator const &   underlying_operator,
+                        VectorType &       dst,
+                        VectorType const & rhs,
+                        unsigned int const n_vectors,
+                        bool const         symmetric) const
+  {
+    if(n_vectors == 0)
+      return;
+
+    if(projection_basis.size() > 0)
+    {
+      // r = b - A x
+      VectorType residual;
+      residual.reinit(rhs, true);
+      underlying_operator.vmult(residual, dst);
+      residual.sadd(-1.0, 1.0, rhs);
+
+      for(unsigned int i = 0; i < projection_basis.size(); ++i)
+      {
+        double const alpha =
+          symmetric ? projection_basis[i] * residual : projection_images[i] * residual;
+        dst.add(alpha, projection_basis[i]);
+      }
+    }
+
+    projected_initial_guess = dst;
+  }
+
+  /*
+   * Recomputes the images C = A U of the recycled subspace U for the current operator and
+   * orthonormalizes C in the l2 inner product, updating U accordingly. This is required if the
+   * projection space is used to augment the Krylov space and the operator may have changed since
+   * the last solve (e.g., due to a new time step size or linearization point).
+   */
+  template<typename Operator>
+  void
+  recompute_projection_images(Operator const & underlying_operator) const
+  {
+    std::vector<VectorType> basis, images;
+    for(unsigned int i = 0; i < projection_basis.size(); ++i)
+    {
+      VectorType & u = projection_basis[i];
+      VectorType & c = projection_images[i];
+      underlying_operator.vmult(c, u);
+
+      double const norm_before_orthogonalization = c.l2_norm();
+      for(unsigned int j = 0; j < images.size(); ++j)
+      {
+        double const beta = images[j] * c;
+        u.add(-beta, basis[j]);
+        c.add(-beta, images[j]);
+      }
+
+      double const norm = c.l2_norm();
+      if(norm > 1.e-10 * norm_before_orthogonalization and std::isfinite(norm))
+      {
+        u *= 1.0 / norm;
+        c *= 1.0 / norm;
+        basis.push_back(u);
+        images.push_back(c);
+      }
+    }
+
+    projection_basis.swap(basis);
+    projection_images.swap(images);
+  }
+
+  /*
+   * Adds the increment x - x_0 computed by the Krylov solver to the projection space, where x_0
+   * is the projected initial guess. If the projection space is augmented, i.e., the Krylov solver
+   * operated on (I - C C^T) A with C = A U, the solution is corrected by - U C^T A (x - x_0) in
+   * the same sweep. Once the maximum number of vectors is reached, the space is restarted with
+   * the current solution.
+   */
+  template<typename Operator>
+  void
+  update_projection_space(Operator const &   underlying_operator,
+                          VectorType &       dst,
+                          unsigned int const n_vectors,
+                          bool const         symmetric,
+                          bool const         augmented) const
+  {
+    if(n_vectors == 0)
+      return;
+
+    VectorType increment(dst);
+    increment -= projected_initial_guess;
+
+    VectorType image;
+    image.reinit(dst, true);
+    underlying_operator.vmult(image, increment);
+
+    auto const compute_norm = [&]() {
+      return symmetric ? std::sqrt(std::max(increment * image, 0.0)) : image.l2_norm();
+    };
+
+    double norm_before_orthogonalization = compute_norm();
+
+    for(unsigned int i = 0; i < projection_basis.size(); ++i)
+    {
+      double const beta = symmetric ? projection_basis[i] * image : projection_images[i] * image;
+      increment.add(-beta, projection_basis[i]);
+      image.add(-beta, projection_images[i]);
+      if(augmented)
+        dst.add(-beta, projection_basis[i]);
+    }
+
+    if(projection_basis.size() >= n_vectors)
+    {
+      projection_basis.clear();
+      projection_images.clear();
+
+      increment = dst;
+      underlying_operator.vmult(image, increment);
+
+      norm_before_orthogonalization = compute_norm();
+    }
+
+    double const norm = compute_norm();
+
+    // skip vectors that are (numerically) linearly dependent on the current basis
+    if(norm > 1.e-10 * norm_before_orthogonalization and std::isfinite(norm))
+    {
+      increment *= 1.0 / norm;
+      image *= 1.0 / norm;
+      projection_basis.push_back(increment);
+      projection_images.push_back(image);
+    }
+  }
+
   std::shared_ptr<TimerTree> timer_tree;
+
+  // basis of the projection space and its image under the operator
+  mutable std::vector<VectorType> projection_basis;
+  mutable std::vector<VectorType> projection_images;
+  mutable VectorType              projected_initial_guess;
+};
+
+/*
+ * Projected operator (I - C C^T) A, where the columns of C = A U are orthonormal. This operator
+ * is used to augment the Krylov space by the recycled subspace U (GCRO).
+ */
+template<typename Operator, typename VectorType>
+class AugmentedOperator
+{
+public:
+  AugmentedOperator(Operator const &                underlying_operator_in,
+                    std::vector<VectorType> const & images_in)
+    : underlying_operator(underlying_operator_in), images(images_in)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    underlying_operator.vmult(dst, src);
+
+    for(VectorType const & c : images)
+      dst.add(-(c * dst), c);
+  }
+
+private:
+  Operator const &                underlying_operator;
+  std::vector<VectorType> const & images;
 };
 
 struct SolverDataCG
@@ -92,6 +265,7 @@ struct SolverDataCG
       solver_tolerance_abs(1.e-20),
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
+      n_projection_vectors(0),
       compute_performance_metrics(false)
   {
   }
@@ -100,6 +274,8 @@ struct SolverDataCG
   double       solver_tolerance_abs;
   double       solver_tolerance_rel;
   bool         use_preconditioner;
+  // number of previous solutions used to project the initial guess (0 = no projection)
+  unsigned int n_projection_vectors;
   bool         compute_performance_metrics;
 };
 
@@ -127,6 +303,9 @@ public:
 
     dealii::SolverCG<VectorType> solver(solver_control);
 
+    this->project_initial_guess(
+      underlying_operator, dst, rhs, solver_data.n_projection_vectors, true /* symmetric */);
+
     if(solver_data.use_preconditioner == false)
     {
       solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
@@ -144,6 +323,12 @@ public:
     AssertThrow(std::isfinite(solver_control.last_value()),
                 dealii::ExcMessage("Solver contained NaN of Inf values"));
 
+    this->update_projection_space(underlying_operator,
+                                  dst,
+                                  solver_data.n_projection_vectors,
+                                  true /* symmetric */,
+                                  false /* augmented */);
+
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
@@ -191,6 +376,7 @@ struct SolverDataGMRES
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
       max_n_tmp_vectors(30),
+      n_projection_vectors(0),
       compute_eigenvalues(false),
       compute_performance_metrics(false)
   {
@@ -201,6 +387,8 @@ struct SolverDataGMRES
   double       solver_tolerance_rel;
   bool         use_preconditioner;
   unsigned int max_n_tmp_vectors;
+  // number of previous solutions used to project the initial guess (0 = no projection)
+  unsigned int n_projection_vectors;
   bool         compute_eigenvalues;
   bool         compute_performance_metrics;
 };
@@ -247,6 +435,9 @@ public:
                                       true);
     }
 
+    this->project_initial_guess(
+      underlying_operator, dst, rhs, solver_data.n_projection_vectors, false /* symmetric */);
+
     if(solver_data.use_preconditioner == false)
     {
       solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
@@ -264,6 +455,12 @@ public:
     AssertThrow(std::isfinite(solver_control.last_value()),
                 dealii::ExcMessage("Solver contained NaN of Inf values"));
 
+    this->update_projection_space(underlying_operator,
+                                  dst,
+                                  solver_data.n_projection_vectors,
+                                  false /* symmetric */,
+                                  false /* augmented */);
+
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
@@ -296,6 +493,7 @@ struct SolverDataFGMRES
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
       max_n_tmp_vectors(30),
+      n_projection_vectors(0),
       compute_performance_metrics(false)
   {
   }
@@ -305,6 +503,9 @@ struct SolverDataFGMRES
   double       solver_tolerance_rel;
   bool         use_preconditioner;
   unsigned int max_n_tmp_vectors;
+  // dimension of the subspace recycled from previous solves (0 = no recycling). The Krylov space
+  // is augmented by this subspace in every iteration (GCRO).
+  unsigned int n_projection_vectors;
   bool         compute_performance_metrics;
 };
 
@@ -340,23 +541,50 @@ public:
 
     dealii::SolverFGMRES<VectorType> solver(solver_control, additional_data);
 
-    if(solver_data.use_preconditioner == false)
+    if(update_preconditioner == true and solver_data.use_preconditioner == true)
     {
-      solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+      preconditioner.update();
     }
-    else
+
+    if(solver_data.n_projection_vectors > 0)
     {
-      if(update_preconditioner == true)
-      {
-        preconditioner.update();
-      }
+      // minimal residual projection onto the recycled subspace U, followed by FGMRES applied to
+      // the projected system (I - C C^T) A x = (I - C C^T) b with C = A U
+      this->recompute_projection_images(underlying_operator);
 
-      solver.solve(underlying_operator, dst, rhs, preconditioner);
+      this->project_initial_guess(
+        underlying_operator, dst, rhs, solver_data.n_projection_vectors, false /* symmetric */);
+
+      VectorType rhs_projected(rhs);
+      for(VectorType const & c : this->projection_images)
+        rhs_projected.add(-(c * rhs_projected), c);
+
+      AugmentedOperator<Operator, VectorType> augmented_operator(underlying_operator,
+                                                                 this->projection_images);
+
+      if(solver_data.use_preconditioner == false)
+        solver.solve(augmented_operator, dst, rhs_projected, dealii::PreconditionIdentity());
+      else
+        solver.solve(augmented_operator, dst, rhs_projected, preconditioner);
+    }
+    else
+    {
+      if(solver_data.use_preconditioner == false)
+        solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+      else
+        solver.solve(underlying_operator, dst, rhs, preconditioner);
     }
 
     AssertThrow(std::isfinite(solver_control.last_value()),
                 dealii::ExcMessage("Solver contained NaN of Inf values"));
 
+    // correct the solution by the recycled subspace and update the recycled subspace
+    this->update_projection_space(underlying_operator,
+                                  dst,
+                                  solver_data.n_projection_vectors,
+                                  false /* symmetric */,
+                                  true /* augmented */);
+
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
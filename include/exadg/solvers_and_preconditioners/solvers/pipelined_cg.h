@@ -0,0 +1,278 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_PIPELINED_CG_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_PIPELINED_CG_H_
+
+// C/C++
+#include <array>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/lac/solver_control.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Pipelined preconditioned conjugate gradient method according to
+ *
+ *   Ghysels, P., Vanroose, W. (2014). Hiding global synchronization latency in the preconditioned
+ *   Conjugate Gradient algorithm. Parallel Computing, 40(7), 224-238.
+ *
+ * Compared to the standard CG method, the algorithm requires only one global reduction per
+ * iteration (the inner products (r,u), (w,u), and the residual norm (r,r) are combined into a
+ * single message). This reduction is non-blocking and overlapped with the application of the
+ * preconditioner and the operator. The price to pay are additional vector updates, which are
+ * performed in a single sweep over all vectors together with the computation of the local inner
+ * products needed in the next iteration. Note that the convergence check is based on the
+ * unpreconditioned residual as for dealii::SolverCG, but is lagged by one iteration due to the
+ * pipelining.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+public:
+  SolverPipelinedCG(Operator const &     underlying_operator_in,
+                    Preconditioner &     preconditioner_in,
+                    SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs, bool const update_preconditioner) const override
+  {
+    dealii::Timer timer;
+
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+
+    this->project_initial_guess(
+      underlying_operator, dst, rhs, solver_data.n_projection_vectors, true /* symmetric */);
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    // residual r and preconditioned residual u, w = A u
+    VectorType r, u, w;
+    // auxiliary vectors m = M w, n = A m
+    VectorType m, n;
+    // search direction p and auxiliary vectors s = A p, q = M s, z = A q
+    VectorType p, s, q, z;
+
+    for(VectorType * vector : {&r, &u, &w, &m, &n, &p, &s, &q, &z})
+      vector->reinit(dst);
+
+    MPI_Comm const mpi_comm = dst.get_mpi_communicator();
+
+    // r = b - A x
+    underlying_operator.vmult(r, dst);
+    r.sadd(-1.0, 1.0, rhs);
+
+    // u = M r, w = A u
+    apply_preconditioner(u, r);
+    underlying_operator.vmult(w, u);
+
+    std::array<double, 3> local_sums  = compute_local_inner_products(r, u, w);
+    std::array<double, 3> global_sums = {{0.0, 0.0, 0.0}};
+
+    double gamma_old = 1.0;
+    double alpha_old = 1.0;
+
+    unsigned int                 k     = 0;
+    dealii::SolverControl::State state = dealii::SolverControl::iterate;
+    while(true)
+    {
+      // start the (single) global reduction of this iteration
+      MPI_Request request;
+      int         ierr = MPI_Iallreduce(
+        local_sums.data(), global_sums.data(), 3, MPI_DOUBLE, MPI_SUM, mpi_comm, &request);
+      AssertThrowMPI(ierr);
+
+      // overlap the reduction with the application of the preconditioner and the operator
+      apply_preconditioner(m, w);
+      underlying_operator.vmult(n, m);
+
+      ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      double const gamma = global_sums[0];
+      double const delta = global_sums[1];
+
+      state = solver_control.check(k, std::sqrt(global_sums[2]));
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      double beta  = 0.0;
+      double alpha = gamma / delta;
+      if(k > 0)
+      {
+        beta  = gamma / gamma_old;
+        alpha = gamma / (delta - beta * gamma / alpha_old);
+      }
+
+      local_sums = update_vectors_and_compute_local_inner_products(
+        alpha, beta, dst, r, u, w, m, n, p, s, q, z);
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+      ++k;
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Solver contained NaN of Inf values"));
+
+    this->update_projection_space(underlying_operator,
+                                  dst,
+                                  solver_data.n_projection_vectors,
+                                  true /* symmetric */,
+                                  false /* augmented */);
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverPipelinedCG"}, timer.wall_time());
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    this->timer_tree->insert({"SolverPipelinedCG"}, preconditioner.get_timings());
+
+    return this->timer_tree;
+  }
+
+private:
+  void
+  apply_preconditioner(VectorType & dst, VectorType const & src) const
+  {
+    if(solver_data.use_preconditioner)
+      preconditioner.vmult(dst, src);
+    else
+      dst.copy_locally_owned_data_from(src);
+  }
+
+  /*
+   * Returns the process-local contributions to (r,u), (w,u), and (r,r).
+   */
+  static std::array<double, 3>
+  compute_local_inner_products(VectorType const & r, VectorType const & u, VectorType const & w)
+  {
+    std::array<double, 3> sums = {{0.0, 0.0, 0.0}};
+
+    unsigned int const size = r.get_partitioner()->locally_owned_size();
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      double const r_i = r.local_element(i);
+      double const u_i = u.local_element(i);
+      sums[0] += r_i * u_i;
+      sums[1] += w.local_element(i) * u_i;
+      sums[2] += r_i * r_i;
+    }
+
+    return sums;
+  }
+
+  /*
+   * Performs all vector updates of one iteration of the pipelined CG method in a single loop over
+   * the locally owned entries, and computes the local contributions to the inner products needed
+   * in the next iteration on the fly.
+   */
+  static std::array<double, 3>
+  update_vectors_and_compute_local_inner_products(double const       alpha,
+                                                  double const       beta,
+                                                  VectorType &       x,
+                                                  VectorType &       r,
+                                                  VectorType &       u,
+                                                  VectorType &       w,
+                                                  VectorType const & m,
+                                                  VectorType const & n,
+                                                  VectorType &       p,
+                                                  VectorType &       s,
+                                                  VectorType &       q,
+                                                  VectorType &       z)
+  {
+    std::array<double, 3> sums = {{0.0, 0.0, 0.0}};
+
+    Number const a = alpha;
+    Number const b = beta;
+
+    Number * const       x_ptr = x.begin();
+    Number * const       r_ptr = r.begin();
+    Number * const       u_ptr = u.begin();
+    Number * const       w_ptr = w.begin();
+    Number const * const m_ptr = m.begin();
+    Number const * const n_ptr = n.begin();
+    Number * const       p_ptr = p.begin();
+    Number * const       s_ptr = s.begin();
+    Number * const       q_ptr = q.begin();
+    Number * const       z_ptr = z.begin();
+
+    unsigned int const size = r.get_partitioner()->locally_owned_size();
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      z_ptr[i] = n_ptr[i] + b * z_ptr[i];
+      q_ptr[i] = m_ptr[i] + b * q_ptr[i];
+      s_ptr[i] = w_ptr[i] + b * s_ptr[i];
+      p_ptr[i] = u_ptr[i] + b * p_ptr[i];
+
+      x_ptr[i] += a * p_ptr[i];
+      r_ptr[i] -= a * s_ptr[i];
+      u_ptr[i] -= a * q_ptr[i];
+      w_ptr[i] -= a * z_ptr[i];
+
+      sums[0] += static_cast<double>(r_ptr[i]) * u_ptr[i];
+      sums[1] += static_cast<double>(w_ptr[i]) * u_ptr[i];
+      sums[2] += static_cast<double>(r_ptr[i]) * r_ptr[i];
+    }
+
+    return sums;
+  }
+
+  Operator const &   underlying_operator;
+  Preconditioner &   preconditioner;
+  SolverDataCG const solver_data;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_PIPELINED_CG_H_ */
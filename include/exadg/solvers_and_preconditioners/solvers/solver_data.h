@@ -32,7 +32,8 @@ namespace ExaDG
 {
 struct SolverData
 {
-  SolverData() : max_iter(1e3), abs_tol(1e-20), rel_tol(1e-6), max_krylov_size(30)
+  SolverData()
+    : max_iter(1e3), abs_tol(1e-20), rel_tol(1e-6), max_krylov_size(30), n_projection_vectors(0)
   {
   }
 
@@ -40,7 +41,11 @@ struct SolverData
              double const       abs_tol_,
              double const       rel_tol_,
              unsigned int const max_krylov_size_ = 30)
-    : max_iter(max_iter_), abs_tol(abs_tol_), rel_tol(rel_tol_), max_krylov_size(max_krylov_size_)
+    : max_iter(max_iter_),
+      abs_tol(abs_tol_),
+      rel_tol(rel_tol_),
+      max_krylov_size(max_krylov_size_),
+      n_projection_vectors(0)
   {
   }
 
@@ -51,6 +56,8 @@ struct SolverData
     print_parameter(pcout, "Absolute solver tolerance", abs_tol);
     print_parameter(pcout, "Relative solver tolerance", rel_tol);
     print_parameter(pcout, "Maximum size of Krylov space", max_krylov_size);
+    if(n_projection_vectors > 0)
+      print_parameter(pcout, "Number of projection vectors", n_projection_vectors);
   }
 
   unsigned int max_iter;
@@ -58,6 +65,9 @@ struct SolverData
   double       rel_tol;
   // only relevant for GMRES type solvers
   unsigned int max_krylov_size;
+  // number of previous solutions used to compute the initial guess of repeated solves by
+  // projection (CG/GMRES) or recycled to augment the Krylov space (FGMRES), 0 = disabled
+  unsigned int n_projection_vectors;
 };
 } // namespace ExaDG
 
@@ -100,7 +100,12 @@ private:
 
     dealii::AlignedVector<dealii::VectorizedArray<Number>> solution(dofs_per_cell);
 
-    // setup elementwise solver
+    // setup elementwise solver, which is local to the cell range so that the cell ranges can be
+    // processed task-parallel
+    std::shared_ptr<
+      Elementwise::SolverBase<dealii::VectorizedArray<Number>, Operator, Preconditioner>>
+      solver;
+
     if(iterative_solver_data.solver_type == Solver::CG)
     {
       solver = std::make_shared<
@@ -138,10 +143,6 @@ private:
     }
   }
 
-  mutable std::shared_ptr<
-    Elementwise::SolverBase<dealii::VectorizedArray<Number>, Operator, Preconditioner>>
-    solver;
-
   Operator & op;
 
   Preconditioner & preconditioner;
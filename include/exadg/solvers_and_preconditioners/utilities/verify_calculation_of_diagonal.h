@@ -85,6 +85,44 @@ verify_calculation_of_diagonal(Operator &
   pcout << "L2 error diagonal: " << std::setprecision(10) << norm_error << std::endl << std::endl;
 }
 
+/*
+ *  To check the correctness of the sum-factorized computation of the diagonal
+ *  the result is compared to the computation of the diagonal column by column,
+ *  i.e. by applying the cell and face integrals to all unit vectors of a cell.
+ *  In contrast to the function above, this check is feasible for large problems
+ *  and in parallel. The Operator passed to this function has to implement the
+ *  functions calculate_diagonal() and calculate_diagonal_column_by_column().
+ */
+template<typename Operator>
+void
+verify_calculation_of_diagonal_sum_factorization(Operator const & op, MPI_Comm const & mpi_comm)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  pcout << "Verify sum-factorized calculation of diagonal:" << std::endl;
+
+  typedef typename Operator::VectorType  VectorType;
+  typedef typename VectorType::value_type value_type;
+
+  VectorType diagonal, diagonal_check;
+  op.calculate_diagonal(diagonal);
+  op.calculate_diagonal_column_by_column(diagonal_check);
+
+  value_type norm_diagonal       = diagonal.l2_norm();
+  value_type norm_diagonal_check = diagonal_check.l2_norm();
+
+  pcout << std::endl
+        << "L2 norm diagonal - Sum factorization: " << std::setprecision(10) << norm_diagonal
+        << std::endl;
+  pcout << "L2 norm diagonal - Column by column: " << std::setprecision(10) << norm_diagonal_check
+        << std::endl;
+
+  diagonal_check.add(-1.0, diagonal);
+  value_type norm_error = diagonal_check.l2_norm();
+
+  pcout << "L2 error diagonal: " << std::setprecision(10) << norm_error << std::endl << std::endl;
+}
+
 } // namespace ExaDG
 
 
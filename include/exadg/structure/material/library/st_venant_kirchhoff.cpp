@@ -136,6 +136,10 @@ dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
 {
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> S;
 
+  dealii::VectorizedArray<Number> f0 = this->f0;
+  dealii::VectorizedArray<Number> f1 = this->f1;
+  dealii::VectorizedArray<Number> f2 = this->f2;
+
   if(E_is_variable)
   {
     f0 = f0_coefficients.get_coefficient(cell, q);
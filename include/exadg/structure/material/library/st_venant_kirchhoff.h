@@ -100,9 +100,9 @@ private:
 
   StVenantKirchhoffData<dim> const & data;
 
-  mutable dealii::VectorizedArray<Number> f0;
-  mutable dealii::VectorizedArray<Number> f1;
-  mutable dealii::VectorizedArray<Number> f2;
+  dealii::VectorizedArray<Number> f0;
+  dealii::VectorizedArray<Number> f1;
+  dealii::VectorizedArray<Number> f2;
 
   // cache coefficients for spatially varying material parameters
   bool                                           E_is_variable;
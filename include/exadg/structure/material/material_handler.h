@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_STRUCTURE_MATERIAL_MATERIAL_HANDLER_H_
 
 // deal.II
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
@@ -98,13 +99,13 @@ public:
                   dealii::ExcMessage("You have to categorize cells according to their materials!"));
 #endif
 
-    material = material_map[mid];
+    material.get() = material_map.at(mid);
   }
 
   std::shared_ptr<Material<dim, Number>>
   get_material() const
   {
-    return material;
+    return material.get();
   }
 
 private:
@@ -113,8 +114,8 @@ private:
   std::shared_ptr<MaterialDescriptor const> material_descriptor;
   Materials                                 material_map;
 
-  // pointer to material of current cell
-  std::shared_ptr<Material<dim, Number>> material;
+  // pointer to material of current cell, stored per thread for task-parallel matrix-free loops
+  mutable dealii::Threads::ThreadLocalStorage<std::shared_ptr<Material<dim, Number>>> material;
 };
 
 } // namespace Structure
@@ -40,24 +40,37 @@ write_output(OutputDataBase const &          output_data,
              dealii::Mapping<dim> const &    mapping,
              VectorType const &              solution_vector,
              unsigned int const              output_counter,
-             MPI_Comm const &                mpi_comm)
+             double const                    time,
+             MPI_Comm const &                mpi_comm,
+             OutputPipeline *                pipeline,
+             HDF5Output<dim> *               hdf5_output)
 {
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
 
-  dealii::DataOut<dim> data_out;
-  data_out.set_flags(flags);
+  auto data_out = std::make_shared<dealii::DataOut<dim>>();
+  data_out->set_flags(flags);
+
+  auto vectors = std::make_shared<OutputVectors<VectorType>>(pipeline != nullptr);
 
   std::vector<std::string> names(dim, "displacement");
   std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
     component_interpretation(dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
 
-  data_out.add_data_vector(dof_handler, solution_vector, names, component_interpretation);
-
-  data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
-
-  data_out.write_vtu_with_pvtu_record(
-    output_data.directory, output_data.filename, output_counter, mpi_comm, 4);
+  data_out->add_data_vector(dof_handler,
+                            vectors->get(solution_vector),
+                            names,
+                            component_interpretation);
+
+  build_patches_and_write(data_out,
+                          {vectors},
+                          mapping,
+                          output_data,
+                          output_counter,
+                          time,
+                          mpi_comm,
+                          pipeline,
+                          hdf5_output);
 }
 
 template<int dim, typename Number>
@@ -76,6 +89,8 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   mapping     = &mapping_in;
   output_data = output_data_in;
 
+  output_data.check();
+
   // reset output counter
   output_counter = output_data.start_counter;
 
@@ -83,6 +98,12 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
   {
     create_directories(output_data.directory, mpi_comm);
 
+    if(output_data.asynchronous)
+      pipeline = std::make_shared<OutputPipeline>(output_data.max_pending_outputs);
+
+    if(output_data.write_hdf5)
+      hdf5_output = std::make_shared<HDF5Output<dim>>(mpi_comm);
+
     // Visualize boundary IDs:
     // since boundary IDs typically do not change during the simulation, we only do this
     // once at the beginning of the simulation (i.e., in the setup function).
@@ -149,7 +170,15 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & solution,
               << "OUTPUT << Write data at time t = " << std::scientific << std::setprecision(4)
               << time << std::endl;
 
-        write_output<dim>(output_data, *dof_handler, *mapping, solution, output_counter, mpi_comm);
+        write_output<dim>(output_data,
+                          *dof_handler,
+                          *mapping,
+                          solution,
+                          output_counter,
+                          time,
+                          mpi_comm,
+                          pipeline.get(),
+                          hdf5_output.get());
 
         ++output_counter;
       }
@@ -160,7 +189,15 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & solution,
             << "OUTPUT << Write " << (output_counter == 0 ? "initial" : "solution") << " data"
             << std::endl;
 
-      write_output<dim>(output_data, *dof_handler, *mapping, solution, output_counter, mpi_comm);
+      write_output<dim>(output_data,
+                        *dof_handler,
+                        *mapping,
+                        solution,
+                        output_counter,
+                        time,
+                        mpi_comm,
+                        pipeline.get(),
+                        hdf5_output.get());
 
       ++output_counter;
     }
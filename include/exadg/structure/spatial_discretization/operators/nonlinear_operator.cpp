@@ -36,7 +36,7 @@ NonLinearOperator<dim, Number>::initialize(
 {
   Base::initialize(matrix_free, affine_constraints, data);
 
-  integrator_lin = std::make_shared<IntegratorCell>(*this->matrix_free);
+  integrator_lin.reset(std::make_shared<IntegratorCell>(*this->matrix_free), *this->matrix_free);
   this->matrix_free->initialize_dof_vector(displacement_lin, data.dof_index);
   displacement_lin.update_ghost_values();
 }
@@ -231,13 +231,15 @@ NonLinearOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) co
 {
   std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
 
+  IntegratorCell const & integrator_lin_cell = *integrator_lin;
+
   // loop over all quadrature points
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     // kinematics
     tensor const Grad_delta = integrator.get_gradient(q);
 
-    tensor const F_lin = get_F<dim, Number>(integrator_lin->get_gradient(q));
+    tensor const F_lin = get_F<dim, Number>(integrator_lin_cell.get_gradient(q));
 
     // Green-Lagrange strains
     tensor const E_lin = get_E<dim, Number>(F_lin);
@@ -171,8 +171,11 @@ private:
   void
   do_cell_integral(IntegratorCell & integrator) const override;
 
-  mutable std::shared_ptr<IntegratorCell> integrator_lin;
-  mutable VectorType                      displacement_lin;
+  // integrator of the linearization point, one per thread if the matrix-free loops are executed
+  // task-parallel
+  thread_local_ptr<IntegratorCell> integrator_lin;
+
+  mutable VectorType displacement_lin;
 };
 
 } // namespace Structure
@@ -264,17 +264,17 @@ TimeIntGenAlpha<dim, Number>::prepare_vectors_for_next_timestep()
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_write_restart(std::string const & filename) const
+TimeIntGenAlpha<dim, Number>::do_write_restart(std::string const & name) const
 {
-  (void)filename;
+  (void)name;
   AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
 }
 
 template<int dim, typename Number>
 void
-TimeIntGenAlpha<dim, Number>::do_read_restart(std::ifstream & in)
+TimeIntGenAlpha<dim, Number>::do_read_restart(std::string const & name)
 {
-  (void)in;
+  (void)name;
   AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
 }
 
@@ -107,10 +107,10 @@ private:
   prepare_vectors_for_next_timestep() final;
 
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::string const & name) const final;
 
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::string const & name) final;
 
   void
   postprocessing() const final;
@@ -0,0 +1,266 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_EMBEDDED_ERROR_CONTROL_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_EMBEDDED_ERROR_CONTROL_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Parameters of the step size selection based on the error estimate of embedded Runge-Kutta
+ * schemes.
+ */
+struct EmbeddedErrorControlData
+{
+  EmbeddedErrorControlData()
+    : active(false),
+      absolute_tolerance(1.e-6),
+      relative_tolerance(1.e-4),
+      safety_factor(0.9),
+      min_factor(0.2),
+      max_factor(5.0),
+      beta_1(0.7),
+      beta_2(0.4),
+      max_number_of_rejections(20)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    if(active)
+    {
+      print_parameter(pcout, "Embedded error control", active);
+      print_parameter(pcout, "Absolute tolerance", absolute_tolerance);
+      print_parameter(pcout, "Relative tolerance", relative_tolerance);
+      print_parameter(pcout, "Safety factor", safety_factor);
+      print_parameter(pcout, "Minimum factor", min_factor);
+      print_parameter(pcout, "Maximum factor", max_factor);
+      print_parameter(pcout, "PI controller beta_1", beta_1);
+      print_parameter(pcout, "PI controller beta_2", beta_2);
+      print_parameter(pcout, "Maximum number of rejections", max_number_of_rejections);
+    }
+  }
+
+  // use error estimate of embedded Runge-Kutta scheme to select the time step size
+  bool active;
+
+  // tolerances used to weight the error estimate, a time step is accepted if the weighted
+  // root-mean-square norm of the error estimate is smaller than one
+  double absolute_tolerance;
+  double relative_tolerance;
+
+  // safety factor applied to the optimal time step size
+  double safety_factor;
+
+  // minimum and maximum factor by which the time step size may change from one step to the next
+  double min_factor;
+  double max_factor;
+
+  // exponents of the PI controller (divided by the order of the embedded scheme plus one)
+  double beta_1;
+  double beta_2;
+
+  // maximum number of subsequent rejections of a time step
+  unsigned int max_number_of_rejections;
+};
+
+/*
+ * Weighted root-mean-square norm of the error estimate
+ *
+ *   || e || = sqrt( 1/N sum_i ( e_i / (atol + rtol * max(|u_n,i|, |u_n+1,i|)) )^2 ) .
+ */
+template<typename Number>
+double
+calculate_weighted_error_norm(dealii::LinearAlgebra::distributed::Vector<Number> const & error,
+                              dealii::LinearAlgebra::distributed::Vector<Number> const & u_n,
+                              dealii::LinearAlgebra::distributed::Vector<Number> const & u_np,
+                              double const absolute_tolerance,
+                              double const relative_tolerance)
+{
+  unsigned int const size = error.get_partitioner()->locally_owned_size();
+
+  double sum = 0.0;
+  for(unsigned int i = 0; i < size; ++i)
+  {
+    double const scale =
+      absolute_tolerance +
+      relative_tolerance *
+        std::max(std::abs(double(u_n.local_element(i))), std::abs(double(u_np.local_element(i))));
+    double const e = double(error.local_element(i)) / scale;
+    sum += e * e;
+  }
+
+  sum = dealii::Utilities::MPI::sum(sum, error.get_mpi_communicator());
+
+  return std::sqrt(sum / std::max(1., double(error.size())));
+}
+
+/*
+ * PI step size controller according to Gustafsson (1991), see also Hairer & Wanner (1996,
+ * "Solving Ordinary Differential Equations II", Sect. IV.2). For an accepted step with error
+ * err_n, the new time step size is
+ *
+ *   dt_{n+1} = dt_n * fac * err_n^{-beta_1/k} * err_{n-1}^{beta_2/k} ,
+ *
+ * where k is the order of the embedded scheme plus one. A rejected step is repeated with
+ * dt = dt * fac * err^{-1/k}. The controller also counts accepted and rejected time steps.
+ */
+class PIController
+{
+public:
+  PIController(EmbeddedErrorControlData const & data_in, unsigned int const order_embedded)
+    : data(data_in),
+      k(double(order_embedded + 1)),
+      error_old(1.0),
+      last_step_rejected(false),
+      n_accepted(0),
+      n_rejected(0)
+  {
+  }
+
+  /*
+   * Returns whether the time step with the given (weighted) error is accepted and overwrites
+   * time_step with the time step size to be used for the next (or the repeated) time step.
+   */
+  bool
+  update_time_step(double & time_step, double const error)
+  {
+    double const err = std::max(error, 1.e-10);
+
+    if(err <= 1.0)
+    {
+      double factor = data.safety_factor * std::pow(err, -data.beta_1 / k) *
+                      std::pow(error_old, data.beta_2 / k);
+
+      // do not increase the time step size directly after a rejection
+      double const max_factor = last_step_rejected ? 1.0 : data.max_factor;
+      factor                  = std::min(max_factor, std::max(data.min_factor, factor));
+
+      time_step *= factor;
+      error_old          = err;
+      last_step_rejected = false;
+      ++n_accepted;
+
+      return true;
+    }
+    else
+    {
+      double const factor = data.safety_factor * std::pow(err, -1.0 / k);
+
+      time_step *= std::min(1.0, std::max(data.min_factor, factor));
+      last_step_rejected = true;
+      ++n_rejected;
+
+      return false;
+    }
+  }
+
+  unsigned int
+  get_number_of_accepted_steps() const
+  {
+    return n_accepted;
+  }
+
+  unsigned int
+  get_number_of_rejected_steps() const
+  {
+    return n_rejected;
+  }
+
+  void
+  print_statistics(dealii::ConditionalOStream const & pcout, std::string const & name) const
+  {
+    pcout << std::endl << name << ":" << std::endl;
+    print_parameter(pcout, "Accepted time steps", n_accepted);
+    print_parameter(pcout, "Rejected time steps", n_rejected);
+  }
+
+  EmbeddedErrorControlData const &
+  get_data() const
+  {
+    return data;
+  }
+
+private:
+  EmbeddedErrorControlData const data;
+
+  double const k;
+
+  double error_old;
+
+  bool last_step_rejected;
+
+  unsigned int n_accepted, n_rejected;
+};
+
+/*
+ * Performs one time step starting from src at the given time using an embedded Runge-Kutta
+ * scheme, where solve(dst, src, error, time, time_step) computes the solution and the error
+ * estimate of one time step. The time step is repeated with a smaller time step size until it is
+ * accepted by the controller. The function returns the size of the accepted time step and
+ * overwrites time_step with the proposed size of the next time step.
+ */
+template<typename VectorType, typename SolveFunction>
+double
+do_timestep_with_error_control(VectorType &          dst,
+                               VectorType &          src,
+                               VectorType &          error,
+                               double const          time,
+                               double &              time_step,
+                               PIController &        controller,
+                               SolveFunction const & solve)
+{
+  EmbeddedErrorControlData const & data = controller.get_data();
+
+  for(unsigned int n_rejections = 0;; ++n_rejections)
+  {
+    AssertThrow(n_rejections <= data.max_number_of_rejections,
+                dealii::ExcMessage("Maximum number of rejected time steps exceeded."));
+
+    double const time_step_attempt = time_step;
+
+    solve(dst, src, error, time, time_step_attempt);
+
+    double const error_norm = calculate_weighted_error_norm(
+      error, src, dst, data.absolute_tolerance, data.relative_tolerance);
+
+    if(controller.update_time_step(time_step, error_norm))
+      return time_step_attempt;
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_EMBEDDED_ERROR_CONTROL_H_ */
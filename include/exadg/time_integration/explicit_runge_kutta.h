@@ -42,6 +42,45 @@ public:
   virtual unsigned int
   get_order() const = 0;
 
+  /*
+   * Schemes with an embedded scheme of lower order additionally provide an estimate of the local
+   * error of a time step, which can be used for adaptive time stepping.
+   */
+  virtual bool
+  has_embedded_scheme() const
+  {
+    return false;
+  }
+
+  virtual unsigned int
+  get_order_embedded_scheme() const
+  {
+    AssertThrow(false, dealii::ExcMessage("This time integrator has no embedded scheme."));
+
+    return 0;
+  }
+
+  /*
+   * Same as solve_timestep(), but additionally writes the difference between the solution of the
+   * main scheme and the solution of the embedded scheme to the vector error. The vector src is
+   * not modified so that a time step can be repeated in case it is rejected.
+   */
+  virtual void
+  solve_timestep_with_error_estimate(VectorType & dst,
+                                     VectorType & src,
+                                     VectorType & error,
+                                     double const time,
+                                     double const time_step)
+  {
+    (void)dst;
+    (void)src;
+    (void)error;
+    (void)time;
+    (void)time_step;
+
+    AssertThrow(false, dealii::ExcMessage("This time integrator has no embedded scheme."));
+  }
+
 protected:
   std::shared_ptr<Operator> underlying_operator;
 };
@@ -225,6 +264,82 @@ private:
  *                                                                                      *
  ****************************************************************************************/
 
+/*
+ *  Coefficients of the low-storage Runge-Kutta methods with two registers of Kennedy et al.
+ *  (2000), i.e., RK3(2)4[2R+]C, RK4(3)5[2R+]C, and RK5(4)9[2R+]S, see Table 1 on page 189. The
+ *  vector a contains the coefficients a_{i+1,i} and the vector b the coefficients b_i of the
+ *  Butcher tables below, and b_hat the coefficients of the embedded schemes (not available for
+ *  RK5(4)9[2R+]S).
+ */
+struct LowStorageRKReg2Coefficients
+{
+  LowStorageRKReg2Coefficients(unsigned int const order, unsigned int const stages)
+  {
+    if(order == 3 && stages == 4)
+    {
+      a = {11847461282814. / 36547543011857.,
+           3943225443063. / 7078155732230.,
+           -346793006927. / 4029903576067.};
+
+      b = {1017324711453. / 9774461848756.,
+           8237718856693. / 13685301971492.,
+           57731312506979. / 19404895981398.,
+           -101169746363290. / 37734290219643.};
+
+      b_hat = {15763415370699. / 46270243929542.,
+               514528521746. / 5659431552419.,
+               27030193851939. / 9429696342944.,
+               -69544964788955. / 30262026368149.};
+    }
+    else if(order == 4 && stages == 5)
+    {
+      a = {970286171893. / 4311952581923.,
+           6584761158862. / 12103376702013.,
+           2251764453980. / 15575788980749.,
+           26877169314380. / 34165994151039.};
+
+      b = {1153189308089. / 22510343858157.,
+           1772645290293. / 4653164025191.,
+           -1672844663538. / 4480602732383.,
+           2114624349019. / 3568978502595.,
+           5198255086312. / 14908931495163.};
+
+      b_hat = {1016888040809. / 7410784769900.,
+               11231460423587. / 58533540763752.,
+               -1563879915014. / 6823010717585.,
+               606302364029. / 971179775848.,
+               1097981568119. / 3980877426909.};
+    }
+    else if(order == 5 && stages == 9)
+    {
+      a = {1107026461565. / 5417078080134.,
+           38141181049399. / 41724347789894.,
+           493273079041. / 11940823631197.,
+           1851571280403. / 6147804934346.,
+           11782306865191. / 62590030070788.,
+           9452544825720. / 13648368537481.,
+           4435885630781. / 26285702406235.,
+           2357909744247. / 11371140753790.};
+
+      b = {2274579626619. / 23610510767302.,
+           693987741272. / 12394497460941.,
+           -347131529483. / 15096185902911.,
+           1144057200723. / 32081666971178.,
+           1562491064753. / 11797114684756.,
+           13113619727965. / 44346030145118.,
+           393957816125. / 7825732611452.,
+           720647959663. / 6565743875477.,
+           3559252274877. / 14424734981077.};
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    }
+  }
+
+  std::vector<double> a, b, b_hat;
+};
+
 /*
  *  Low storage Runge-Kutta method of order 3 with 4 stages and 2 registers according to
  *  Kennedy et al. (2000), where this method is denoted as RK3(2)4[2R+]C,
@@ -235,7 +350,7 @@ class LowStorageRK3Stage4Reg2C : public ExplicitTimeIntegrator<Operator, VectorT
 {
 public:
   LowStorageRK3Stage4Reg2C(std::shared_ptr<Operator> const operator_in)
-    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), coefficients(3, 4)
   {
   }
 
@@ -262,14 +377,14 @@ public:
      *
      */
 
-    double const a21 = 11847461282814. / 36547543011857.;
-    double const a32 = 3943225443063. / 7078155732230.;
-    double const a43 = -346793006927. / 4029903576067.;
+    double const a21 = coefficients.a[0];
+    double const a32 = coefficients.a[1];
+    double const a43 = coefficients.a[2];
 
-    double const b1 = 1017324711453. / 9774461848756.;
-    double const b2 = 8237718856693. / 13685301971492.;
-    double const b3 = 57731312506979. / 19404895981398.;
-    double const b4 = -101169746363290. / 37734290219643.;
+    double const b1 = coefficients.b[0];
+    double const b2 = coefficients.b[1];
+    double const b3 = coefficients.b[2];
+    double const b4 = coefficients.b[3];
 
     double const c1 = 0.;
     double const c2 = a21;
@@ -306,6 +421,8 @@ public:
   }
 
 private:
+  LowStorageRKReg2Coefficients const coefficients;
+
   VectorType vec_tmp1;
 };
 
@@ -320,7 +437,7 @@ class LowStorageRK4Stage5Reg2C : public ExplicitTimeIntegrator<Operator, VectorT
 {
 public:
   LowStorageRK4Stage5Reg2C(std::shared_ptr<Operator> const operator_in)
-    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), coefficients(4, 5)
   {
   }
 
@@ -348,16 +465,16 @@ public:
      *
      */
 
-    double const a21 = 970286171893. / 4311952581923.;
-    double const a32 = 6584761158862. / 12103376702013.;
-    double const a43 = 2251764453980. / 15575788980749.;
-    double const a54 = 26877169314380. / 34165994151039.;
+    double const a21 = coefficients.a[0];
+    double const a32 = coefficients.a[1];
+    double const a43 = coefficients.a[2];
+    double const a54 = coefficients.a[3];
 
-    double const b1 = 1153189308089. / 22510343858157.;
-    double const b2 = 1772645290293. / 4653164025191.;
-    double const b3 = -1672844663538. / 4480602732383.;
-    double const b4 = 2114624349019. / 3568978502595.;
-    double const b5 = 5198255086312. / 14908931495163.;
+    double const b1 = coefficients.b[0];
+    double const b2 = coefficients.b[1];
+    double const b3 = coefficients.b[2];
+    double const b4 = coefficients.b[3];
+    double const b5 = coefficients.b[4];
 
     double const c1 = 0.;
     double const c2 = a21;
@@ -402,6 +519,8 @@ public:
   }
 
 private:
+  LowStorageRKReg2Coefficients const coefficients;
+
   VectorType vec_tmp1;
 };
 
@@ -527,7 +646,7 @@ class LowStorageRK5Stage9Reg2S : public ExplicitTimeIntegrator<Operator, VectorT
 {
 public:
   LowStorageRK5Stage9Reg2S(std::shared_ptr<Operator> const operator_in)
-    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), coefficients(5, 9)
   {
   }
 
@@ -556,24 +675,24 @@ public:
      *
      */
 
-    double const a21 = 1107026461565. / 5417078080134.;
-    double const a32 = 38141181049399. / 41724347789894.;
-    double const a43 = 493273079041. / 11940823631197.;
-    double const a54 = 1851571280403. / 6147804934346.;
-    double const a65 = 11782306865191. / 62590030070788.;
-    double const a76 = 9452544825720. / 13648368537481.;
-    double const a87 = 4435885630781. / 26285702406235.;
-    double const a98 = 2357909744247. / 11371140753790.;
-
-    double const b1 = 2274579626619. / 23610510767302.;
-    double const b2 = 693987741272. / 12394497460941.;
-    double const b3 = -347131529483. / 15096185902911.;
-    double const b4 = 1144057200723. / 32081666971178.;
-    double const b5 = 1562491064753. / 11797114684756.;
-    double const b6 = 13113619727965. / 44346030145118.;
-    double const b7 = 393957816125. / 7825732611452.;
-    double const b8 = 720647959663. / 6565743875477.;
-    double const b9 = 3559252274877. / 14424734981077.;
+    double const a21 = coefficients.a[0];
+    double const a32 = coefficients.a[1];
+    double const a43 = coefficients.a[2];
+    double const a54 = coefficients.a[3];
+    double const a65 = coefficients.a[4];
+    double const a76 = coefficients.a[5];
+    double const a87 = coefficients.a[6];
+    double const a98 = coefficients.a[7];
+
+    double const b1 = coefficients.b[0];
+    double const b2 = coefficients.b[1];
+    double const b3 = coefficients.b[2];
+    double const b4 = coefficients.b[3];
+    double const b5 = coefficients.b[4];
+    double const b6 = coefficients.b[5];
+    double const b7 = coefficients.b[6];
+    double const b8 = coefficients.b[7];
+    double const b9 = coefficients.b[8];
 
     double const c1 = 0.;
     double const c2 = a21;
@@ -646,9 +765,215 @@ public:
   }
 
 private:
+  LowStorageRKReg2Coefficients const coefficients;
+
   VectorType vec_tmp1;
 };
 
+/*
+ *  Low-storage Runge-Kutta methods with two registers of Kennedy et al. (2000), i.e., the
+ *  methods RK3(2)4[2R+]C, RK4(3)5[2R+]C, and RK5(4)9[2R+]S implemented above, written in terms of
+ *  the stage update
+ *
+ *    k_i     = F(r_i, t_n + c_i * dt) ,
+ *    r_{i+1} = u + a_{i+1,i} * dt * k_i ,
+ *    u       = u + b_i * dt * k_i ,
+ *
+ *  with r_1 = u = u_n. In contrast to the implementations above, the underlying operator performs
+ *  a fused inverse mass + register update: after the evaluation of the (unscaled) right-hand side,
+ *  the inverse mass operator, the sign change, and the vector updates of a stage are performed in
+ *  a single loop over all cells. The evaluation of the right-hand side itself remains a separate
+ *  loop. The operator has to provide the function evaluate_low_storage_rk_stage().
+ */
+template<typename Operator, typename VectorType>
+class LowStorageRKReg2Fused : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  LowStorageRKReg2Fused(std::shared_ptr<Operator> const operator_in,
+                        unsigned int const              order_in,
+                        unsigned int const              stages_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      order(order_in),
+      stages(stages_in),
+      coefficients(order_in, stages_in)
+  {
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    if(!vec_tmp.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      vec_tmp.reinit(vec_np);
+    }
+
+    // vec_n accumulates the solution u, vec_np contains the stage vectors r_i, and vec_tmp is
+    // used as temporary vector for the evaluation of the operator
+    double c     = 0.0; // c_i = b_1 + ... + b_{i-2} + a_{i,i-1}
+    double sum_b = 0.0;
+
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      bool const   last_stage = (i == stages - 1);
+      double const a_next     = last_stage ? 0.0 : coefficients.a[i];
+
+      this->underlying_operator->evaluate_low_storage_rk_stage(vec_np /* r_{i+1} */,
+                                                               vec_n /* u */,
+                                                               vec_tmp,
+                                                               i == 0 ? vec_n : vec_np /* r_i */,
+                                                               coefficients.b[i] * time_step,
+                                                               a_next * time_step,
+                                                               not last_stage,
+                                                               time + c * time_step);
+
+      c = sum_b + a_next;
+      sum_b += coefficients.b[i];
+    }
+
+    vec_np.swap(vec_n);
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+private:
+  unsigned int order;
+  unsigned int stages;
+
+  LowStorageRKReg2Coefficients const coefficients;
+
+  VectorType vec_tmp;
+};
+
+/*
+ *  Low-storage Runge-Kutta methods with two registers of Kennedy et al. (2000) together with their
+ *  embedded schemes, i.e., the methods RK3(2)4[2R+]C and RK4(3)5[2R+]C, see Table 1 on page 189
+ *  for the coefficients b_hat of the embedded schemes. Each stage is performed as
+ *
+ *    k_i     = F(r_i, t_n + c_i * dt) ,
+ *    r_{i+1} = u + a_{i+1,i} * dt * k_i ,
+ *    u       = u + b_i * dt * k_i ,
+ *    e       = e + (b_i - b_hat_i) * dt * k_i ,
+ *
+ *  with r_1 = u = u_n and e = 0. In contrast to the two-register implementations above, the
+ *  solution u_n is not overwritten, which requires one additional vector but allows to repeat a
+ *  rejected time step.
+ */
+template<typename Operator, typename VectorType>
+class LowStorageRKReg2Embedded : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  LowStorageRKReg2Embedded(std::shared_ptr<Operator> const operator_in,
+                           unsigned int const              order_in,
+                           unsigned int const              stages_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      order(order_in),
+      stages(stages_in),
+      coefficients(order_in, stages_in)
+  {
+    AssertThrow(not coefficients.b_hat.empty(),
+                dealii::ExcMessage("Embedded low-storage Runge-Kutta scheme not implemented."));
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    do_solve_timestep(vec_np, vec_n, nullptr, time, time_step);
+  }
+
+  void
+  solve_timestep_with_error_estimate(VectorType & vec_np,
+                                     VectorType & vec_n,
+                                     VectorType & error,
+                                     double const time,
+                                     double const time_step) final
+  {
+    if(!error.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      error.reinit(vec_n, true);
+    }
+
+    do_solve_timestep(vec_np, vec_n, &error, time, time_step);
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+  bool
+  has_embedded_scheme() const final
+  {
+    return true;
+  }
+
+  unsigned int
+  get_order_embedded_scheme() const final
+  {
+    return order - 1;
+  }
+
+private:
+  void
+  do_solve_timestep(VectorType &       vec_np,
+                    VectorType const & vec_n,
+                    VectorType *       error,
+                    double const       time,
+                    double const       time_step)
+  {
+    if(!vec_tmp1.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      vec_tmp1.reinit(vec_n, true);
+      vec_tmp2.reinit(vec_n, true);
+    }
+
+    // vec_np accumulates the solution u, vec_tmp1 contains the stage vectors r_i, and vec_tmp2 is
+    // used as temporary vector for the evaluation of the operator
+    vec_np = vec_n;
+    if(error != nullptr)
+      *error = 0.0;
+
+    double c     = 0.0; // c_i = b_1 + ... + b_{i-2} + a_{i,i-1}
+    double sum_b = 0.0;
+
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      this->underlying_operator->evaluate(vec_tmp2 /* k_i */,
+                                          i == 0 ? vec_n : vec_tmp1 /* r_i */,
+                                          time + c * time_step);
+
+      if(i < stages - 1)
+      {
+        vec_tmp1.equ(1.0, vec_np);
+        vec_tmp1.add(coefficients.a[i] * time_step, vec_tmp2); /* = r_{i+1} */
+        c = sum_b + coefficients.a[i];
+      }
+
+      vec_np.add(coefficients.b[i] * time_step, vec_tmp2); /* = u */
+      sum_b += coefficients.b[i];
+
+      if(error != nullptr)
+        error->add((coefficients.b[i] - coefficients.b_hat[i]) * time_step, vec_tmp2);
+    }
+  }
+
+  unsigned int order;
+  unsigned int stages;
+
+  LowStorageRKReg2Coefficients const coefficients;
+
+  VectorType vec_tmp1, vec_tmp2;
+};
 
 /*
  *  Explicit Runge-Kutta of Toulorge & Desmet (2011) in low-storage format (2N scheme)
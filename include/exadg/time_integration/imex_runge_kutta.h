@@ -0,0 +1,314 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/*
+ *  Additive (implicit-explicit) Runge-Kutta methods for a right-hand side that is split into a
+ *  non-stiff part F_E, which is treated explicitly, and a stiff part F_I, which is treated
+ *  implicitly by a singly diagonally implicit Runge-Kutta method with explicit first stage,
+ *
+ *    u_i = u_n + dt * sum_{j<i} (a^E_ij * k^E_j + a^I_ij * k^I_j) + dt * gamma * k^I_i ,
+ *    k^E_i = F_E(u_i, t_n + c_i * dt) ,  k^I_i = F_I(u_i, t_n + c_i * dt) ,
+ *    u_{n+1} = u_n + dt * sum_i b_i * (k^E_i + k^I_i) .
+ *
+ *  We use the schemes ARK3(2)4L[2]SA (order 3, 4 stages) and ARK4(3)6L[2]SA (order 4, 6 stages)
+ *  of
+ *
+ *    Kennedy, Carpenter, Additive Runge-Kutta schemes for convection-diffusion-reaction
+ *    equations, Applied Numerical Mathematics 44 (2003), pp. 139-181,
+ *
+ *  which are L-stable and stiffly accurate in the implicit part and provide embedded schemes of
+ *  order 2 and 3, respectively. The implicit stages are solved for u_i in the form
+ *
+ *    u_i - dt * gamma * F_I(u_i, t_n + c_i * dt) = r_i ,
+ *
+ *  where r_i denotes the explicitly known part of u_i, and k^I_i = (u_i - r_i) / (dt * gamma) is
+ *  obtained without an additional evaluation of F_I.
+ *
+ *  The operator has to provide the functions
+ *
+ *    evaluate_explicit_part(dst, src, time) ,
+ *    evaluate_implicit_part(dst, src, time) ,
+ *    solve_implicit_part(dst, rhs, time, scaling_factor) ,
+ *
+ *  where the latter solves dst - scaling_factor * F_I(dst, time) = rhs for dst with the initial
+ *  guess provided in dst and returns the number of nonlinear and accumulated linear iterations.
+ */
+template<typename Operator, typename VectorType>
+class IMEXRungeKutta : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  IMEXRungeKutta(std::shared_ptr<Operator> const operator_in, unsigned int const order_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      order(order_in),
+      iterations(0, 0)
+  {
+    initialize_coeffs();
+
+    k_E.resize(stages);
+    k_I.resize(stages);
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      this->underlying_operator->initialize_dof_vector(k_E[i]);
+      this->underlying_operator->initialize_dof_vector(k_I[i]);
+    }
+    this->underlying_operator->initialize_dof_vector(vec_rhs);
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    do_solve_timestep(vec_np, vec_n, nullptr, time, time_step);
+  }
+
+  void
+  solve_timestep_with_error_estimate(VectorType & vec_np,
+                                     VectorType & vec_n,
+                                     VectorType & error,
+                                     double const time,
+                                     double const time_step) final
+  {
+    do_solve_timestep(vec_np, vec_n, &error, time, time_step);
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+  bool
+  has_embedded_scheme() const final
+  {
+    return true;
+  }
+
+  unsigned int
+  get_order_embedded_scheme() const final
+  {
+    return order - 1;
+  }
+
+  /*
+   * Returns the number of nonlinear iterations and accumulated linear iterations of all implicit
+   * stages of the last time step.
+   */
+  std::tuple<unsigned int, unsigned int>
+  get_iterations() const
+  {
+    return iterations;
+  }
+
+private:
+  void
+  do_solve_timestep(VectorType &       vec_np,
+                    VectorType const & vec_n,
+                    VectorType *       error,
+                    double const       time,
+                    double const       time_step)
+  {
+    unsigned int n_iter_nonlinear = 0, n_iter_linear = 0;
+
+    double const scaling_factor = time_step * A_I[1][1];
+
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      double const stage_time = time + c[i] * time_step;
+
+      if(i == 0)
+      {
+        // the first stage is explicit, u_1 = u_n
+        this->underlying_operator->evaluate_implicit_part(k_I[0], vec_n, stage_time);
+        this->underlying_operator->evaluate_explicit_part(k_E[0], vec_n, stage_time);
+        continue;
+      }
+
+      // explicitly known part r_i of the stage solution
+      vec_rhs = vec_n;
+      for(unsigned int j = 0; j < i; ++j)
+        vec_rhs.add(time_step * A_E[i][j], k_E[j], time_step * A_I[i][j], k_I[j]);
+
+      // initial guess u_i = r_i + dt * gamma * k^I_{i-1}, stored in vec_np
+      vec_np = vec_rhs;
+      vec_np.add(scaling_factor, k_I[i - 1]);
+
+      auto const iter =
+        this->underlying_operator->solve_implicit_part(vec_np, vec_rhs, stage_time, scaling_factor);
+      n_iter_nonlinear += std::get<0>(iter);
+      n_iter_linear += std::get<1>(iter);
+
+      // k^I_i = (u_i - r_i) / (dt * gamma)
+      k_I[i].equ(1.0 / scaling_factor, vec_np);
+      k_I[i].add(-1.0 / scaling_factor, vec_rhs);
+
+      this->underlying_operator->evaluate_explicit_part(k_E[i], vec_np, stage_time);
+    }
+
+    // update solution (the explicit and implicit parts share the weights b)
+    vec_np = vec_n;
+    for(unsigned int i = 0; i < stages; ++i)
+      vec_np.add(time_step * b[i], k_E[i], time_step * b[i], k_I[i]);
+
+    if(error != nullptr)
+    {
+      *error = 0.0;
+      for(unsigned int i = 0; i < stages; ++i)
+      {
+        double const factor = time_step * (b[i] - b_hat[i]);
+        error->add(factor, k_E[i], factor, k_I[i]);
+      }
+    }
+
+    iterations = std::make_tuple(n_iter_nonlinear, n_iter_linear);
+  }
+
+  void
+  initialize_coeffs()
+  {
+    if(order == 3)
+    {
+      // ARK3(2)4L[2]SA
+      stages = 4;
+      A_E.reinit(stages, stages);
+      A_I.reinit(stages, stages);
+
+      double const gamma = 1767732205903. / 4055673282236.;
+
+      A_E[1][0] = 1767732205903. / 2027836641118.;
+      A_E[2][0] = 5535828885825. / 10492691773637.;
+      A_E[2][1] = 788022342437. / 10882634858940.;
+      A_E[3][0] = 6485989280629. / 16251701735622.;
+      A_E[3][1] = -4246266847089. / 9704473918619.;
+      A_E[3][2] = 10755448449292. / 10357097424841.;
+
+      A_I[1][0] = gamma;
+      A_I[1][1] = gamma;
+      A_I[2][0] = 2746238789719. / 10658868560708.;
+      A_I[2][1] = -640167445237. / 6845629431997.;
+      A_I[2][2] = gamma;
+      A_I[3][0] = 1471266399579. / 7840856788654.;
+      A_I[3][1] = -4482444167858. / 7529755066697.;
+      A_I[3][2] = 11266239266428. / 11593286722821.;
+      A_I[3][3] = gamma;
+
+      b_hat = {2756255671327. / 12835298489170.,
+               -10771552573575. / 22201958757719.,
+               9247589265047. / 10645013368117.,
+               2193209047091. / 5459859503100.};
+    }
+    else if(order == 4)
+    {
+      // ARK4(3)6L[2]SA
+      stages = 6;
+      A_E.reinit(stages, stages);
+      A_I.reinit(stages, stages);
+
+      double const gamma = 1. / 4.;
+
+      A_E[1][0] = 1. / 2.;
+      A_E[2][0] = 13861. / 62500.;
+      A_E[2][1] = 6889. / 62500.;
+      A_E[3][0] = -116923316275. / 2393684061468.;
+      A_E[3][1] = -2731218467317. / 15368042101831.;
+      A_E[3][2] = 9408046702089. / 11113171139209.;
+      A_E[4][0] = -451086348788. / 2902428689909.;
+      A_E[4][1] = -2682348792572. / 7519795681897.;
+      A_E[4][2] = 12662868775082. / 11960479115383.;
+      A_E[4][3] = 3355817975965. / 11060851509271.;
+      A_E[5][0] = 647845179188. / 3216320057751.;
+      A_E[5][1] = 73281519250. / 8382639484533.;
+      A_E[5][2] = 552539513391. / 3454668386233.;
+      A_E[5][3] = 3354512671639. / 8306763924573.;
+      A_E[5][4] = 4040. / 17871.;
+
+      A_I[1][0] = gamma;
+      A_I[1][1] = gamma;
+      A_I[2][0] = 8611. / 62500.;
+      A_I[2][1] = -1743. / 31250.;
+      A_I[2][2] = gamma;
+      A_I[3][0] = 5012029. / 34652500.;
+      A_I[3][1] = -654441. / 2922500.;
+      A_I[3][2] = 174375. / 388108.;
+      A_I[3][3] = gamma;
+      A_I[4][0] = 15267082809. / 155376265600.;
+      A_I[4][1] = -71443401. / 120774400.;
+      A_I[4][2] = 730878875. / 902184768.;
+      A_I[4][3] = 2285395. / 8070912.;
+      A_I[4][4] = gamma;
+      A_I[5][0] = 82889. / 524892.;
+      A_I[5][1] = 0.;
+      A_I[5][2] = 15625. / 83664.;
+      A_I[5][3] = 69875. / 102672.;
+      A_I[5][4] = -2260. / 8211.;
+      A_I[5][5] = gamma;
+
+      b_hat = {4586570599. / 29645900160.,
+               0.,
+               178811875. / 945068544.,
+               814220225. / 1159782912.,
+               -3700637. / 11593932.,
+               61727. / 225920.};
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("IMEX Runge-Kutta scheme not implemented."));
+    }
+
+    // the schemes are stiffly accurate, i.e., the weights b are given by the last row of A_I
+    b.resize(stages);
+    c.resize(stages);
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      b[i] = A_I[stages - 1][i];
+      c[i] = 0.;
+      for(unsigned int j = 0; j <= i; ++j)
+        c[i] += A_I[i][j];
+    }
+  }
+
+  unsigned int const order;
+  unsigned int       stages;
+
+  dealii::FullMatrix<double> A_E, A_I;
+  std::vector<double>        b, b_hat, c;
+
+  std::vector<VectorType> k_E, k_I;
+  VectorType              vec_rhs;
+
+  std::tuple<unsigned int, unsigned int> iterations;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_ */
@@ -0,0 +1,145 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/*
+ *  Second-order multirate Runge-Kutta method for a right-hand side that is split into step size
+ *  classes c = 0, ..., L-1,
+ *
+ *    R(u) = sum_c R^{(c)}(u) ,
+ *
+ *  where class c is advanced with the step size 2^{c-L+1} * time_step, i.e., the coarsest class
+ *  L-1 takes the full (macro) time step and each finer class takes twice as many steps as the next
+ *  coarser class. The scheme is defined recursively: class c performs one step of the explicit
+ *  midpoint rule of size H, where the finer classes are integrated by two recursive sub-steps
+ *  of size H/2 with the slow tendency g of the coarser classes frozen (linear interpolation of
+ *  the coarser stages in time),
+ *
+ *    step(c, u, t, H, g):
+ *      s_1 = g + R^{(c)}(u(t))
+ *      step(c-1, u, t, H/2, s_1)
+ *      s_2 = g + R^{(c)}(u(t+H/2))
+ *      step(c-1, u, t+H/2, H/2, 2 s_2 - s_1)
+ *
+ *    step(-1, u, t, H, g): u = u + H g ,
+ *
+ *  which is second-order accurate. The coupling of the classes via a constant slow tendency follows
+ *  the idea of multirate infinitesimal methods, see
+ *
+ *    Sandu, A Class of Multirate Infinitesimal GARK Methods, SIAM J. Numer. Anal. 57 (2019).
+ *
+ *  For L = 1 the scheme reduces to the explicit midpoint rule. Each class is evaluated exactly
+ *  twice per own step so that the costs of a class scale with its own step size. If the operator
+ *  splits R such that the flux over a face between different classes is added to both adjacent
+ *  cells within the same R^{(c)}, the scheme is conservative.
+ *
+ *  The operator has to provide a function
+ *
+ *    evaluate_step_size_classes(dst, src, time, first_class, last_class)
+ *
+ *  that computes dst = sum_{c = first_class}^{last_class} R^{(c)}(src) including the inverse mass
+ *  operator.
+ */
+template<typename Operator, typename VectorType>
+class MultirateRK2 : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  MultirateRK2(std::shared_ptr<Operator> const operator_in,
+               unsigned int const              n_step_size_classes_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      n_step_size_classes(n_step_size_classes_in)
+  {
+    AssertThrow(n_step_size_classes >= 1,
+                dealii::ExcMessage("At least one step size class has to be specified."));
+
+    // two stage vectors per step size class
+    s1.resize(n_step_size_classes);
+    s2.resize(n_step_size_classes);
+    for(unsigned int c = 0; c < n_step_size_classes; ++c)
+    {
+      this->underlying_operator->initialize_dof_vector(s1[c]);
+      this->underlying_operator->initialize_dof_vector(s2[c]);
+    }
+  }
+
+  void
+  solve_timestep(VectorType & dst,
+                 VectorType & src,
+                 double const time,
+                 double const time_step) final
+  {
+    dst = src;
+
+    // the coarsest class is not driven by a slow tendency
+    step(n_step_size_classes - 1, dst, nullptr, time, time_step);
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return 2;
+  }
+
+private:
+  /*
+   * Advances the solution u of the classes 0, ..., c by one step of size H of class c, where the
+   * tendency g of the coarser classes is kept constant (g == nullptr means g = 0).
+   */
+  void
+  step(int const c, VectorType & u, VectorType const * g, double const time, double const H)
+  {
+    if(c < 0)
+    {
+      u.add(H, *g);
+      return;
+    }
+
+    // first stage
+    this->underlying_operator->evaluate_step_size_classes(s1[c], u, time, c, c);
+    if(g != nullptr)
+      s1[c] += *g;
+
+    step(c - 1, u, &s1[c], time, 0.5 * H);
+
+    // second stage: s_2 = 2 (g + R^{(c)}) - s_1
+    this->underlying_operator->evaluate_step_size_classes(s2[c], u, time + 0.5 * H, c, c);
+    if(g != nullptr)
+      s2[c] += *g;
+    s2[c].sadd(2.0, -1.0, s1[c]);
+
+    step(c - 1, u, &s2[c], time + 0.5 * H, 0.5 * H);
+  }
+
+  unsigned int const n_step_size_classes;
+
+  std::vector<VectorType> s1, s2;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_ */
@@ -0,0 +1,370 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_
+
+// C/C++
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <tuple>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+/*
+ * Parameters of the Parareal algorithm, which are read from the input file since the MPI
+ * communicator has to be split into time slabs before the application is created.
+ */
+struct PararealParameters
+{
+  PararealParameters()
+  {
+  }
+
+  PararealParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    // clang-format off
+    prm.enter_subsection("Parareal");
+      prm.add_parameter("NumberOfTimeSlabs",
+                        n_time_slabs,
+                        "Number of time slabs (Parareal is used if larger than 1).",
+                        dealii::Patterns::Integer(1),
+                        false);
+      prm.add_parameter("CoarseningFactorTime",
+                        coarsening_factor_time,
+                        "Ratio of the time step sizes of the coarse and the fine propagator.",
+                        dealii::Patterns::Double(1.0),
+                        false);
+      prm.add_parameter("MaxIterations",
+                        max_iterations,
+                        "Maximum number of Parareal iterations.",
+                        dealii::Patterns::Integer(1),
+                        false);
+      prm.add_parameter("Tolerance",
+                        tolerance,
+                        "Tolerance for relative increment of solution at end of time slabs.",
+                        dealii::Patterns::Double(0.0),
+                        false);
+    prm.leave_subsection();
+    // clang-format on
+  }
+
+  unsigned int n_time_slabs = 1;
+
+  double coarsening_factor_time = 10.0;
+
+  unsigned int max_iterations = 10;
+
+  double tolerance = 1.e-8;
+};
+
+/*
+ * Splits the MPI communicator into n_time_slabs groups of subsequent ranks. Each group solves one
+ * time slab (comm_space), and the processes with the same rank in the different groups are
+ * connected by a second communicator (comm_time), the rank of which is the index of the time slab.
+ * Both communicators have to be freed by the caller.
+ */
+inline std::tuple<MPI_Comm, MPI_Comm>
+split_communicator_time_slabs(MPI_Comm const & mpi_comm, unsigned int const n_time_slabs)
+{
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const size = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  AssertThrow(n_time_slabs >= 1 and size % n_time_slabs == 0,
+              dealii::ExcMessage(
+                "The number of MPI processes has to be a multiple of the number of time slabs."));
+
+  unsigned int const size_space = size / n_time_slabs;
+
+  MPI_Comm comm_space, comm_time;
+  MPI_Comm_split(mpi_comm, rank / size_space, rank, &comm_space);
+  MPI_Comm_split(mpi_comm, rank % size_space, rank, &comm_time);
+
+  return {comm_space, comm_time};
+}
+
+/*
+ * Parareal algorithm for the time interval [T_0, T_N] decomposed into N time slabs
+ * [T_n, T_{n+1}], where each group of processes solves one time slab. Given a fine propagator F
+ * (accurate but expensive) and a coarse propagator G (cheap but inaccurate) mapping a solution at
+ * T_n to T_{n+1}, the solution at the start of the time slabs is iterated according to
+ *
+ *   U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k) ,
+ *
+ * where the fine propagator is applied on all time slabs in parallel and the coarse propagator
+ * sequentially from one time slab to the next. After k iterations, the solution at the start of the
+ * first k+1 time slabs coincides with the result of the fine propagator applied sequentially, so
+ * that at most N-1 iterations are performed.
+ *
+ * Once the solution at the start of a time slab is final, the fine propagator is applied a last
+ * time on this time slab (e.g. including postprocessing) and its result is reused in the remaining
+ * iterations. After the iterations, this is done on the time slabs that have not reached this
+ * state yet, i.e., if the iteration has converged before N-1 iterations and on the last time slab.
+ *
+ * The solution vectors are exchanged between the processes with the same rank in comm_time, which
+ * requires the same partitioning of the solution vectors on all time slabs.
+ */
+template<typename Number>
+class Parareal
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  // computes dst = P(src) from the start to the end of the time slab
+  typedef std::function<void(VectorType & dst, VectorType const & src)> Propagator;
+
+  Parareal(PararealParameters const & parameters_in,
+           MPI_Comm const &           comm_space,
+           MPI_Comm const &           comm_time_in)
+    : parameters(parameters_in),
+      comm_time(comm_time_in),
+      slab(dealii::Utilities::MPI::this_mpi_process(comm_time_in)),
+      n_slabs(dealii::Utilities::MPI::n_mpi_processes(comm_time_in)),
+      pcout(std::cout,
+            dealii::Utilities::MPI::this_mpi_process(comm_space) == 0 and slab == 0),
+      n_iterations(0),
+      send_request(MPI_REQUEST_NULL),
+      timer_tree(new TimerTree())
+  {
+  }
+
+  /*
+   * On input, solution_start contains the initial solution at T_0 on the first time slab (and is
+   * ignored on the other time slabs). On output, solution_start and solution_end contain the
+   * solution at the start and the end of the time slab of the current process, where
+   * fine_propagator_final has been applied exactly once on each time slab to compute the latter.
+   */
+  void
+  solve(VectorType &       solution_start,
+        VectorType &       solution_end,
+        Propagator const & coarse_propagator,
+        Propagator const & fine_propagator,
+        Propagator const & fine_propagator_final)
+  {
+    unsigned int const local_size = solution_start.get_partitioner()->locally_owned_size();
+    AssertThrow(dealii::Utilities::MPI::min(local_size, comm_time) ==
+                  dealii::Utilities::MPI::max(local_size, comm_time),
+                dealii::ExcMessage("Parareal requires the same partitioning of the solution "
+                                   "vectors on all time slabs."));
+
+    VectorType coarse_solution(solution_start), coarse_solution_new(solution_start),
+      fine_solution(solution_start), increment(solution_start);
+
+    send_buffer.reinit(solution_start, true);
+
+    // initial guess by a sequential sweep of the coarse propagator
+    pcout << std::endl << "Parareal: initial sweep of coarse propagator ..." << std::endl;
+
+    receive_from_previous_slab(solution_start, 0);
+
+    apply_propagator(coarse_propagator, coarse_solution, solution_start, "Coarse propagator");
+    solution_end = coarse_solution;
+
+    send_to_next_slab(solution_end, 0);
+
+    // the solution is exact on all time slabs after n_slabs - 1 iterations
+    unsigned int const max_iterations = std::min(parameters.max_iterations, n_slabs - 1);
+
+    // The solution at the start of the time slab is final in iteration k if slab < k. This holds
+    // bitwise since the previous time slab then sends its final fine solution in every iteration.
+    bool fine_solution_is_final = false;
+
+    for(n_iterations = 1; n_iterations <= max_iterations; ++n_iterations)
+    {
+      // fine propagator on all time slabs in parallel
+      if(not fine_solution_is_final)
+      {
+        if(slab < n_iterations)
+        {
+          apply_propagator(fine_propagator_final, fine_solution, solution_start, "Fine propagator");
+          fine_solution_is_final = true;
+        }
+        else
+        {
+          apply_propagator(fine_propagator, fine_solution, solution_start, "Fine propagator");
+        }
+      }
+
+      // sequential correction sweep of the coarse propagator
+      receive_from_previous_slab(solution_start, n_iterations);
+
+      increment = solution_end;
+
+      if(fine_solution_is_final)
+      {
+        // the correction of the coarse propagator vanishes
+        solution_end = fine_solution;
+      }
+      else
+      {
+        apply_propagator(coarse_propagator,
+                         coarse_solution_new,
+                         solution_start,
+                         "Coarse propagator");
+
+        solution_end = coarse_solution_new;
+        solution_end += fine_solution;
+        solution_end -= coarse_solution;
+
+        coarse_solution.swap(coarse_solution_new);
+      }
+
+      send_to_next_slab(solution_end, n_iterations);
+
+      // convergence check
+      increment -= solution_end;
+
+      double const norm = solution_end.l2_norm();
+      double const relative_increment =
+        dealii::Utilities::MPI::max(increment.l2_norm() / (norm > 0.0 ? norm : 1.0), comm_time);
+
+      pcout << "Parareal iteration " << std::setw(3) << n_iterations
+            << ": relative increment = " << std::scientific << std::setprecision(4)
+            << relative_increment << std::endl;
+
+      if(relative_increment < parameters.tolerance)
+        break;
+    }
+
+    n_iterations = std::min(n_iterations, max_iterations);
+
+    // the time slabs without final fine solution start from the converged or exact solution
+    if(not fine_solution_is_final)
+      apply_propagator(fine_propagator_final, solution_end, solution_start, "Fine propagator");
+
+    MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+  }
+
+  unsigned int
+  get_number_of_iterations() const
+  {
+    return n_iterations;
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const
+  {
+    return timer_tree;
+  }
+
+private:
+  void
+  apply_propagator(Propagator const &  propagator,
+                   VectorType &        dst,
+                   VectorType const &  src,
+                   std::string const & name) const
+  {
+    dealii::Timer timer;
+    timer.restart();
+
+    propagator(dst, src);
+
+    timer_tree->insert({"Parareal", name}, timer.wall_time());
+  }
+
+  /*
+   * The send operation is non-blocking so that the next fine propagation is not delayed by the
+   * next time slab. The data is copied into a buffer, which is reused once the previous send
+   * operation has completed.
+   */
+  void
+  send_to_next_slab(VectorType const & vector, unsigned int const tag)
+  {
+    if(slab + 1 < n_slabs)
+    {
+      dealii::Timer timer;
+      timer.restart();
+
+      MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+
+      send_buffer = vector;
+
+      MPI_Isend(send_buffer.begin(),
+                send_buffer.get_partitioner()->locally_owned_size(),
+                dealii::Utilities::MPI::mpi_type_id_for_type<Number>,
+                slab + 1,
+                tag,
+                comm_time,
+                &send_request);
+
+      timer_tree->insert({"Parareal", "Communication"}, timer.wall_time());
+    }
+  }
+
+  void
+  receive_from_previous_slab(VectorType & vector, unsigned int const tag) const
+  {
+    if(slab > 0)
+    {
+      dealii::Timer timer;
+      timer.restart();
+
+      MPI_Recv(vector.begin(),
+               vector.get_partitioner()->locally_owned_size(),
+               dealii::Utilities::MPI::mpi_type_id_for_type<Number>,
+               slab - 1,
+               tag,
+               comm_time,
+               MPI_STATUS_IGNORE);
+
+      timer_tree->insert({"Parareal", "Communication"}, timer.wall_time());
+    }
+  }
+
+  PararealParameters const parameters;
+
+  MPI_Comm const comm_time;
+
+  // index of the time slab of the current process and number of time slabs
+  unsigned int const slab, n_slabs;
+
+  dealii::ConditionalOStream pcout;
+
+  unsigned int n_iterations;
+
+  VectorType  send_buffer;
+  MPI_Request send_request;
+
+  std::shared_ptr<TimerTree> timer_tree;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_ */
@@ -23,23 +23,31 @@
 #define INCLUDE_EXADG_TIME_INTEGRATION_RESTART_H_
 
 // C/C++
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <sstream>
 
 // deal.II
 #include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
 
 namespace ExaDG
 {
+/*
+ * Name of a restart file shared by all processes.
+ */
 inline std::string
-restart_filename(std::string const & name, MPI_Comm const & mpi_comm)
+restart_filename(std::string const & name)
 {
-  std::string const rank =
-    dealii::Utilities::int_to_string(dealii::Utilities::MPI::this_mpi_process(mpi_comm));
-
-  std::string const filename = name + "." + rank + ".restart";
-
-  return filename;
+  return name + ".restart";
 }
 
 inline void
@@ -58,14 +66,401 @@ rename_restart_files(std::string const & filename)
   }
 }
 
-inline void
-write_restart_file(std::ostringstream & oss, std::string const & filename)
+/*
+ * Returns the locally owned cells in the order of the space-filling curve of the forest of
+ * octrees. This order does not depend on the partitioning of the triangulation, and each process
+ * owns a contiguous range of cells in this order.
+ */
+template<int dim>
+std::vector<typename dealii::DoFHandler<dim>::cell_iterator>
+get_locally_owned_cells_space_filling_curve(dealii::DoFHandler<dim> const & dof_handler)
 {
-  std::ofstream stream(filename.c_str());
+  dealii::Triangulation<dim> const & triangulation = dof_handler.get_triangulation();
+
+  std::vector<dealii::types::global_dof_index> tree_to_coarse_cell(triangulation.n_cells(0));
+  std::iota(tree_to_coarse_cell.begin(), tree_to_coarse_cell.end(), 0);
+
+  if(auto tria =
+       dynamic_cast<dealii::parallel::distributed::Triangulation<dim> const *>(&triangulation))
+  {
+    tree_to_coarse_cell = tria->get_p4est_tree_to_coarse_cell_permutation();
+  }
+  else
+  {
+    AssertThrow(dealii::Utilities::MPI::n_mpi_processes(dof_handler.get_communicator()) == 1,
+                dealii::ExcMessage("Restart files shared by all processes require a "
+                                   "parallel::distributed::Triangulation."));
+  }
+
+  std::vector<typename dealii::DoFHandler<dim>::cell_iterator> cells;
+
+  std::function<void(typename dealii::DoFHandler<dim>::cell_iterator const &)> add_cells =
+    [&](typename dealii::DoFHandler<dim>::cell_iterator const & cell) {
+      if(cell->has_children())
+      {
+        for(unsigned int c = 0; c < cell->n_children(); ++c)
+          add_cells(cell->child(c));
+      }
+      else if(cell->is_locally_owned())
+      {
+        cells.push_back(cell);
+      }
+    };
 
-  stream << oss.str() << std::endl;
+  for(auto const coarse_cell : tree_to_coarse_cell)
+    add_cells(typename dealii::DoFHandler<dim>::cell_iterator(&triangulation,
+                                                              0,
+                                                              coarse_cell,
+                                                              &dof_handler));
+
+  return cells;
 }
 
+/*
+ * Restart file written and read collectively by all processes with MPI-IO. The file starts with
+ * a preamble containing serialized scalar data, followed by one block per vector. A block stores
+ * the cell-wise degrees of freedom of all cells in the order of the space-filling curve, see
+ * get_locally_owned_cells_space_filling_curve(). Hence, the file does not depend on the number
+ * of processes it has been written with, and each process accesses a contiguous range of a block.
+ * The values of a block are stored in double precision or, optionally, in single precision.
+ *
+ * In asynchronous mode, the data is copied into buffers and written with non-blocking MPI-IO
+ * operations, so that the computation can continue while the data is written. The write
+ * operations are completed by wait() or close(). The buffers are kept when the object is re-opened
+ * for the next restart file, i.e., they are only allocated once.
+ */
+class CollectiveRestartFile
+{
+public:
+  /*
+   * Constructor without opening a file, see open().
+   */
+  CollectiveRestartFile(MPI_Comm const & mpi_comm_in)
+    : mpi_comm(mpi_comm_in), is_open(false), asynchronous(false), offset(0), n_buffers_used(0)
+  {
+  }
+
+  CollectiveRestartFile(std::string const & filename,
+                        MPI_Comm const &    mpi_comm_in,
+                        bool const          write)
+    : CollectiveRestartFile(mpi_comm_in)
+  {
+    open(filename, write);
+  }
+
+  /*
+   * Closing the file is a collective operation, which is therefore not done in the destructor
+   * (that might not be called on all processes at the same time). The file has to be closed
+   * explicitly by close().
+   */
+  ~CollectiveRestartFile()
+  {
+    Assert(not is_open or std::uncaught_exceptions() > 0,
+           dealii::ExcMessage("The restart file has to be closed explicitly by close()."));
+  }
+
+  void
+  open(std::string const & filename, bool const write, bool const asynchronous_in = false)
+  {
+    AssertThrow(not is_open, dealii::ExcMessage("The restart file has already been opened."));
+
+    int const ierr = MPI_File_open(mpi_comm,
+                                   filename.c_str(),
+                                   write ? (MPI_MODE_CREATE | MPI_MODE_WRONLY) : MPI_MODE_RDONLY,
+                                   MPI_INFO_NULL,
+                                   &file);
+    AssertThrow(ierr == MPI_SUCCESS, dealii::ExcMessage("Can not open file " + filename + "."));
+
+    if(write)
+    {
+      int const ierr_size = MPI_File_set_size(file, 0);
+      AssertThrowMPI(ierr_size);
+    }
+
+    is_open      = true;
+    asynchronous = asynchronous_in;
+    offset       = 0;
+  }
+
+  /*
+   * Completes all pending write operations and closes the file. Nothing is done if no file is
+   * open.
+   */
+  void
+  close()
+  {
+    if(is_open)
+    {
+      wait();
+      int const ierr = MPI_File_close(&file);
+      AssertThrowMPI(ierr);
+      is_open = false;
+    }
+  }
+
+  /*
+   * Completes all pending write operations, after which the buffers can be reused.
+   */
+  void
+  wait()
+  {
+    int const ierr = MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+
+    requests.clear();
+    n_buffers_used = 0;
+  }
+
+  /*
+   * Writes the preamble, which only has to be provided on rank 0.
+   */
+  void
+  write_preamble(std::string const & preamble)
+  {
+    std::uint64_t size = preamble.size();
+    size               = dealii::Utilities::MPI::broadcast(mpi_comm, size, 0);
+
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      char * buffer = get_buffer(sizeof(size) + size);
+      std::memcpy(buffer, &size, sizeof(size));
+      std::memcpy(buffer + sizeof(size), preamble.data(), size);
+
+      write_at(offset, buffer, sizeof(size) + size, false /* collective */);
+    }
+
+    advance(sizeof(size) + size);
+  }
+
+  std::string
+  read_preamble()
+  {
+    std::uint64_t size = 0;
+    int ierr = MPI_File_read_at_all(file, offset, &size, sizeof(size), MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+
+    std::string preamble(size, '\0');
+    ierr = MPI_File_read_at_all(
+      file, offset + sizeof(size), &preamble[0], size, MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+
+    advance(sizeof(size) + size);
+
+    return preamble;
+  }
+
+  template<int dim, typename Number>
+  void
+  write_vector(dealii::LinearAlgebra::distributed::Vector<Number> const & vector,
+               dealii::DoFHandler<dim> const &                            dof_handler,
+               bool const                                                 single_precision = false)
+  {
+    if(single_precision)
+      write_vector_as<float>(vector, dof_handler);
+    else
+      write_vector_as<double>(vector, dof_handler);
+  }
+
+  template<int dim, typename Number>
+  void
+  read_vector(dealii::LinearAlgebra::distributed::Vector<Number> & vector,
+              dealii::DoFHandler<dim> const &                      dof_handler)
+  {
+    std::uint64_t header[3] = {0, 0, 0};
+    int const ierr =
+      MPI_File_read_at_all(file, offset, header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+
+    if(header[2] == sizeof(float))
+      read_vector_as<float>(vector, dof_handler, header);
+    else if(header[2] == sizeof(double))
+      read_vector_as<double>(vector, dof_handler, header);
+    else
+      AssertThrow(false, dealii::ExcMessage("Invalid value type in file."));
+  }
+
+  /*
+   * Returns the number of bytes written to or read from the file so far.
+   */
+  std::uint64_t
+  get_n_bytes() const
+  {
+    return offset;
+  }
+
+private:
+  template<typename StorageType, int dim, typename Number>
+  void
+  write_vector_as(dealii::LinearAlgebra::distributed::Vector<Number> const & vector,
+                  dealii::DoFHandler<dim> const &                            dof_handler)
+  {
+    dealii::LinearAlgebra::distributed::Vector<Number> vector_ghosted;
+    dealii::IndexSet                                   locally_relevant_dofs;
+    dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+    vector_ghosted.reinit(dof_handler.locally_owned_dofs(), locally_relevant_dofs, mpi_comm);
+    vector_ghosted.copy_locally_owned_data_from(vector);
+    vector_ghosted.update_ghost_values();
+
+    auto const cells = get_locally_owned_cells_space_filling_curve(dof_handler);
+
+    unsigned int const dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+    std::uint64_t const n_values = cells.size() * dofs_per_cell;
+
+    // the buffer is aligned for any fundamental type
+    StorageType * values =
+      reinterpret_cast<StorageType *>(get_buffer(n_values * sizeof(StorageType)));
+
+    std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+    for(unsigned int c = 0; c < cells.size(); ++c)
+    {
+      typename dealii::DoFHandler<dim>::active_cell_iterator const cell(cells[c]);
+      cell->get_dof_indices(dof_indices);
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        values[c * dofs_per_cell + i] = static_cast<StorageType>(vector_ghosted(dof_indices[i]));
+    }
+
+    std::uint64_t const header[3] = {dof_handler.get_triangulation().n_global_active_cells(),
+                                     dofs_per_cell,
+                                     sizeof(StorageType)};
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      char * buffer = get_buffer(sizeof(header));
+      std::memcpy(buffer, header, sizeof(header));
+
+      write_at(offset, buffer, sizeof(header), false /* collective */);
+    }
+
+    std::uint64_t const first_cell = get_first_cell(cells.size());
+    write_at(offset + sizeof(header) + first_cell * dofs_per_cell * sizeof(StorageType),
+             reinterpret_cast<char const *>(values),
+             n_values * sizeof(StorageType),
+             true /* collective */);
+
+    advance(sizeof(header) + header[0] * dofs_per_cell * sizeof(StorageType));
+  }
+
+  template<typename StorageType, int dim, typename Number>
+  void
+  read_vector_as(dealii::LinearAlgebra::distributed::Vector<Number> & vector,
+                 dealii::DoFHandler<dim> const &                      dof_handler,
+                 std::uint64_t const (&header)[3])
+  {
+    auto const cells = get_locally_owned_cells_space_filling_curve(dof_handler);
+
+    unsigned int const dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+    AssertThrow(header[0] == dof_handler.get_triangulation().n_global_active_cells() and
+                  header[1] == dofs_per_cell,
+                dealii::ExcMessage("The restart file does not match the current triangulation "
+                                   "or finite element."));
+
+    std::vector<StorageType> values(cells.size() * dofs_per_cell);
+
+    AssertThrow(values.size() * sizeof(StorageType) < std::numeric_limits<int>::max(),
+                dealii::ExcMessage("Local part of restart data exceeds 2 GB."));
+
+    std::uint64_t const first_cell = get_first_cell(cells.size());
+    MPI_Offset const position =
+      offset + sizeof(header) + first_cell * dofs_per_cell * sizeof(StorageType);
+    int const ierr = MPI_File_read_at_all(file,
+                                          position,
+                                          values.data(),
+                                          values.size() * sizeof(StorageType),
+                                          MPI_BYTE,
+                                          MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+
+    std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+    for(unsigned int c = 0; c < cells.size(); ++c)
+    {
+      typename dealii::DoFHandler<dim>::active_cell_iterator const cell(cells[c]);
+      cell->get_dof_indices(dof_indices);
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        if(vector.get_partitioner()->in_local_range(dof_indices[i]))
+          vector(dof_indices[i]) = values[c * dofs_per_cell + i];
+    }
+
+    advance(sizeof(header) + header[0] * dofs_per_cell * sizeof(StorageType));
+  }
+
+  std::uint64_t
+  get_first_cell(std::uint64_t const n_local_cells) const
+  {
+    std::uint64_t first_cell = 0;
+    int const     ierr =
+      MPI_Exscan(&n_local_cells, &first_cell, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+    AssertThrowMPI(ierr);
+
+    // the result of MPI_Exscan is undefined on rank 0
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      first_cell = 0;
+
+    return first_cell;
+  }
+
+  void
+  advance(std::uint64_t const size)
+  {
+    offset += size;
+  }
+
+  /*
+   * Returns a buffer that stays valid until the write operations have been completed.
+   */
+  char *
+  get_buffer(std::uint64_t const n_bytes)
+  {
+    if(n_buffers_used == buffers.size())
+      buffers.emplace_back();
+
+    buffers[n_buffers_used].resize(n_bytes);
+
+    return buffers[n_buffers_used++].data();
+  }
+
+  void
+  write_at(MPI_Offset const    position,
+           char const *        data,
+           std::uint64_t const n_bytes,
+           bool const          collective)
+  {
+    AssertThrow(n_bytes < std::numeric_limits<int>::max(),
+                dealii::ExcMessage("Local part of restart data exceeds 2 GB."));
+
+    int ierr = MPI_SUCCESS;
+    if(asynchronous)
+    {
+      MPI_Request request;
+      if(collective)
+        ierr = MPI_File_iwrite_at_all(file, position, data, n_bytes, MPI_BYTE, &request);
+      else
+        ierr = MPI_File_iwrite_at(file, position, data, n_bytes, MPI_BYTE, &request);
+
+      requests.push_back(request);
+    }
+    else
+    {
+      if(collective)
+        ierr = MPI_File_write_at_all(file, position, data, n_bytes, MPI_BYTE, MPI_STATUS_IGNORE);
+      else
+        ierr = MPI_File_write_at(file, position, data, n_bytes, MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+    AssertThrowMPI(ierr);
+  }
+
+  MPI_Comm const mpi_comm;
+  MPI_File       file;
+  bool           is_open;
+  bool           asynchronous;
+  MPI_Offset     offset;
+
+  // buffers and requests of pending write operations
+  std::vector<std::vector<char>> buffers;
+  unsigned int                   n_buffers_used;
+  std::vector<MPI_Request>       requests;
+};
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_TIME_INTEGRATION_RESTART_H_ */
@@ -41,6 +41,7 @@ struct RestartData
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
       filename("restart"),
+      asynchronous(false),
       counter(1)
   {
   }
@@ -57,6 +58,7 @@ struct RestartData
       print_parameter(pcout, "Interval wall time", interval_wall_time);
       print_parameter(pcout, "Interval time steps", interval_time_steps);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Asynchronous", asynchronous);
     }
   }
 
@@ -96,6 +98,11 @@ struct RestartData
   // filename for restart files
   std::string filename;
 
+  // Write restart files in the background while the time loop continues (only supported by BDF
+  // time integrators). The data is copied into buffers, and the write operations are completed
+  // before the next restart file is written.
+  bool asynchronous;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 };
@@ -254,16 +254,16 @@ protected:
 
 private:
   /*
-   * Write restart data.
+   * Write restart data. The argument is the base name of the restart file(s).
    */
   virtual void
-  do_write_restart(std::string const & filename) const = 0;
+  do_write_restart(std::string const & name) const = 0;
 
   /*
-   * Read restart data.
+   * Read restart data. The argument is the base name of the restart file(s).
    */
   virtual void
-  do_read_restart(std::ifstream & in) = 0;
+  do_read_restart(std::string const & name) = 0;
 };
 
 } // namespace ExaDG
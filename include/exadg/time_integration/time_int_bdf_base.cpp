@@ -44,7 +44,9 @@ TimeIntBDFBase<Number>::TimeIntBDFBase(double const        start_time_,
     extra(order_, start_with_low_order_),
     start_with_low_order(start_with_low_order_),
     adaptive_time_stepping(adaptive_time_stepping_),
-    time_steps(order_, -1.0)
+    time_steps(order_, -1.0),
+    time_step_oif(-1.0),
+    restart_file(mpi_comm_)
 {
 }
 
@@ -118,9 +120,19 @@ TimeIntBDFBase<Number>::timeloop_steady_problem()
 
   solve_steady_problem();
 
+  // the pseudo-time stepping might stop before the end time is reached
+  close_restart_file();
+
   postprocessing_steady_problem();
 }
 
+template<typename Number>
+void
+TimeIntBDFBase<Number>::close_restart_file() const
+{
+  restart_file.close();
+}
+
 template<typename Number>
 double
 TimeIntBDFBase<Number>::get_scaling_factor_time_derivative_term() const
@@ -149,6 +161,14 @@ TimeIntBDFBase<Number>::get_previous_time(int const i /* t_{n-i} */) const
   return t;
 }
 
+template<typename Number>
+void
+TimeIntBDFBase<Number>::print_error_control_statistics_oif() const
+{
+  if(oif_error_controller)
+    oif_error_controller->print_statistics(this->pcout, "OIF sub-stepping with error control");
+}
+
 template<typename Number>
 double
 TimeIntBDFBase<Number>::get_time_step_size() const
@@ -246,6 +266,10 @@ TimeIntBDFBase<Number>::do_timestep_post_solve()
   if(restart_data.write_restart == true)
   {
     write_restart();
+
+    // complete an asynchronous restart file at the end of the time loop
+    if(this->finished())
+      close_restart_file();
   }
 
   if(this->print_solver_info())
@@ -285,6 +309,9 @@ TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & sum
 {
   VectorType solution_tilde_mp(sum_alphai_ui), solution_tilde_m(sum_alphai_ui);
 
+  // error estimate in case of embedded error control
+  VectorType error_oif;
+
   /*
    * Loop over all previous time instants required by the BDF scheme and calculate u_tilde by
    * substepping algorithm, i.e., integrate over time interval t_{n-i} <= t <= t_{n+1} for all 0 <=
@@ -331,14 +358,55 @@ TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & sum
       // calculate sub-stepping time step size delta_s
       double const delta_s = this->get_time_step_size(k) / (double)M;
 
-      for(int m = 0; m < M; ++m)
+      if(oif_error_controller)
       {
-        do_timestep_oif_substepping(solution_tilde_mp,
-                                    solution_tilde_m,
-                                    time_n_k + delta_s * m,
-                                    delta_s);
-
-        solution_tilde_mp.swap(solution_tilde_m);
+        // adaptive sub-stepping, where the sub-step size according to cfl_oif is only used
+        // initially and the controller selects the sub-step sizes afterwards
+        if(time_step_oif <= 0.0)
+          time_step_oif = delta_s;
+
+        double const time_end = time_n_k + this->get_time_step_size(k);
+        double       time_s   = time_n_k;
+
+        while(time_s < time_end - eps)
+        {
+          // do not step over the end of the "macro" time step
+          bool const   shortened         = (time_s + time_step_oif > time_end);
+          double       time_step_s       = shortened ? (time_end - time_s) : time_step_oif;
+          double const time_step_attempt = time_step_s;
+
+          double const time_step_accepted = do_timestep_with_error_control(
+            solution_tilde_mp,
+            solution_tilde_m,
+            error_oif,
+            time_s,
+            time_step_s,
+            *oif_error_controller,
+            [&](VectorType & dst, VectorType & src, VectorType & error, double t, double dt) {
+              do_timestep_oif_substepping_with_error_estimate(dst, src, error, t, dt);
+            });
+
+          // a shortened sub-step that has been accepted directly does not affect the proposed
+          // sub-step size
+          if(not(shortened and time_step_accepted == time_step_attempt))
+            time_step_oif = time_step_s;
+
+          time_s += time_step_accepted;
+
+          solution_tilde_mp.swap(solution_tilde_m);
+        }
+      }
+      else
+      {
+        for(int m = 0; m < M; ++m)
+        {
+          do_timestep_oif_substepping(solution_tilde_mp,
+                                      solution_tilde_m,
+                                      time_n_k + delta_s * m,
+                                      delta_s);
+
+          solution_tilde_mp.swap(solution_tilde_m);
+        }
       }
     }
 
@@ -349,11 +417,27 @@ TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(VectorType & sum
 
 template<typename Number>
 void
-TimeIntBDFBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntBDFBase<Number>::do_read_restart(std::string const & name)
 {
-  boost::archive::binary_iarchive ia(in);
+  std::string const filename = restart_filename(name);
+
+  {
+    std::ifstream in(filename);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+  }
+
+  dealii::Timer timer;
+
+  CollectiveRestartFile file(filename, mpi_comm, false /* write */);
+
+  std::istringstream              iss(file.read_preamble());
+  boost::archive::binary_iarchive ia(iss);
   read_restart_preamble(ia);
-  read_restart_vectors(ia);
+  read_restart_vectors(file);
+
+  file.close();
+
+  print_restart_bandwidth(file.get_n_bytes(), timer.wall_time());
 
   // In order to change the CFL number (or the time step calculation criterion in general),
   // start_with_low_order = true has to be used. Otherwise, the old solutions would not fit the
@@ -368,64 +452,92 @@ TimeIntBDFBase<Number>::read_restart_preamble(boost::archive::binary_iarchive &
 {
   // Note that the operations done here must be in sync with the output.
 
-  // 1. ranks
-  unsigned int n_old_ranks = 1;
-  ia &         n_old_ranks;
-
-  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
-              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
-                                 " processes, "
-                                 "but restart was written on " +
-                                 dealii::Utilities::to_string(n_old_ranks) + " processes."));
-
-  // 2. time
+  // 1. time
   ia & time;
 
   // Note that start_time has to be set to the new start_time (since param.start_time might still be
   // the original start time).
   this->start_time = time;
 
-  // 3. order
+  // 2. order
   unsigned int old_order = 1;
   ia &         old_order;
 
   AssertThrow(old_order == order, dealii::ExcMessage("Order of time integrator may not change."));
 
-  // 4. time step sizes
+  // 3. time step sizes
   for(unsigned int i = 0; i < order; i++)
     ia & time_steps[i];
 }
 
 template<typename Number>
 void
-TimeIntBDFBase<Number>::do_write_restart(std::string const & filename) const
+TimeIntBDFBase<Number>::do_write_restart(std::string const & name) const
 {
+  std::string const filename = restart_filename(name);
+
+  dealii::Timer timer;
+
+  // complete the previous restart file before it is renamed and its buffers are reused
+  restart_file.close();
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    rename_restart_files(filename);
+
+  // the file must not be opened before it has been renamed
+  MPI_Barrier(mpi_comm);
+
   std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    write_restart_preamble(oa);
+  }
+
+  restart_file.open(filename, true /* write */, restart_data.asynchronous);
 
-  boost::archive::binary_oarchive oa(oss);
+  restart_file.write_preamble(oss.str());
+  write_restart_vectors(restart_file);
 
-  write_restart_preamble(oa);
-  write_restart_vectors(oa);
-  write_restart_file(oss, filename);
+  std::uint64_t const n_bytes = restart_file.get_n_bytes();
+
+  if(not restart_data.asynchronous)
+    restart_file.close();
+
+  print_restart_bandwidth(n_bytes, timer.wall_time(), restart_data.asynchronous);
 }
 
 template<typename Number>
 void
-TimeIntBDFBase<Number>::write_restart_preamble(boost::archive::binary_oarchive & oa) const
+TimeIntBDFBase<Number>::print_restart_bandwidth(std::uint64_t const n_bytes,
+                                                double const        wall_time,
+                                                bool const          asynchronous) const
 {
-  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  double const wall_time_max = dealii::Utilities::MPI::max(wall_time, mpi_comm);
 
-  // 1. ranks
-  oa & n_ranks;
+  this->pcout << std::endl;
+  print_parameter(this->pcout, "Size of restart file [MB]", n_bytes / 1.e6);
+  if(asynchronous)
+  {
+    print_parameter(this->pcout, "Wall time (asynchronous) [s]", wall_time_max);
+  }
+  else
+  {
+    print_parameter(this->pcout, "Wall time [s]", wall_time_max);
+    print_parameter(this->pcout, "Bandwidth [MB/s]", n_bytes / 1.e6 / wall_time_max);
+  }
+}
 
-  // 2. time
+template<typename Number>
+void
+TimeIntBDFBase<Number>::write_restart_preamble(boost::archive::binary_oarchive & oa) const
+{
+  // 1. time
   oa & time;
 
-  // 3. order
+  // 2. order
   oa & order;
 
-  // 4. time step sizes
+  // 3. time step sizes
   for(unsigned int i = 0; i < order; i++)
     oa & time_steps[i];
 }
@@ -470,6 +582,17 @@ TimeIntBDFBase<Number>::do_timestep_oif_substepping(VectorType &,
   AssertThrow(false, dealii::ExcMessage("This function has to be implemented by derived classes."));
 }
 
+template<typename Number>
+void
+TimeIntBDFBase<Number>::do_timestep_oif_substepping_with_error_estimate(VectorType &,
+                                                                        VectorType &,
+                                                                        VectorType &,
+                                                                        double const,
+                                                                        double const)
+{
+  AssertThrow(false, dealii::ExcMessage("This function has to be implemented by derived classes."));
+}
+
 template class TimeIntBDFBase<float>;
 template class TimeIntBDFBase<double>;
 
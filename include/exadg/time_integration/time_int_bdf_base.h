@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/time_integration/bdf_time_integration.h>
+#include <exadg/time_integration/embedded_error_control.h>
 #include <exadg/time_integration/extrapolation_scheme.h>
 #include <exadg/time_integration/time_int_base.h>
 
@@ -71,6 +72,14 @@ public:
   void
   timeloop_steady_problem();
 
+  /*
+   * Completes the write operations of an asynchronous restart file and closes it. This is a
+   * collective operation, which is called at the end of the time loop. Time integrators that are
+   * stopped before the end time is reached have to call this function explicitly.
+   */
+  void
+  close_restart_file() const;
+
   /*
    * Setters and getters.
    */
@@ -101,6 +110,13 @@ public:
   double
   get_previous_time(int const i /* t_{n-i} */) const;
 
+  /*
+   * Prints the number of accepted and rejected sub-steps in case of OIF sub-stepping with embedded
+   * error control.
+   */
+  void
+  print_error_control_statistics_oif() const;
+
 protected:
   /*
    * Do one time step including different updates before and after the actual solution of the
@@ -144,6 +160,16 @@ protected:
   virtual double
   calculate_time_step_size() = 0;
 
+  /*
+   * Restart: read/write scalar data such as the time and the time step sizes. Derived classes may
+   * append further data, which has to be done in the same order for reading and writing.
+   */
+  virtual void
+  read_restart_preamble(boost::archive::binary_iarchive & ia);
+
+  virtual void
+  write_restart_preamble(boost::archive::binary_oarchive & oa) const;
+
   /*
    * Order of time integration scheme.
    */
@@ -173,6 +199,13 @@ protected:
    */
   std::vector<double> time_steps;
 
+  /*
+   * Step size controller for OIF sub-stepping with embedded error control (to be created by
+   * derived classes in initialize_oif()) and the sub-step size proposed by the controller.
+   */
+  std::shared_ptr<PIController> oif_error_controller;
+  double                        time_step_oif;
+
 private:
   /*
    * Allocate solution vectors (has to be implemented by derived classes).
@@ -231,29 +264,33 @@ private:
   postprocessing_steady_problem() const;
 
   /*
-   * Restart: read solution vectors (has to be implemented in derived classes).
+   * Restart: read solution vectors (has to be implemented in derived classes). The restart file is
+   * shared by all processes and can be read with an arbitrary number of processes.
    */
   void
-  do_read_restart(std::ifstream & in) final;
-
-  void
-  read_restart_preamble(boost::archive::binary_iarchive & ia);
+  do_read_restart(std::string const & name) final;
 
   virtual void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) = 0;
+  read_restart_vectors(CollectiveRestartFile & file) = 0;
 
   /*
-   * Write solution vectors to files so that the simulation can be restart from an intermediate
-   * state.
+   * Write solution vectors to a single file so that the simulation can be restart from an
+   * intermediate state.
    */
   void
-  do_write_restart(std::string const & filename) const final;
-
-  void
-  write_restart_preamble(boost::archive::binary_oarchive & oa) const;
+  do_write_restart(std::string const & name) const final;
 
   virtual void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const = 0;
+  write_restart_vectors(CollectiveRestartFile & file) const = 0;
+
+  /*
+   * Output the size of the restart file and the achieved I/O bandwidth. For asynchronous output,
+   * only the time spent in the time loop is reported.
+   */
+  void
+  print_restart_bandwidth(std::uint64_t const n_bytes,
+                          double const        wall_time,
+                          bool const          asynchronous = false) const;
 
   /*
    * Recalculate the time step size after each time step in case of adaptive time stepping.
@@ -282,11 +319,28 @@ private:
                               double const start_time,
                               double const time_step_size);
 
+  /*
+   * Same as above, but additionally computes the error estimate of the embedded scheme without
+   * modifying the solution at the beginning of the sub-step.
+   */
+  virtual void
+  do_timestep_oif_substepping_with_error_estimate(VectorType &,
+                                                  VectorType &,
+                                                  VectorType & error,
+                                                  double const start_time,
+                                                  double const time_step_size);
+
   /*
    * returns whether solver info has to be written in the current time step.
    */
   virtual bool
   print_solver_info() const = 0;
+
+  /*
+   * Restart file that is written in the background if restart_data.asynchronous is true. The write
+   * operations are completed before the next restart file is written, or by close_restart_file().
+   */
+  mutable CollectiveRestartFile restart_file;
 };
 
 } // namespace ExaDG
@@ -38,7 +38,8 @@ TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &      start_time_,
                 mpi_comm_,
                 is_test_),
     time_step(1.0),
-    adaptive_time_stepping(adaptive_time_stepping_)
+    adaptive_time_stepping(adaptive_time_stepping_),
+    time_step_proposed(1.0)
 {
 }
 
@@ -56,6 +57,14 @@ TimeIntExplRKBase<Number>::set_current_time_step_size(double const & time_step_s
   time_step = time_step_size;
 }
 
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::print_error_control_statistics() const
+{
+  if(error_controller)
+    error_controller->print_statistics(this->pcout, "Embedded error control");
+}
+
 template<typename Number>
 void
 TimeIntExplRKBase<Number>::setup(bool const do_restart)
@@ -103,7 +112,12 @@ TimeIntExplRKBase<Number>::do_timestep_post_solve()
   this->time += time_step;
   ++this->time_step_number;
 
-  if(adaptive_time_stepping == true)
+  if(error_controller)
+  {
+    // use the time step size proposed by the step size controller, but do not step over end_time
+    this->time_step = std::min(time_step_proposed, this->end_time - this->time);
+  }
+  else if(adaptive_time_stepping == true)
   {
     this->time_step = recalculate_time_step_size();
   }
@@ -129,60 +143,70 @@ TimeIntExplRKBase<Number>::prepare_vectors_for_next_timestep()
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
+TimeIntExplRKBase<Number>::do_write_restart(std::string const & name) const
 {
-  std::ostringstream oss;
+  std::string const filename = restart_filename(name);
+
+  if(dealii::Utilities::MPI::this_mpi_process(this->mpi_comm) == 0)
+    rename_restart_files(filename);
+
+  // the file must not be opened before it has been renamed
+  MPI_Barrier(this->mpi_comm);
 
-  boost::archive::binary_oarchive oa(oss);
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
 
-  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
+    // 1. time
+    oa & time;
 
-  // 1. ranks
-  oa & n_ranks;
+    // 2. time step size
+    oa & time_step;
+  }
 
-  // 2. time
-  oa & time;
+  CollectiveRestartFile file(filename, this->mpi_comm, true /* write */);
 
-  // 3. time step size
-  oa & time_step;
+  file.write_preamble(oss.str());
 
-  // 4. solution vectors
-  oa << solution_n;
+  // 3. solution vectors
+  write_restart_vectors(file);
 
-  write_restart_file(oss, filename);
+  file.close();
 }
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntExplRKBase<Number>::do_read_restart(std::string const & name)
 {
-  boost::archive::binary_iarchive ia(in);
+  std::string const filename = restart_filename(name);
 
-  // Note that the operations done here must be in sync with the output.
+  {
+    std::ifstream in(filename);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+  }
 
-  // 1. ranks
-  unsigned int n_old_ranks = 1;
-  ia &         n_old_ranks;
+  CollectiveRestartFile file(filename, this->mpi_comm, false /* write */);
 
-  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
-              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
-                                 " processes, "
-                                 "but restart was written on " +
-                                 dealii::Utilities::to_string(n_old_ranks) + " processes."));
+  // Note that the operations done here must be in sync with the output.
+  {
+    std::istringstream              iss(file.read_preamble());
+    boost::archive::binary_iarchive ia(iss);
 
-  // 2. time
-  ia & time;
+    // 1. time
+    ia & time;
 
-  // Note that start_time has to be set to the new start_time (since param.start_time might still be
-  // the original start time).
-  this->start_time = time;
+    // Note that start_time has to be set to the new start_time (since param.start_time might
+    // still be the original start time).
+    this->start_time = time;
+
+    // 2. time step size
+    ia & time_step;
+  }
 
-  // 3. time step size
-  ia & time_step;
+  // 3. solution vectors
+  read_restart_vectors(file);
 
-  // 4. solution vectors
-  ia >> solution_n;
+  file.close();
 }
 
 // instantiations
@@ -26,6 +26,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/time_integration/embedded_error_control.h>
 #include <exadg/time_integration/time_int_base.h>
 
 namespace ExaDG
@@ -53,6 +54,12 @@ public:
   void
   set_current_time_step_size(double const & time_step_size) final;
 
+  /*
+   * Prints the number of accepted and rejected time steps in case of embedded error control.
+   */
+  void
+  print_error_control_statistics() const;
+
 protected:
   // solution vectors
   VectorType solution_n, solution_np;
@@ -63,6 +70,12 @@ protected:
   // use adaptive time stepping?
   bool const adaptive_time_stepping;
 
+  // step size controller in case of embedded error control (to be created by derived classes),
+  // the error estimate of the embedded scheme, and the time step size proposed for the next step
+  std::shared_ptr<PIController> error_controller;
+  VectorType                    error_estimate;
+  double                        time_step_proposed;
+
 private:
   void
   do_timestep_pre_solve(bool const print_header) final;
@@ -94,11 +107,21 @@ private:
   virtual bool
   print_solver_info() const = 0;
 
+  /*
+   * Restart: the time, the time step size, and the solution vectors are written to/read from a
+   * single file shared by all processes, which can be read with an arbitrary number of processes.
+   */
   void
-  do_write_restart(std::string const & filename) const final;
+  do_write_restart(std::string const & name) const final;
 
   void
-  do_read_restart(std::ifstream & in) final;
+  do_read_restart(std::string const & name) final;
+
+  virtual void
+  write_restart_vectors(CollectiveRestartFile & file) const = 0;
+
+  virtual void
+  read_restart_vectors(CollectiveRestartFile & file) = 0;
 };
 
 } // namespace ExaDG
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_UTILITIES_GENERAL_PARAMETERS_H_
 
 // deal.II
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parameter_handler.h>
 
 namespace ExaDG
@@ -60,6 +61,11 @@ struct GeneralParameters
                         "Set to true if the program is run as a test.",
                         dealii::Patterns::Bool(),
                         false);
+      prm.add_parameter("NumberOfThreads",
+                        n_threads,
+                        "Number of threads per MPI process (hybrid MPI+threads parallelization).",
+                        dealii::Patterns::Integer(1),
+                        false);
     prm.leave_subsection();
     // clang-format on
   }
@@ -69,8 +75,21 @@ struct GeneralParameters
   unsigned int dim = 2;
 
   bool is_test = false;
+
+  unsigned int n_threads = 1;
 };
 
+/*
+ * Sets the number of threads per MPI process. This function has to be called before the
+ * matrix-free objects are set up, since the matrix-free loops are executed task-parallel only if
+ * more than one thread is available at that time, see MatrixFreeData.
+ */
+inline void
+set_number_of_threads(GeneralParameters const & general)
+{
+  dealii::MultithreadInfo::set_thread_limit(general.n_threads);
+}
+
 } // namespace ExaDG
 
 
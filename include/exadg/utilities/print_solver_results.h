@@ -28,6 +28,7 @@
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/utilities.h>
 
 namespace ExaDG
@@ -38,7 +39,9 @@ print_throughput(
   std::string const & operator_type,
   MPI_Comm const &    mpi_comm)
 {
-  unsigned int N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  // in case of hybrid MPI+threads parallelization, each thread runs on its own core
+  unsigned int const N_cores =
+    dealii::Utilities::MPI::n_mpi_processes(mpi_comm) * dealii::MultithreadInfo::n_threads();
 
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
@@ -61,7 +64,7 @@ print_throughput(
                 << std::scientific << std::setprecision(4)
                 << std::setw(15) << std::left << (double)std::get<1>(*it)
                 << std::setw(15) << std::left << std::get<2>(*it)
-                << std::setw(15) << std::left << std::get<2>(*it)/(double)N_mpi_processes
+                << std::setw(15) << std::left << std::get<2>(*it)/(double)N_cores
                 << std::endl << std::flush;
     }
 
@@ -0,0 +1,291 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_VECTOR_TOOLS_POINT_EVALUATOR_H_
+#define INCLUDE_EXADG_VECTOR_TOOLS_POINT_EVALUATOR_H_
+
+// boost
+#include <boost/serialization/vector.hpp>
+
+// deal.II
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping_q_cache.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+namespace ExaDG
+{
+/*
+ * Evaluates finite element fields in a fixed set of points, e.g., for probes or line plots.
+ *
+ * The points are located once in setup() via dealii::Utilities::MPI::RemotePointEvaluation, and
+ * the cells and reference coordinates found are cached for all subsequent evaluations. For moving
+ * meshes, i.e., if the mapping is a dealii::MappingQCache as used by MappingDoFVector, the points
+ * are re-located before every evaluation. All fields passed to evaluate() are evaluated in a single
+ * pass over the cells with dealii::FEPointEvaluation and communicated in a single communication
+ * round. Points found in several cells obtain the average value, points that have not been found
+ * obtain the value zero.
+ *
+ * By default, all processes pass all points to RemotePointEvaluation and the results are
+ * available on all processes, which is needed if all processes use the values (e.g., as boundary
+ * data). If the results are only consumed on one process (e.g., to write them to a file), that
+ * process can be specified in setup(). Then, only this process requests the points, and all other
+ * processes only provide the values of the points located in their cells, i.e., the point data
+ * is not replicated on all processes.
+ */
+template<int dim, typename Number>
+class PointEvaluator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef std::pair<dealii::DoFHandler<dim> const *, VectorType const *> Field;
+
+  static unsigned int const all_processes = dealii::numbers::invalid_unsigned_int;
+
+  PointEvaluator() : triangulation(nullptr), mapping(nullptr), moving_mesh(false)
+  {
+  }
+
+  /*
+   * Locates the points. If a consumer_rank is specified, the points only have to be provided on
+   * that process, and the results of evaluate() are only available on that process.
+   */
+  void
+  setup(std::vector<dealii::Point<dim>> const & points_in,
+        dealii::Triangulation<dim> const &      triangulation_in,
+        dealii::Mapping<dim> const &            mapping_in,
+        double const                            tolerance     = 1.e-10,
+        unsigned int const                      consumer_rank = all_processes)
+  {
+    MPI_Comm const mpi_comm = triangulation_in.get_communicator();
+
+    if(consumer_rank == all_processes or
+       consumer_rank == dealii::Utilities::MPI::this_mpi_process(mpi_comm))
+      points = points_in;
+    else
+      points.clear();
+
+    triangulation = &triangulation_in;
+    mapping       = &mapping_in;
+    moving_mesh   = dynamic_cast<dealii::MappingQCache<dim> const *>(mapping) != nullptr;
+
+    remote_point_evaluation =
+      std::make_shared<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(tolerance);
+
+    locate_points();
+  }
+
+  /*
+   * Returns the points requested by this process.
+   */
+  std::vector<dealii::Point<dim>> const &
+  get_points() const
+  {
+    return points;
+  }
+
+  /*
+   * Returns whether all points of all processes have been found. This function is collective.
+   */
+  bool
+  all_points_found() const
+  {
+    return dealii::Utilities::MPI::min(remote_point_evaluation->all_points_found() ? 1 : 0,
+                                       triangulation->get_communicator()) == 1;
+  }
+
+  /*
+   * Returns whether the point with index p among the points requested by this process has been
+   * found.
+   */
+  bool
+  point_found(unsigned int const p) const
+  {
+    std::vector<unsigned int> const & point_ptrs = remote_point_evaluation->get_point_ptrs();
+
+    return point_ptrs[p + 1] > point_ptrs[p];
+  }
+
+  /*
+   * Evaluates all fields in all points. The result contains for each field the values of all
+   * components in all points requested by this process, i.e.,
+   * values[field][point * n_components + component], see also setup(). This function is
+   * collective. Only fields with one or dim components are supported.
+   */
+  std::vector<std::vector<Number>>
+  evaluate(std::vector<Field> const & fields) const
+  {
+    if(moving_mesh)
+      locate_points();
+
+    std::vector<unsigned int> n_components(fields.size());
+    std::vector<unsigned int> offsets(fields.size());
+    unsigned int             n_values = 0;
+    for(unsigned int f = 0; f < fields.size(); ++f)
+    {
+      n_components[f] = fields[f].first->get_fe().n_components();
+      AssertThrow(n_components[f] == 1 or n_components[f] == dim,
+                  dealii::ExcMessage("Only scalar fields and vector fields are supported."));
+
+      offsets[f] = n_values;
+      n_values += n_components[f];
+    }
+
+    std::vector<bool> has_ghost_elements(fields.size());
+    for(unsigned int f = 0; f < fields.size(); ++f)
+    {
+      has_ghost_elements[f] = fields[f].second->has_ghost_elements();
+      if(not has_ghost_elements[f])
+        fields[f].second->update_ghost_values();
+    }
+
+    std::vector<std::shared_ptr<dealii::FEPointEvaluation<1, dim>>>   evaluators_scalar;
+    std::vector<std::shared_ptr<dealii::FEPointEvaluation<dim, dim>>> evaluators_vector;
+    evaluators_scalar.resize(fields.size());
+    evaluators_vector.resize(fields.size());
+    for(unsigned int f = 0; f < fields.size(); ++f)
+    {
+      if(n_components[f] == 1)
+        evaluators_scalar[f] = std::make_shared<dealii::FEPointEvaluation<1, dim>>(
+          *mapping, fields[f].first->get_fe(), dealii::update_values);
+      else
+        evaluators_vector[f] = std::make_shared<dealii::FEPointEvaluation<dim, dim>>(
+          *mapping, fields[f].first->get_fe(), dealii::update_values);
+    }
+
+    auto const evaluation_function =
+      [&](dealii::ArrayView<std::vector<double>> const &                                 values,
+          typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::CellData const & cell_data) {
+        std::vector<double> solution_values;
+
+        for(unsigned int i = 0; i < cell_data.cells.size(); ++i)
+        {
+          unsigned int const first_point = cell_data.reference_point_ptrs[i];
+
+          dealii::ArrayView<dealii::Point<dim> const> unit_points(
+            cell_data.reference_point_values.data() + first_point,
+            cell_data.reference_point_ptrs[i + 1] - first_point);
+
+          for(unsigned int q = 0; q < unit_points.size(); ++q)
+            values[first_point + q].resize(n_values);
+
+          for(unsigned int f = 0; f < fields.size(); ++f)
+          {
+            typename dealii::DoFHandler<dim>::active_cell_iterator const cell(
+              triangulation, cell_data.cells[i].first, cell_data.cells[i].second, fields[f].first);
+
+            solution_values.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_values(*fields[f].second, solution_values.begin(), solution_values.end());
+
+            if(n_components[f] == 1)
+            {
+              evaluators_scalar[f]->evaluate(cell,
+                                             unit_points,
+                                             solution_values,
+                                             dealii::EvaluationFlags::values);
+
+              for(unsigned int q = 0; q < unit_points.size(); ++q)
+                values[first_point + q][offsets[f]] = evaluators_scalar[f]->get_value(q);
+            }
+            else
+            {
+              evaluators_vector[f]->evaluate(cell,
+                                             unit_points,
+                                             solution_values,
+                                             dealii::EvaluationFlags::values);
+
+              for(unsigned int q = 0; q < unit_points.size(); ++q)
+                for(unsigned int d = 0; d < dim; ++d)
+                  values[first_point + q][offsets[f] + d] = evaluators_vector[f]->get_value(q)[d];
+            }
+          }
+        }
+      };
+
+    std::vector<std::vector<double>> values_in_cells;
+    std::vector<std::vector<double>> buffer;
+    remote_point_evaluation->template evaluate_and_process<std::vector<double>>(
+      values_in_cells, buffer, evaluation_function);
+
+    for(unsigned int f = 0; f < fields.size(); ++f)
+      if(not has_ghost_elements[f])
+        fields[f].second->zero_out_ghost_values();
+
+    // average over all cells in which a point has been found
+    std::vector<std::vector<Number>> result(fields.size());
+    for(unsigned int f = 0; f < fields.size(); ++f)
+      result[f].resize(points.size() * n_components[f], Number(0.0));
+
+    std::vector<unsigned int> const & point_ptrs = remote_point_evaluation->get_point_ptrs();
+    for(unsigned int p = 0; p < points.size(); ++p)
+    {
+      unsigned int const n_cells = point_ptrs[p + 1] - point_ptrs[p];
+      for(unsigned int i = point_ptrs[p]; i < point_ptrs[p + 1]; ++i)
+        for(unsigned int f = 0; f < fields.size(); ++f)
+          for(unsigned int c = 0; c < n_components[f]; ++c)
+            result[f][p * n_components[f] + c] += values_in_cells[i][offsets[f] + c] / n_cells;
+    }
+
+    return result;
+  }
+
+  std::vector<Number>
+  evaluate_scalar(dealii::DoFHandler<dim> const & dof_handler, VectorType const & vector) const
+  {
+    return evaluate({Field(&dof_handler, &vector)})[0];
+  }
+
+  std::vector<dealii::Tensor<1, dim, Number>>
+  evaluate_vector(dealii::DoFHandler<dim> const & dof_handler, VectorType const & vector) const
+  {
+    std::vector<Number> const values = evaluate({Field(&dof_handler, &vector)})[0];
+
+    std::vector<dealii::Tensor<1, dim, Number>> result(points.size());
+    for(unsigned int p = 0; p < points.size(); ++p)
+      for(unsigned int d = 0; d < dim; ++d)
+        result[p][d] = values[p * dim + d];
+
+    return result;
+  }
+
+private:
+  void
+  locate_points() const
+  {
+    remote_point_evaluation->reinit(points, *triangulation, *mapping);
+  }
+
+  std::vector<dealii::Point<dim>> points;
+
+  dealii::Triangulation<dim> const * triangulation;
+  dealii::Mapping<dim> const *       mapping;
+
+  bool moving_mesh;
+
+  std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>> remote_point_evaluation;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_VECTOR_TOOLS_POINT_EVALUATOR_H_ */
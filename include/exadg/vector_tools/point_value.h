@@ -24,38 +24,20 @@
 
 #include <deal.II/base/point.h>
 #include <deal.II/dofs/dof_handler.h>
-#include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping.h>
-#include <deal.II/grid/grid_tools.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <exadg/vector_tools/point_evaluator.h>
+
 namespace ExaDG
 {
-template<int dim, typename Number>
-void
-my_point_value(dealii::Vector<Number> &                                       result,
-               dealii::Mapping<dim> const &                                   mapping,
-               dealii::DoFHandler<dim> const &                                dof_handler,
-               dealii::LinearAlgebra::distributed::Vector<Number> const &     dof_vector,
-               typename dealii::DoFHandler<dim>::active_cell_iterator const & cell,
-               dealii::Point<dim> const &                                     point_in_ref_coord)
-{
-  Assert(dealii::GeometryInfo<dim>::distance_to_unit_cell(point_in_ref_coord) < 1e-10,
-         dealii::ExcInternalError());
-
-  dealii::Quadrature<dim> const quadrature(
-    dealii::GeometryInfo<dim>::project_to_unit_cell(point_in_ref_coord));
-
-  dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
-  dealii::FEValues<dim>              fe_values(mapping, fe, quadrature, dealii::update_values);
-  fe_values.reinit(cell);
-
-  // then use this to get the values of the given fe_function at this point
-  std::vector<dealii::Vector<Number>> solution_vector(1, dealii::Vector<Number>(fe.n_components()));
-  fe_values.get_function_values(dof_vector, solution_vector);
-  result = solution_vector[0];
-}
-
+/*
+ * Evaluates a scalar quantity in a single point, with the value available on all processes of the
+ * communicator of the triangulation, which has to be mpi_comm. The point is located anew in every
+ * call, i.e., this function is only intended for single evaluations, e.g., during setup. If several
+ * points are to be evaluated, or the same point repeatedly, use PointEvaluator directly, which
+ * locates the points only once and evaluates all points in a single communication round.
+ */
 template<int dim, typename Number>
 void
 evaluate_scalar_quantity_in_point(
@@ -67,38 +49,24 @@ evaluate_scalar_quantity_in_point(
   MPI_Comm const &                                           mpi_comm,
   double const                                               tolerance = 1.e-10)
 {
-  typedef std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>
-    Pair;
-
-  std::vector<Pair> adjacent_cells =
-    dealii::GridTools::find_all_active_cells_around_point(mapping, dof_handler, point, tolerance);
-
-  // processor local variables: initialize with zeros since we add values to these variables
-  unsigned int counter = 0;
-  solution_value       = 0.0;
+  AssertThrow(dealii::Utilities::MPI::n_mpi_processes(mpi_comm) ==
+                dealii::Utilities::MPI::n_mpi_processes(
+                  dof_handler.get_triangulation().get_communicator()),
+              dealii::ExcMessage("The point is evaluated on the communicator of the "
+                                 "triangulation."));
 
-  // loop over all adjacent cells
-  for(auto cell : adjacent_cells)
-  {
-    // go on only if cell is owned by the processor
-    if(cell.first->is_locally_owned())
-    {
-      dealii::Vector<Number> value(1);
-      my_point_value(value, mapping, dof_handler, numerical_solution, cell.first, cell.second);
+  PointEvaluator<dim, Number> evaluator;
+  evaluator.setup({point}, dof_handler.get_triangulation(), mapping, tolerance);
 
-      solution_value += value(0);
-      ++counter;
-    }
-  }
+  AssertThrow(evaluator.all_points_found(), dealii::ExcMessage("No points found."));
 
-  // parallel computations: add results of all processors and calculate mean value
-  counter = dealii::Utilities::MPI::sum(counter, mpi_comm);
-  AssertThrow(counter > 0, dealii::ExcMessage("No points found."));
-
-  solution_value = dealii::Utilities::MPI::sum(solution_value, mpi_comm);
-  solution_value /= (double)counter;
+  solution_value = evaluator.evaluate_scalar(dof_handler, numerical_solution)[0];
 }
 
+/*
+ * Evaluates a vectorial quantity in a single point. Like evaluate_scalar_quantity_in_point(), this
+ * function is only intended for single evaluations.
+ */
 template<int dim, typename Number>
 void evaluate_vectorial_quantity_in_point(
   dealii::Tensor<1, dim, Number> &                           solution_value,
@@ -109,39 +77,18 @@ void evaluate_vectorial_quantity_in_point(
   MPI_Comm const &                                           mpi_comm,
   double const                                               tolerance = 1.e-10)
 {
-  typedef std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>
-    Pair;
-
-  std::vector<Pair> adjacent_cells =
-    dealii::GridTools::find_all_active_cells_around_point(mapping, dof_handler, point, tolerance);
-
-  // processor local variables: initialize with zeros since we add values to these variables
-  unsigned int counter = 0;
-  solution_value       = 0.0;
-
-  // loop over all adjacent cells
-  for(auto cell : adjacent_cells)
-  {
-    // go on only if cell is owned by the processor
-    if(cell.first->is_locally_owned())
-    {
-      dealii::Vector<Number> value(dim);
-      my_point_value(value, mapping, dof_handler, numerical_solution, cell.first, cell.second);
-
-      for(unsigned int d = 0; d < dim; ++d)
-        solution_value[d] += value(d);
+  AssertThrow(dealii::Utilities::MPI::n_mpi_processes(mpi_comm) ==
+                dealii::Utilities::MPI::n_mpi_processes(
+                  dof_handler.get_triangulation().get_communicator()),
+              dealii::ExcMessage("The point is evaluated on the communicator of the "
+                                 "triangulation."));
 
-      ++counter;
-    }
-  }
+  PointEvaluator<dim, Number> evaluator;
+  evaluator.setup({point}, dof_handler.get_triangulation(), mapping, tolerance);
 
-  // parallel computations: add results of all processors and calculate mean value
-  counter = dealii::Utilities::MPI::sum(counter, mpi_comm);
-  AssertThrow(counter > 0, dealii::ExcMessage("No points found."));
+  AssertThrow(evaluator.all_points_found(), dealii::ExcMessage("No points found."));
 
-  for(unsigned int d = 0; d < dim; ++d)
-    solution_value[d] = dealii::Utilities::MPI::sum(solution_value[d], mpi_comm);
-  solution_value /= (double)counter;
+  solution_value = evaluator.evaluate_vector(dof_handler, numerical_solution)[0];
 }
 
 } // namespace ExaDG
@@ -0,0 +1,68 @@
+#!/bin/sh
+#########################################################################
+#
+#                 #######               ######  #######
+#                 ##                    ##   ## ##
+#                 #####   ##  ## #####  ##   ## ## ####
+#                 ##       ####  ## ##  ##   ## ##   ##
+#                 ####### ##  ## ###### ######  #######
+#
+#  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+#
+#  Copyright (C) 2021 by the ExaDG authors
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+#########################################################################
+
+# Measures the throughput of the matrix-free operators for different splits of the cores of a
+# node into MPI processes and threads per MPI process (hybrid MPI+threads parallelization), e.g.
+#
+#   ./throughput_ranks_threads.sh ./applications/poisson/throughput/throughput \
+#                                 ../applications/poisson/throughput/input.json 48
+#
+# The input file has to contain the parameter NumberOfThreads in the General section. For every
+# split (ranks x threads = number of cores), a copy of the input file with the respective number
+# of threads is created and the output is written to throughput_<ranks>x<threads>.log.
+#
+# The MPI launcher can be set via the environment variable MPIRUN, e.g. in order to pin each MPI
+# process to as many cores as threads are used (OpenMPI: "mpirun --map-by slot:PE=<threads>").
+
+EXE=$1
+INPUT=$2
+N_CORES=${3:-$(nproc)}
+MPIRUN=${MPIRUN:-mpirun}
+
+if [ -z "$EXE" ] || [ -z "$INPUT" ]
+then
+  echo "Usage: $0 <throughput executable> <input file> [number of cores]"
+  exit 1
+fi
+
+N_THREADS=1
+while [ $N_THREADS -le $N_CORES ]
+do
+  if [ $((N_CORES % N_THREADS)) -eq 0 ]
+  then
+    N_RANKS=$((N_CORES / N_THREADS))
+    NAME=${N_RANKS}x${N_THREADS}
+
+    sed 's/"NumberOfThreads": *"[0-9]*"/"NumberOfThreads": "'$N_THREADS'"/' $INPUT > input_$NAME.json
+
+    echo "Running $N_RANKS MPI processes with $N_THREADS threads each ..."
+    $MPIRUN -np $N_RANKS $EXE input_$NAME.json > throughput_$NAME.log
+  fi
+
+  N_THREADS=$((N_THREADS * 2))
+done
@@ -0,0 +1,202 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <string>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/operators/mass_operator.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const degree = 3;
+
+unsigned int const n_refinements = 2;
+
+double const tol = 1.e-12;
+
+/*
+ * Compares the diagonal computed by sum factorization, which is used by calculate_diagonal() for
+ * DG discretizations, to the diagonal computed column by column.
+ */
+template<typename Operator>
+void
+compare_diagonals(Operator const & op, std::string const & name)
+{
+  typename Operator::VectorType diagonal, diagonal_column_by_column;
+  op.calculate_diagonal(diagonal);
+  op.calculate_diagonal_column_by_column(diagonal_column_by_column);
+
+  diagonal_column_by_column -= diagonal;
+  bool const agree = diagonal_column_by_column.linfty_norm() < tol * diagonal.linfty_norm();
+
+  std::cout << name << ": " << (agree ? "diagonals agree" : "diagonals differ") << std::endl;
+}
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+template<int dim, int n_components>
+void
+diagonal_test(dealii::Triangulation<dim> const & triangulation)
+{
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), n_components);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  dealii::UpdateFlags const update_flags = dealii::update_values | dealii::update_gradients |
+                                           dealii::update_JxW_values |
+                                           dealii::update_quadrature_points;
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_flags;
+  additional_data.mapping_update_flags_inner_faces =
+    update_flags | dealii::update_normal_vectors;
+  additional_data.mapping_update_flags_boundary_faces =
+    update_flags | dealii::update_normal_vectors;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  std::string const suffix =
+    ", dim=" + std::to_string(dim) + ", components=" + std::to_string(n_components);
+
+  // the mass operator only probes values
+  MassOperatorData<dim>                   mass_operator_data;
+  MassOperator<dim, n_components, double> mass_operator;
+  mass_operator.initialize(matrix_free, constraints, mass_operator_data);
+  compare_diagonals(mass_operator, "Mass operator" + suffix);
+
+  // the Laplace operator only probes gradients
+  unsigned int const rank = n_components == 1 ? 0 : 1;
+
+  auto boundary_descriptor = std::make_shared<Poisson::BoundaryDescriptor<rank, dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(n_components)));
+
+  Poisson::LaplaceOperatorData<rank, dim> laplace_operator_data;
+  laplace_operator_data.bc = boundary_descriptor;
+
+  Poisson::LaplaceOperator<dim, double, n_components> laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, laplace_operator_data);
+  compare_diagonals(laplace_operator, "Laplace operator" + suffix);
+}
+
+template<int dim>
+void
+diagonal_test()
+{
+  std::cout << std::endl
+            << "Sum-factorized diagonal, " << dim << "D, degree " << degree << ":" << std::endl
+            << std::endl;
+
+  // The vertices are displaced so that the cells are not parallelograms and the Jacobian varies
+  // within the cells.
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, -1.0, 1.0);
+  triangulation.refine_global(n_refinements);
+  dealii::GridTools::transform(
+    [](dealii::Point<dim> const & point) {
+      dealii::Point<dim> result = point;
+      for(unsigned int d = 0; d < dim; ++d)
+        result[d] += 0.1 * std::sin(dealii::numbers::PI * point[(d + 1) % dim]) *
+                     (1.0 - point[d] * point[d]);
+      return result;
+    },
+    triangulation);
+
+  diagonal_test<dim, 1>(triangulation);
+  diagonal_test<dim, dim>(triangulation);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::diagonal_test<2>();
+    ExaDG::diagonal_test<3>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,195 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+#include <exadg/solvers_and_preconditioners/solvers/pipelined_cg.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const M = 1000;
+
+double const rel_tol = 1.e-10;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Symmetric positive definite tridiagonal matrix with entries (-1, 2.1 + i % 10, -1). The strongly
+ * varying diagonal makes the Jacobi preconditioner effective.
+ */
+class TridiagonalMatrix
+{
+public:
+  typedef double value_type;
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    vector.reinit(M);
+  }
+
+  void
+  calculate_inverse_diagonal(VectorType & inverse_diagonal) const
+  {
+    initialize_dof_vector(inverse_diagonal);
+    for(unsigned int i = 0; i < M; ++i)
+      inverse_diagonal(i) = 1.0 / diagonal(i);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < M; ++i)
+    {
+      double value = diagonal(i) * src(i);
+      if(i > 0)
+        value -= src(i - 1);
+      if(i + 1 < M)
+        value -= src(i + 1);
+      dst(i) = value;
+    }
+  }
+
+private:
+  static double
+  diagonal(unsigned int const i)
+  {
+    return 2.1 + (i % 10);
+  }
+};
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+void
+pipelined_cg_test(bool const use_preconditioner)
+{
+  std::cout << std::endl
+            << "Pipelined CG solver, size M=" << M << ", "
+            << (use_preconditioner ? "Jacobi preconditioner" : "no preconditioner") << ":"
+            << std::endl
+            << std::endl;
+
+  TridiagonalMatrix                       matrix;
+  JacobiPreconditioner<TridiagonalMatrix> preconditioner(matrix);
+
+  Krylov::SolverDataCG solver_data;
+  solver_data.solver_tolerance_rel = rel_tol;
+  solver_data.use_preconditioner   = use_preconditioner;
+
+  typedef PreconditionerBase<double> Preconditioner;
+  Krylov::SolverCG<TridiagonalMatrix, Preconditioner, VectorType> cg_solver(matrix,
+                                                                            preconditioner,
+                                                                            solver_data);
+  Krylov::SolverPipelinedCG<TridiagonalMatrix, Preconditioner, VectorType> pipelined_cg_solver(
+    matrix, preconditioner, solver_data);
+
+  VectorType b, x_cg, x_pipelined;
+  matrix.initialize_dof_vector(b);
+  matrix.initialize_dof_vector(x_cg);
+  matrix.initialize_dof_vector(x_pipelined);
+  for(unsigned int i = 0; i < M; ++i)
+    b(i) = 1.0 + std::sin(0.01 * i);
+
+  unsigned int const n_iter_cg        = cg_solver.solve(x_cg, b, false);
+  unsigned int const n_iter_pipelined = pipelined_cg_solver.solve(x_pipelined, b, false);
+
+  // Both methods produce the same iterates in exact arithmetic, so the number of iterations may
+  // only differ due to round-off errors.
+  bool const same_iterations = std::abs(int(n_iter_pipelined) - int(n_iter_cg)) <= 1;
+
+  VectorType difference(x_pipelined);
+  difference -= x_cg;
+  bool const same_solution = difference.l2_norm() < 1.e-6 * x_cg.l2_norm();
+
+  // the pipelined method updates the residual by a recurrence, so check the true residual
+  VectorType residual;
+  matrix.initialize_dof_vector(residual);
+  matrix.vmult(residual, x_pipelined);
+  residual.sadd(-1.0, 1.0, b);
+  bool const converged = residual.l2_norm() < 1.e2 * rel_tol * b.l2_norm();
+
+  std::cout << "Number of iterations agrees with CG: " << (same_iterations ? "yes" : "no")
+            << std::endl;
+  std::cout << "Solution agrees with CG: " << (same_solution ? "yes" : "no") << std::endl;
+  std::cout << "Residual reduced to tolerance: " << (converged ? "yes" : "no") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::pipelined_cg_test(false);
+    ExaDG::pipelined_cg_test(true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
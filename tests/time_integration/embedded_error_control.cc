@@ -0,0 +1,213 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/embedded_error_control.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+double const omega = 10.0;
+
+double const end_time = 1.0;
+
+// the initial time step size is far too large, so that the first time step is rejected
+double const initial_time_step = 1.0;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Harmonic oscillator y1' = y2, y2' = - omega^2 y1 with solution y1 = cos(omega t),
+ * y2 = - omega sin(omega t).
+ */
+class Oscillator
+{
+public:
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const /*time*/) const
+  {
+    dst(0) = src(1);
+    dst(1) = -omega * omega * src(0);
+  }
+};
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+struct Result
+{
+  unsigned int n_accepted   = 0;
+  unsigned int n_rejected   = 0;
+  bool         first_reject = false;
+  double       error        = 0.0;
+};
+
+/*
+ * Integrates the oscillator up to end_time with the embedded scheme RK3(2)4[2R+]C and the PI
+ * controller for the given tolerance.
+ */
+Result
+integrate(double const tolerance, unsigned int const max_number_of_rejections)
+{
+  EmbeddedErrorControlData data;
+  data.active                   = true;
+  data.absolute_tolerance       = tolerance;
+  data.relative_tolerance       = tolerance;
+  data.max_number_of_rejections = max_number_of_rejections;
+
+  LowStorageRKReg2Embedded<Oscillator, VectorType> time_integrator(std::make_shared<Oscillator>(),
+                                                                   3,
+                                                                   4);
+
+  PIController controller(data, time_integrator.get_order_embedded_scheme());
+
+  VectorType solution_n(2), solution_np(2), error(2);
+  solution_n(0) = 1.0;
+  solution_n(1) = 0.0;
+
+  Result result;
+
+  double time      = 0.0;
+  double time_step = initial_time_step;
+  while(time < end_time - 1.e-12)
+  {
+    time_step = std::min(time_step, end_time - time);
+
+    time += do_timestep_with_error_control(
+      solution_np,
+      solution_n,
+      error,
+      time,
+      time_step,
+      controller,
+      [&](VectorType & dst, VectorType & src, VectorType & err, double const t, double const dt) {
+        time_integrator.solve_timestep_with_error_estimate(dst, src, err, t, dt);
+      });
+
+    if(controller.get_number_of_accepted_steps() == 1)
+      result.first_reject = controller.get_number_of_rejected_steps() > 0;
+
+    solution_n.swap(solution_np);
+  }
+
+  result.n_accepted = controller.get_number_of_accepted_steps();
+  result.n_rejected = controller.get_number_of_rejected_steps();
+  result.error      = std::max(std::abs(solution_n(0) - std::cos(omega * end_time)),
+                          std::abs(solution_n(1) + omega * std::sin(omega * end_time)) / omega);
+
+  return result;
+}
+
+void
+embedded_error_control_test()
+{
+  std::cout << std::endl
+            << "Embedded error control, harmonic oscillator with omega = " << omega << ":"
+            << std::endl
+            << std::endl;
+
+  Result const coarse = integrate(1.e-4, 20);
+  Result const fine   = integrate(1.e-7, 20);
+
+  std::cout << "First time step rejected: " << (coarse.first_reject ? "yes" : "no") << std::endl;
+  std::cout << "Accepted and rejected time steps: "
+            << (coarse.n_accepted > 0 && coarse.n_rejected > 0 ? "yes" : "no") << std::endl;
+  std::cout << "Error of the order of the tolerance: "
+            << (coarse.error < 1.e-2 && fine.error < 1.e-5 ? "yes" : "no") << std::endl;
+  std::cout << "Smaller tolerance requires more time steps: "
+            << (fine.n_accepted > coarse.n_accepted ? "yes" : "no") << std::endl;
+  std::cout << "Smaller tolerance reduces the error: " << (fine.error < coarse.error ? "yes" : "no")
+            << std::endl;
+
+  bool thrown = false;
+  try
+  {
+    integrate(1.e-4, 0);
+  }
+  catch(std::exception const &)
+  {
+    thrown = true;
+  }
+
+  std::cout << "Exceeding the maximum number of rejections throws: " << (thrown ? "yes" : "no")
+            << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::embedded_error_control_test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
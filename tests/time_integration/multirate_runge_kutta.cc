@@ -0,0 +1,232 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/multirate_runge_kutta.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const n_classes = 3;
+
+double const end_time = 1.0;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Nonlinear system of three coupled ordinary differential equations, where component i belongs to
+ * step size class min(i, n_classes - 1). Hence, R^{(c)} is non-zero only in the components of
+ * class c, but depends on all components.
+ */
+class SplitSystem
+{
+public:
+  SplitSystem(unsigned int const n_classes_in) : n_classes(n_classes_in)
+  {
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    vector.reinit(3);
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const time) const
+  {
+    evaluate_step_size_classes(dst, src, time, 0, n_classes - 1);
+  }
+
+  void
+  evaluate_step_size_classes(VectorType &       dst,
+                             VectorType const & src,
+                             double const       time,
+                             unsigned int const first_class,
+                             unsigned int const last_class) const
+  {
+    dst = 0.0;
+
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+      unsigned int const c = std::min(i, n_classes - 1);
+      if(c < first_class || c > last_class)
+        continue;
+
+      if(i == 0)
+        dst(0) = -2.0 * src(0) + src(1) + std::sin(time);
+      else if(i == 1)
+        dst(1) = src(0) * src(2) - src(1);
+      else
+        dst(2) = -0.5 * src(2) + std::cos(time) * src(0);
+    }
+  }
+
+private:
+  unsigned int const n_classes;
+};
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+void
+set_initial_condition(VectorType & solution)
+{
+  solution.reinit(3);
+  solution(0) = 1.0;
+  solution(1) = 0.5;
+  solution(2) = -0.5;
+}
+
+VectorType
+integrate(ExplicitTimeIntegrator<SplitSystem, VectorType> & time_integrator,
+          unsigned int const                                n_time_steps)
+{
+  VectorType solution_n, solution_np;
+  set_initial_condition(solution_n);
+  solution_np.reinit(solution_n);
+
+  double const time_step = end_time / n_time_steps;
+  for(unsigned int n = 0; n < n_time_steps; ++n)
+  {
+    time_integrator.solve_timestep(solution_np, solution_n, n * time_step, time_step);
+    solution_n.swap(solution_np);
+  }
+
+  return solution_n;
+}
+
+double
+calculate_error(VectorType const & solution, VectorType const & reference)
+{
+  VectorType difference(solution);
+  difference -= reference;
+  return difference.linfty_norm();
+}
+
+void
+multirate_runge_kutta_test()
+{
+  std::cout << std::endl
+            << "Multirate Runge-Kutta method of order 2 with " << n_classes
+            << " step size classes:" << std::endl
+            << std::endl;
+
+  auto const system = std::make_shared<SplitSystem>(n_classes);
+
+  // reference solution computed with the classical Runge-Kutta method of order 4
+  ExplicitRungeKuttaTimeIntegrator<SplitSystem, VectorType> reference_integrator(4, system);
+  VectorType const reference = integrate(reference_integrator, 20000);
+
+  MultirateRK2<SplitSystem, VectorType> multirate_integrator(system, n_classes);
+
+  std::vector<double> errors;
+  for(unsigned int n_time_steps = 8; n_time_steps <= 64; n_time_steps *= 2)
+    errors.push_back(calculate_error(integrate(multirate_integrator, n_time_steps), reference));
+
+  bool second_order = true;
+  for(unsigned int i = 0; i + 1 < errors.size(); ++i)
+  {
+    double const order = std::log2(errors[i] / errors[i + 1]);
+    second_order       = second_order && order > 1.9 && order < 2.1;
+  }
+
+  std::cout << "Convergence order 2 for macro time steps 1/8, ..., 1/64: "
+            << (second_order ? "yes" : "no") << std::endl;
+
+  // for a single class, the scheme reduces to the explicit midpoint rule
+  auto const system_single_class = std::make_shared<SplitSystem>(1);
+
+  MultirateRK2<SplitSystem, VectorType> single_class_integrator(system_single_class, 1);
+  ExplicitRungeKuttaTimeIntegrator<SplitSystem, VectorType> midpoint_integrator(
+    2, system_single_class);
+
+  VectorType const solution_single_class = integrate(single_class_integrator, 16);
+  VectorType const solution_midpoint     = integrate(midpoint_integrator, 16);
+
+  std::cout << "Single class equals explicit midpoint rule: "
+            << (calculate_error(solution_single_class, solution_midpoint) <
+                    1.e-13 * solution_midpoint.linfty_norm() ?
+                  "yes" :
+                  "no")
+            << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::multirate_runge_kutta_test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,272 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+#include <exadg/matrix_free/categorization.h>
+#include <exadg/matrix_free/step_size_classes.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const dim = 2;
+
+unsigned int const degree = 2;
+
+unsigned int const n_classes = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Smooth state (density, momentum, energy) with positive density and pressure.
+ */
+class State : public dealii::Function<dim>
+{
+public:
+  State() : dealii::Function<dim>(dim + 2)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double const pi = dealii::numbers::PI;
+
+    if(component == 0)
+      return 1.0 + 0.2 * std::sin(2.0 * pi * p[0]) * std::sin(2.0 * pi * p[1]);
+    else if(component == 1)
+      return 0.3 + 0.1 * std::cos(pi * p[0]);
+    else if(component == 2)
+      return 0.2 * std::sin(pi * p[1]);
+    else
+      return 2.5 + 0.1 * p[0];
+  }
+};
+
+/*
+ * Unit square refined globally twice, where the cells in [0,1/2]^2 are refined once more and the
+ * cells in [0,1/4]^2 twice more, so that three step size classes are obtained.
+ */
+void
+create_graded_triangulation(dealii::parallel::distributed::Triangulation<dim> & triangulation)
+{
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  for(unsigned int level = 0; level < 2; ++level)
+  {
+    double const corner = 0.5 / (1 << level);
+
+    for(auto const & cell : triangulation.active_cell_iterators())
+      if(cell->is_locally_owned() && cell->center()[0] < corner && cell->center()[1] < corner)
+        cell->set_refine_flag();
+
+    triangulation.execute_coarsening_and_refinement();
+  }
+}
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+/*
+ * Evaluates the convective operator of the compressible Navier-Stokes solver for each step size
+ * class separately and compares the sum of R^{(c)} over all classes with the evaluation of R
+ * without step size classes.
+ */
+void
+step_size_classes_test()
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  pcout << std::endl
+        << "Step size classes of the convective operator on a graded mesh:" << std::endl
+        << std::endl;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  create_graded_triangulation(triangulation);
+
+  std::vector<unsigned int> const cell_classes =
+    calculate_step_size_classes(triangulation, n_classes, mpi_comm);
+
+  std::vector<unsigned int> n_cells(n_classes, 0);
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned())
+      ++n_cells[cell_classes[cell->active_cell_index()]];
+
+  for(unsigned int c = 0; c < n_classes; ++c)
+    pcout << "Number of cells of class " << c << ": "
+          << dealii::Utilities::MPI::sum(n_cells[c], mpi_comm) << std::endl;
+
+  // matrix-free data with cell batches categorized according to the step size classes
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), dim + 2);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_inner_faces =
+    dealii::update_values | dealii::update_JxW_values | dealii::update_quadrature_points |
+    dealii::update_normal_vectors;
+  additional_data.mapping_update_flags_boundary_faces =
+    additional_data.mapping_update_flags_inner_faces;
+  Categorization::do_step_size_classes(triangulation, additional_data, cell_classes);
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  StepSizeClasses<dim, double> step_size_classes;
+  step_size_classes.initialize(matrix_free, 0, n_classes, cell_classes);
+
+  // boundary conditions of Neumann type, i.e., the exterior state equals the interior state
+  typedef std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> pair;
+
+  auto boundary_descriptor = std::make_shared<CompNS::BoundaryDescriptor<dim>>();
+  boundary_descriptor->density.neumann_bc.insert(
+    pair(0, new dealii::Functions::ZeroFunction<dim>(1)));
+  boundary_descriptor->velocity.neumann_bc.insert(
+    pair(0, new dealii::Functions::ZeroFunction<dim>(dim)));
+  boundary_descriptor->pressure.neumann_bc.insert(
+    pair(0, new dealii::Functions::ZeroFunction<dim>(1)));
+  boundary_descriptor->energy.neumann_bc.insert(
+    pair(0, new dealii::Functions::ZeroFunction<dim>(1)));
+  boundary_descriptor->energy.boundary_variable.insert(
+    std::make_pair(dealii::types::boundary_id(0), CompNS::EnergyBoundaryVariable::Energy));
+
+  CompNS::ConvectiveOperatorData<dim> operator_data;
+  operator_data.dof_index  = 0;
+  operator_data.quad_index = 0;
+  operator_data.bc         = boundary_descriptor;
+
+  CompNS::ConvectiveOperator<dim, double> convective_operator;
+  convective_operator.initialize(matrix_free, operator_data);
+
+  CompNS::ConvectiveOperator<dim, double> convective_operator_classes;
+  convective_operator_classes.initialize(matrix_free, operator_data);
+  convective_operator_classes.set_step_size_classes(step_size_classes);
+
+  VectorType src, dst_full, dst_class, dst_sum;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst_full);
+  matrix_free.initialize_dof_vector(dst_class);
+  matrix_free.initialize_dof_vector(dst_sum);
+
+  dealii::VectorTools::interpolate(mapping, dof_handler, State(), src);
+
+  convective_operator.evaluate(dst_full, src, 0.0);
+
+  bool each_class_contributes = true;
+  for(unsigned int c = 0; c < n_classes; ++c)
+  {
+    step_size_classes.select_classes(c, c);
+    convective_operator_classes.evaluate(dst_class, src, 0.0);
+    each_class_contributes = each_class_contributes && dst_class.l2_norm() > 0.0;
+    dst_sum += dst_class;
+  }
+  step_size_classes.select_all_classes();
+
+  VectorType difference(dst_sum);
+  difference -= dst_full;
+  bool const sum_equals_full = difference.l2_norm() < 1.e-12 * dst_full.l2_norm();
+
+  pcout << "Each class contributes: " << (each_class_contributes ? "yes" : "no") << std::endl;
+  pcout << "Sum of R^(c) over all classes equals R: " << (sum_equals_full ? "yes" : "no")
+        << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::step_size_classes_test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,212 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/time_integration/restart.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const dim = 2;
+
+unsigned int const degree = 3;
+
+unsigned int const n_refinements = 3;
+
+std::string const preamble = "time = 0.125, time_step_number = 42";
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+class Solution : public dealii::Function<dim>
+{
+public:
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  {
+    return std::sin(3.0 * p[0]) * std::exp(p[1]) + 1.0 / 3.0;
+  }
+};
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+/*
+ * Writes a preamble and a vector in double and in single precision to a restart file and reads
+ * them back. The vector has to be restored bitwise, i.e., exactly in double precision and exactly
+ * rounded to float in single precision.
+ */
+void
+restart_test(bool const asynchronous)
+{
+  MPI_Comm const mpi_comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  pcout << std::endl
+        << "Restart round trip, " << (asynchronous ? "asynchronous" : "synchronous")
+        << " writing:" << std::endl
+        << std::endl;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  dealii::FE_DGQ<dim>     fe(degree);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  VectorType vector(dof_handler.locally_owned_dofs(), mpi_comm);
+  dealii::VectorTools::interpolate(dof_handler, Solution(), vector);
+
+  std::string const filename = restart_filename("restart_test");
+
+  CollectiveRestartFile file(mpi_comm);
+  file.open(filename, true /* write */, asynchronous);
+  file.write_preamble(preamble);
+  file.write_vector(vector, dof_handler, false /* single precision */);
+  file.write_vector(vector, dof_handler, true /* single precision */);
+  std::uint64_t const n_bytes_written = file.get_n_bytes();
+  file.close();
+
+  VectorType vector_double(dof_handler.locally_owned_dofs(), mpi_comm);
+  VectorType vector_float(dof_handler.locally_owned_dofs(), mpi_comm);
+
+  file.open(filename, false /* write */);
+  std::string const preamble_read = file.read_preamble();
+  file.read_vector(vector_double, dof_handler);
+  file.read_vector(vector_float, dof_handler);
+  std::uint64_t const n_bytes_read = file.get_n_bytes();
+  file.close();
+
+  bool double_restored = true, float_restored = true;
+  for(unsigned int i = 0; i < vector.locally_owned_size(); ++i)
+  {
+    double const value       = vector.local_element(i);
+    double const value_float = static_cast<float>(value);
+
+    double_restored = double_restored and vector_double.local_element(i) == value;
+    float_restored  = float_restored and vector_float.local_element(i) == value_float;
+  }
+  double_restored = dealii::Utilities::MPI::min(double_restored ? 1 : 0, mpi_comm) == 1;
+  float_restored  = dealii::Utilities::MPI::min(float_restored ? 1 : 0, mpi_comm) == 1;
+
+  pcout << "Preamble restored: " << (preamble_read == preamble ? "yes" : "no") << std::endl;
+  pcout << "Vector restored bitwise (double precision): " << (double_restored ? "yes" : "no")
+        << std::endl;
+  pcout << "Vector restored bitwise (single precision): " << (float_restored ? "yes" : "no")
+        << std::endl;
+  pcout << "Number of bytes read equals number of bytes written: "
+        << (n_bytes_read == n_bytes_written ? "yes" : "no") << std::endl;
+}
+
+/*
+ * Errors returned by MPI-IO have to be reported by an exception.
+ */
+void
+missing_file_test()
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  bool thrown = false;
+  try
+  {
+    CollectiveRestartFile file(restart_filename("non_existing_file"), MPI_COMM_WORLD, false);
+    file.close();
+  }
+  catch(std::exception const &)
+  {
+    thrown = true;
+  }
+
+  pcout << std::endl
+        << "Opening a non-existing restart file throws: " << (thrown ? "yes" : "no") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::restart_test(false);
+    ExaDG::restart_test(true);
+    ExaDG::missing_file_test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
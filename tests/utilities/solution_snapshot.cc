@@ -0,0 +1,247 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/postprocessor/solution_snapshot.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const dim = 2;
+
+unsigned int const degree = 3;
+
+// several trees of the forest so that the order of the space-filling curve is non-trivial
+unsigned int const n_cells_1d_coarse_grid = 3;
+
+unsigned int const n_refinements = 2;
+
+double const snapshot_time = 0.25;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    if(component == 0)
+      return std::sin(3.0 * p[0]) * std::cos(2.0 * p[1]) + 1.0 / 3.0;
+    else
+      return -std::cos(3.0 * p[0]) * std::sin(2.0 * p[1]) / 7.0;
+  }
+};
+
+void
+create_triangulation(dealii::parallel::distributed::Triangulation<dim> & triangulation)
+{
+  dealii::GridGenerator::subdivided_hyper_cube(triangulation, n_cells_1d_coarse_grid);
+  triangulation.refine_global(n_refinements);
+}
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+/*
+ * Writes a snapshot of the interpolated velocity on all processes of mpi_comm.
+ */
+void
+write_snapshot(std::string const & filename, bool const single_precision, MPI_Comm const & mpi_comm)
+{
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  create_triangulation(triangulation);
+
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  VectorType velocity(dof_handler.locally_owned_dofs(), mpi_comm);
+  dealii::VectorTools::interpolate(dof_handler, Velocity(), velocity);
+
+  write_solution_snapshot<dim, double>(
+    filename, dof_handler, {"velocity"}, {&velocity}, snapshot_time, single_precision, mpi_comm);
+}
+
+/*
+ * Reads the snapshot with SolutionSnapshotReader on all processes of mpi_comm and compares the
+ * velocity bitwise with the velocity interpolated on the partition of the reading processes,
+ * rounded to float in case of single precision.
+ */
+void
+read_snapshot(std::string const &                 filename,
+              bool const                          single_precision,
+              unsigned int const                  n_processes_write,
+              MPI_Comm const &                    mpi_comm,
+              dealii::ConditionalOStream const & pcout)
+{
+  dealii::parallel::distributed::Triangulation<dim> triangulation(mpi_comm);
+  create_triangulation(triangulation);
+
+  SolutionSnapshotReader<dim, double> reader(triangulation);
+  reader.read(filename);
+
+  SnapshotMetadata const & metadata = reader.get_metadata();
+  VectorType const &       velocity = reader.get_field("velocity");
+
+  VectorType velocity_reference(reader.get_dof_handler().locally_owned_dofs(), mpi_comm);
+  dealii::VectorTools::interpolate(reader.get_dof_handler(), Velocity(), velocity_reference);
+
+  bool restored = true;
+  for(unsigned int i = 0; i < velocity.locally_owned_size(); ++i)
+  {
+    double value = velocity_reference.local_element(i);
+    if(single_precision)
+      value = static_cast<float>(value);
+
+    restored = restored and velocity.local_element(i) == value;
+  }
+  restored = dealii::Utilities::MPI::min(restored ? 1 : 0, mpi_comm) == 1;
+
+  std::uint64_t const n_cells = std::accumulate(metadata.n_cells_per_process.begin(),
+                                                metadata.n_cells_per_process.end(),
+                                                std::uint64_t(0));
+
+  pcout << "Finite element: " << metadata.fe_name << std::endl;
+  pcout << "Time restored: " << (metadata.time == snapshot_time ? "yes" : "no") << std::endl;
+  pcout << "Partition of the writing processes restored: "
+        << (metadata.n_cells_per_process.size() == n_processes_write and
+                n_cells == triangulation.n_global_active_cells() ?
+              "yes" :
+              "no")
+        << std::endl;
+  pcout << "Velocity restored bitwise: " << (restored ? "yes" : "no") << std::endl;
+}
+
+/*
+ * Writes a snapshot on all N processes and reads it on M = N - 1 processes.
+ */
+void
+snapshot_test(bool const single_precision)
+{
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  unsigned int const n_processes_read = std::max(n_processes - 1, 1u);
+
+  dealii::ConditionalOStream pcout(std::cout, rank == 0);
+
+  pcout << std::endl
+        << "Snapshot in " << (single_precision ? "single" : "double") << " precision written on "
+        << n_processes << " and read on " << n_processes_read << " processes:" << std::endl
+        << std::endl;
+
+  std::string const filename =
+    std::string("solution_") + (single_precision ? "single" : "double") + ".snapshot";
+
+  write_snapshot(filename, single_precision, MPI_COMM_WORLD);
+
+  // the file has to be closed on all processes before it is opened for reading
+  int ierr = MPI_Barrier(MPI_COMM_WORLD);
+  AssertThrowMPI(ierr);
+
+  MPI_Comm mpi_comm_read;
+  ierr = MPI_Comm_split(MPI_COMM_WORLD,
+                        rank < n_processes_read ? 0 : MPI_UNDEFINED,
+                        rank,
+                        &mpi_comm_read);
+  AssertThrowMPI(ierr);
+
+  if(mpi_comm_read != MPI_COMM_NULL)
+  {
+    read_snapshot(filename, single_precision, n_processes, mpi_comm_read, pcout);
+    MPI_Comm_free(&mpi_comm_read);
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::snapshot_test(false);
+    ExaDG::snapshot_test(true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}